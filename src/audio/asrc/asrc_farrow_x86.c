@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/asrc/asrc_config.h>
+
+#if ASRC_X86 == 1
+
+#include <sof/audio/asrc/asrc_farrow.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * AVX2 version for x86 host builds
+ *
+ * The FIR goes through all channels of the output frame in the same loop
+ * with four taps in the 64 bit lanes of each channel accumulator. The ring
+ * buffers hold two copies of the delay line so the taps are read without
+ * wrap. The products are summed exactly in 64 bits, so the result is the
+ * same as from the generic version.
+ *
+ * The impulse response evaluates the polynomials for two pairs of filter
+ * bins per vector. The rounding and saturation of q_multsr_sat_32x32() is
+ * done on the low halves of the 64 bit lanes.
+ */
+
+/* Channels accumulated in the same pass over the taps */
+#define ASRC_X86_CHANNELS	4
+
+/* Impulse response bins, i.e. 32 bit coefficients, per 128 bit load */
+#define ASRC_X86_TAPS		4
+
+/* Coefficients for taps n + 3 .. n in the order of the ring buffer words */
+static inline __m256i asrc_fir_coef(const int32_t *filter_p, int shift)
+{
+	__m128i c = _mm_loadu_si128((const __m128i *)filter_p);
+
+	c = _mm_shuffle_epi32(c, _MM_SHUFFLE(0, 1, 2, 3));
+	return _mm256_cvtepi32_epi64(_mm_srai_epi32(c, shift));
+}
+
+/* Ring buffer words for taps n + 3 .. n, sign extended to 64 bits */
+static inline __m256i asrc_fir_data16(const int16_t *buffer_p, int n)
+{
+	return _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i *)(buffer_p - n - 3)));
+}
+
+static inline __m256i asrc_fir_data32(const int32_t *buffer_p, int n)
+{
+	return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(buffer_p - n - 3)));
+}
+
+static inline int64_t asrc_fir_sum(__m256i acc)
+{
+	__m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc),
+				  _mm256_extracti128_si256(acc, 1));
+
+	return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+void asrc_fir_filter16(struct asrc_farrow *src_obj, int16_t **output_buffers,
+		       int index_output_frame)
+{
+	__m256i acc[ASRC_X86_CHANNELS];
+	__m256i coef;
+	__m256i data;
+	const int32_t *filter_p = src_obj->impulse_response;
+	int16_t *buffer_p[ASRC_X86_CHANNELS];
+	int64_t prod;
+	int32_t prod32;
+	int n_limit = src_obj->filter_length & ~(ASRC_X86_TAPS - 1);
+	int nch = src_obj->num_channels;
+	int lanes;
+	int ch;
+	int c;
+	int n;
+	int i;
+
+	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
+		i = src_obj->num_channels * index_output_frame;
+	else
+		i = index_output_frame;
+
+	for (ch = 0; ch < nch; ch += lanes) {
+		lanes = MIN(nch - ch, ASRC_X86_CHANNELS);
+		for (c = 0; c < lanes; c++) {
+			buffer_p[c] = &src_obj->ring_buffers16[ch + c]
+				[src_obj->buffer_write_position];
+			acc[c] = _mm256_setzero_si256();
+		}
+
+		/* Data is Q1.15, coefficients are Q1.30, the products are
+		 * Qx.45 as in the generic version.
+		 */
+		for (n = 0; n < n_limit; n += ASRC_X86_TAPS) {
+			coef = asrc_fir_coef(&filter_p[n], 0);
+			for (c = 0; c < lanes; c++) {
+				data = asrc_fir_data16(buffer_p[c], n);
+				acc[c] = _mm256_add_epi64(acc[c], _mm256_mul_epi32(data, coef));
+			}
+		}
+
+		for (c = 0; c < lanes; c++) {
+			prod = asrc_fir_sum(acc[c]);
+			for (n = n_limit; n < src_obj->filter_length; n++)
+				prod += (int64_t)buffer_p[c][-n] * filter_p[n];
+
+			prod32 = sat_int32(Q_SHIFT(prod, 45, 31));
+			output_buffers[ch + c][i] = sat_int16(Q_SHIFT_RND(prod32, 31, 15));
+		}
+	}
+}
+
+void asrc_fir_filter32(struct asrc_farrow *src_obj, int32_t **output_buffers,
+		       int index_output_frame)
+{
+	__m256i acc[ASRC_X86_CHANNELS];
+	__m256i coef;
+	__m256i data;
+	const int32_t *filter_p = src_obj->impulse_response;
+	int32_t *buffer_p[ASRC_X86_CHANNELS];
+	int64_t prod;
+	int n_limit = src_obj->filter_length & ~(ASRC_X86_TAPS - 1);
+	int nch = src_obj->num_channels;
+	int lanes;
+	int ch;
+	int c;
+	int n;
+	int i;
+
+	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
+		i = src_obj->num_channels * index_output_frame;
+	else
+		i = index_output_frame;
+
+	for (ch = 0; ch < nch; ch += lanes) {
+		lanes = MIN(nch - ch, ASRC_X86_CHANNELS);
+		for (c = 0; c < lanes; c++) {
+			buffer_p[c] = &src_obj->ring_buffers32[ch + c]
+				[src_obj->buffer_write_position];
+			acc[c] = _mm256_setzero_si256();
+		}
+
+		/* Data is Q1.31, coefficients are Q1.22 after the shift by
+		 * 8 of the generic version, the products are Qx.54.
+		 */
+		for (n = 0; n < n_limit; n += ASRC_X86_TAPS) {
+			coef = asrc_fir_coef(&filter_p[n], 8);
+			for (c = 0; c < lanes; c++) {
+				data = asrc_fir_data32(buffer_p[c], n);
+				acc[c] = _mm256_add_epi64(acc[c], _mm256_mul_epi32(data, coef));
+			}
+		}
+
+		for (c = 0; c < lanes; c++) {
+			prod = asrc_fir_sum(acc[c]);
+			for (n = n_limit; n < src_obj->filter_length; n++)
+				prod += (int64_t)buffer_p[c][-n] * (filter_p[n] >> 8);
+
+			output_buffers[ch + c][i] = sat_int32(Q_SHIFT(prod, 53, 31));
+		}
+	}
+}
+
+/* + ALGORITHM SPECIFIC FUNCTIONS */
+
+/* q_multsr_sat_32x32(x, time, 62 - 31) + y in the low halves of the 64 bit
+ * lanes. Only INT32_MIN * INT32_MIN exceeds the 32 bit range and it is the
+ * only product that gives INT32_MIN, so it is saturated by flipping it to
+ * INT32_MAX.
+ */
+static inline __m256i asrc_ir_mac(__m256i x, __m256i time, __m256i y)
+{
+	__m256i p = _mm256_mul_epi32(x, time);
+
+	p = _mm256_srli_epi64(_mm256_add_epi64(_mm256_srli_epi64(p, 30),
+					       _mm256_set1_epi64x(1)), 1);
+	p = _mm256_xor_si256(p, _mm256_cmpeq_epi32(p, _mm256_set1_epi32(INT32_MIN)));
+	return _mm256_add_epi32(p, y);
+}
+
+/* Loads the two bins of one polynomial of a pair */
+static inline __m128i asrc_ir_load(const int32_t *filter_p)
+{
+	return _mm_loadl_epi64((const __m128i *)filter_p);
+}
+
+static inline void asrc_calc_impulse_response(struct asrc_farrow *src_obj,
+					      const int num_filters)
+{
+	const __m256i pack = _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0);
+	const int32_t *filter_p = src_obj->polyphase_filters;
+	const int pair_step = 2 * num_filters;
+	int32_t *result_p = src_obj->impulse_response;
+	__m256i time;
+	__m256i accum;
+	__m128i c;
+	int32_t time32;
+	int32_t accuml;
+	int32_t accumh;
+	int index_filter;
+	int index_limit;
+	int k;
+
+	time32 = sat_int32(((int64_t)src_obj->time_value) << 4);
+	time = _mm256_set1_epi64x(time32);
+
+	/* The polynomials of a pair of bins are stored one after another,
+	 * see asrc_calc_impulse_response_n4() in the generic version. Two
+	 * pairs are evaluated per iteration with Horner's method.
+	 */
+	index_limit = (src_obj->filter_length >> 1) & ~1;
+	for (index_filter = 0; index_filter < index_limit; index_filter += 2) {
+		c = _mm_unpacklo_epi64(asrc_ir_load(filter_p),
+				       asrc_ir_load(filter_p + pair_step));
+		accum = _mm256_cvtepi32_epi64(c);
+		for (k = 1; k < num_filters; k++) {
+			c = _mm_unpacklo_epi64(asrc_ir_load(filter_p + 2 * k),
+					       asrc_ir_load(filter_p + pair_step + 2 * k));
+			accum = asrc_ir_mac(accum, time, _mm256_cvtepi32_epi64(c));
+		}
+
+		accum = _mm256_permutevar8x32_epi32(accum, pack);
+		_mm_storeu_si128((__m128i *)result_p, _mm256_castsi256_si128(accum));
+		result_p += 4;
+		filter_p += 2 * pair_step;
+	}
+
+	/* Odd number of pairs */
+	if (index_limit < src_obj->filter_length >> 1) {
+		accuml = *filter_p++;
+		accumh = *filter_p++;
+		for (k = 1; k < num_filters; k++) {
+			accuml = *filter_p++ + q_multsr_sat_32x32(accuml, time32, 62 - 31);
+			accumh = *filter_p++ + q_multsr_sat_32x32(accumh, time32, 62 - 31);
+		}
+
+		*result_p++ = accuml;
+		*result_p++ = accumh;
+	}
+}
+
+void asrc_calc_impulse_response_n4(struct asrc_farrow *src_obj)
+{
+	asrc_calc_impulse_response(src_obj, 4);
+}
+
+void asrc_calc_impulse_response_n5(struct asrc_farrow *src_obj)
+{
+	asrc_calc_impulse_response(src_obj, 5);
+}
+
+void asrc_calc_impulse_response_n6(struct asrc_farrow *src_obj)
+{
+	asrc_calc_impulse_response(src_obj, 6);
+}
+
+void asrc_calc_impulse_response_n7(struct asrc_farrow *src_obj)
+{
+	asrc_calc_impulse_response(src_obj, 7);
+}
+
+#endif /* ASRC_X86 */
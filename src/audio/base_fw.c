@@ -10,6 +10,7 @@
 #include <sof_versions.h>
 #include <sof/lib/cpu-clk-manager.h>
 #include <sof/lib/cpu.h>
+#include <sof/schedule/ll_schedule_stats.h>
 #include <rtos/init.h>
 
 #if CONFIG_ACE_V1X_ART_COUNTER || CONFIG_ACE_V1X_RTC_COUNTER
@@ -391,6 +392,148 @@ static int basefw_power_state_info_get(uint32_t *data_offset, char *data)
 	return 0;
 }
 
+#if CONFIG_SCHEDULE_LL_STATS
+#define BASEFW_LL_STATS_RETRIES		3
+#define BASEFW_LL_STATS_MAX_SIZE	(CONFIG_CORE_COUNT * \
+	(sizeof(struct ipc4_tuple) + sizeof(struct ipc4_ll_core_stats) + \
+	 LL_STATS_MAX_TASKS * (sizeof(struct ipc4_tuple) + sizeof(struct ipc4_ll_task_stats))) + \
+	sizeof(struct ipc4_tuple))
+
+/* LL scheduler statistics reply, taken on the first block and kept
+ * until the host has read the last one
+ */
+static struct {
+	char *data;
+	uint32_t size;
+} basefw_ll_stats;
+
+static struct ipc4_tuple *basefw_ll_core_stats(struct ipc4_tuple *tuple, int core_id,
+					       const struct ll_core_stats_info *info)
+{
+	struct ipc4_ll_core_stats core_stats;
+	struct ipc4_ll_task_stats task_stats;
+	const struct ll_task_stats_info *ti;
+	int i;
+
+	core_stats.core_id = core_id;
+	core_stats.ticks = info->ticks;
+	core_stats.overruns = info->overruns;
+	core_stats.budget = info->budget;
+	core_stats.window_cycles = info->window_cycles;
+	core_stats.window_busy = info->window_busy;
+	core_stats.task_count = info->task_count;
+
+	set_tuple(tuple, IPC4_LL_CORE_STATS, sizeof(core_stats), &core_stats);
+	tuple = next_tuple(tuple);
+
+	for (i = 0; i < info->task_info_count; i++) {
+		ti = info->tasks + i;
+
+		memcpy_s(task_stats.uuid, sizeof(task_stats.uuid), &ti->uuid, sizeof(ti->uuid));
+		task_stats.id = ti->id;
+		task_stats.priority = ti->priority;
+		task_stats.runs = ti->stats.runs;
+		task_stats.overruns = ti->stats.overruns;
+		task_stats.cycles_max = ti->stats.cycles_max;
+		task_stats.hist_shift = LL_STATS_HIST_SHIFT;
+		memcpy_s(task_stats.hist, sizeof(task_stats.hist), ti->stats.hist,
+			 sizeof(ti->stats.hist));
+
+		set_tuple(tuple, IPC4_LL_TASK_STATS, sizeof(task_stats), &task_stats);
+		tuple = next_tuple(tuple);
+	}
+
+	return tuple;
+}
+
+static int basefw_ll_stats_take(void)
+{
+	struct ipc4_tuple *tuple;
+	struct ll_core_stats_info *info;
+	int core_id;
+	int ret;
+	int i;
+
+	info = rballoc(0, SOF_MEM_CAPS_RAM, sizeof(*info));
+	basefw_ll_stats.data = rballoc(0, SOF_MEM_CAPS_RAM, BASEFW_LL_STATS_MAX_SIZE);
+	if (!info || !basefw_ll_stats.data) {
+		rfree(info);
+		rfree(basefw_ll_stats.data);
+		basefw_ll_stats.data = NULL;
+		return -ENOMEM;
+	}
+
+	tuple = (struct ipc4_tuple *)basefw_ll_stats.data;
+
+	for (core_id = 0; core_id < CONFIG_CORE_COUNT; core_id++) {
+		if (!cpu_is_core_enabled(core_id))
+			continue;
+
+		/* the core may be publishing, which is short, so just retry */
+		for (i = 0; i < BASEFW_LL_STATS_RETRIES; i++) {
+			ret = ll_stats_get(core_id, info);
+			if (ret != -EAGAIN)
+				break;
+		}
+
+		if (!ret)
+			tuple = basefw_ll_core_stats(tuple, core_id, info);
+	}
+
+	basefw_ll_stats.size = (char *)tuple - basefw_ll_stats.data;
+
+	rfree(info);
+
+	/* nothing published yet */
+	if (!basefw_ll_stats.size) {
+		rfree(basefw_ll_stats.data);
+		basefw_ll_stats.data = NULL;
+		return -ENODATA;
+	}
+
+	/* The reply ends with a block shorter than SOF_IPC_MSG_MAX_SIZE,
+	 * a reply filling whole blocks gets an empty tuple appended.
+	 */
+	if (!(basefw_ll_stats.size % SOF_IPC_MSG_MAX_SIZE)) {
+		tuple->type = IPC4_LL_STATS_PAD;
+		tuple->length = 0;
+		basefw_ll_stats.size += sizeof(*tuple);
+	}
+
+	return 0;
+}
+
+static int basefw_ll_stats_get(bool first_block, uint32_t *data_offset, char *data)
+{
+	uint32_t offset = 0;
+	uint32_t size;
+	int ret;
+
+	if (first_block) {
+		rfree(basefw_ll_stats.data);
+		ret = basefw_ll_stats_take();
+		if (ret < 0)
+			return ret;
+	} else {
+		/* the host passes the offset of the block */
+		offset = *data_offset;
+		if (!basefw_ll_stats.data || offset >= basefw_ll_stats.size)
+			return -EINVAL;
+	}
+
+	size = MIN(basefw_ll_stats.size - offset, SOF_IPC_MSG_MAX_SIZE);
+	memcpy_s(data, SOF_IPC_MSG_MAX_SIZE, basefw_ll_stats.data + offset, size);
+	*data_offset = size;
+
+	if (offset + size == basefw_ll_stats.size) {
+		rfree(basefw_ll_stats.data);
+		basefw_ll_stats.data = NULL;
+	}
+
+	return 0;
+}
+#endif
+
 static int basefw_get_large_config(struct comp_dev *dev,
 				   uint32_t param_id,
 				   bool first_block,
@@ -403,6 +546,7 @@ static int basefw_get_large_config(struct comp_dev *dev,
 	switch (param_id) {
 	case IPC4_PERF_MEASUREMENTS_STATE:
 	case IPC4_GLOBAL_PERF_DATA:
+	case IPC4_LL_SCHEDULER_STATS:
 		break;
 	default:
 		if (!first_block)
@@ -429,6 +573,10 @@ static int basefw_get_large_config(struct comp_dev *dev,
 	break;
 	case IPC4_POWER_STATE_INFO_GET:
 		return basefw_power_state_info_get(data_offset, data);
+#if CONFIG_SCHEDULE_LL_STATS
+	case IPC4_LL_SCHEDULER_STATS:
+		return basefw_ll_stats_get(first_block, data_offset, data);
+#endif
 	/* TODO: add more support */
 	case IPC4_DSP_RESOURCE_STATE:
 	case IPC4_NOTIFICATION_MASK:
@@ -82,6 +82,40 @@ struct comp_buffer *buffer_alloc(uint32_t size, uint32_t caps, uint32_t align)
 	return buffer;
 }
 
+int buffer_set_spsc(struct comp_buffer *buffer)
+{
+	struct comp_buffer __sparse_cache *buffer_c;
+	struct audio_stream_spsc *spsc;
+
+	if (buffer->stream.spsc)
+		return 0;
+
+	/* cores would write back stale copies of the shared descriptor */
+	if (IS_ENABLED(CONFIG_INCOHERENT)) {
+		buf_err(buffer, "buffer_set_spsc(): not supported on incoherent cache");
+		return -ENOTSUP;
+	}
+
+	/* positions are accessed uncached by both cores */
+	spsc = rballoc_align(SOF_MEM_FLAG_COHERENT, SOF_MEM_CAPS_RAM, sizeof(*spsc),
+			     DCACHE_LINE_SIZE);
+	if (!spsc) {
+		buf_err(buffer, "buffer_set_spsc(): could not alloc positions");
+		return -ENOMEM;
+	}
+
+	/* the positions continue from the current stream state */
+	buffer_c = buffer_acquire(buffer);
+	spsc->r_pos = (char *)buffer_c->stream.r_ptr - (char *)buffer_c->stream.addr;
+	spsc->w_pos = spsc->r_pos + buffer_c->stream.avail;
+	buffer_c->stream.spsc = spsc;
+
+	/* buffer_release() would skip the lock in lock free mode */
+	coherent_release_thread(&buffer_c->c, sizeof(*buffer));
+
+	return 0;
+}
+
 void buffer_zero(struct comp_buffer __sparse_cache *buffer)
 {
 	buf_dbg(buffer, "stream_zero()");
@@ -191,6 +225,7 @@ void buffer_free(struct comp_buffer *buffer)
 	/* In case some listeners didn't unregister from buffer's callbacks */
 	notifier_unregister_all(NULL, buffer);
 
+	rfree(buffer->stream.spsc);
 	rfree(buffer->stream.addr);
 	coherent_free_thread(buffer, c);
 }
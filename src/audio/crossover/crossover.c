@@ -86,6 +86,10 @@ static inline void crossover_reset_state(struct comp_data *cd)
 
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		crossover_reset_state_ch(&cd->state[i]);
+
+	rfree(cd->block_buf[0]);
+	for (i = 0; i < CROSSOVER_4WAY_NUM_SINKS; i++)
+		cd->block_buf[i] = NULL;
 }
 
 /**
@@ -301,6 +305,27 @@ static int crossover_init_coef(struct comp_data *cd, int nch)
 	return 0;
 }
 
+/**
+ * \brief Allocates the block buffers of the sinks for nch channels.
+ */
+static int crossover_init_block_buf(struct comp_data *cd, int nch)
+{
+	size_t samples = CROSSOVER_BLOCK_FRAMES * nch;
+	int i;
+
+	cd->block_buf[0] = rballoc(0, SOF_MEM_CAPS_RAM,
+				   cd->config->num_sinks * samples * sizeof(int32_t));
+	if (!cd->block_buf[0]) {
+		comp_cl_err(&comp_crossover, "crossover_init_block_buf(), could not allocate block buffers");
+		return -ENOMEM;
+	}
+
+	for (i = 1; i < cd->config->num_sinks; i++)
+		cd->block_buf[i] = cd->block_buf[i - 1] + samples;
+
+	return 0;
+}
+
 /**
  * \brief Setup the state, coefficients and processing functions for crossover.
  */
@@ -313,8 +338,10 @@ static int crossover_setup(struct comp_data *cd, int nch)
 
 	/* Assign LR4 coefficients from config */
 	ret = crossover_init_coef(cd, nch);
+	if (ret < 0)
+		return ret;
 
-	return ret;
+	return crossover_init_block_buf(cd, nch);
 }
 
 /**
@@ -355,7 +382,7 @@ static struct comp_dev *crossover_new(const struct comp_driver *drv,
 	comp_set_drvdata(dev, cd);
 
 	cd->crossover_process = NULL;
-	cd->crossover_split = NULL;
+	cd->crossover_split_block = NULL;
 	cd->config = NULL;
 
 	/* Handler for configuration data */
@@ -774,9 +801,9 @@ static int crossover_prepare(struct comp_dev *dev)
 			goto out;
 		}
 
-		cd->crossover_split =
-			crossover_find_split_func(cd->config->num_sinks);
-		if (!cd->crossover_split) {
+		cd->crossover_split_block =
+			crossover_find_split_block_func(cd->config->num_sinks);
+		if (!cd->crossover_split_block) {
 			comp_err(dev, "crossover_prepare(), No split function matching num_sinks %i",
 				 cd->config->num_sinks);
 			ret = -EINVAL;
@@ -819,7 +846,7 @@ static int crossover_reset(struct comp_dev *dev)
 	crossover_reset_state(cd);
 
 	cd->crossover_process = NULL;
-	cd->crossover_split = NULL;
+	cd->crossover_split_block = NULL;
 
 	comp_set_state(dev, COMP_TRIGGER_RESET);
 
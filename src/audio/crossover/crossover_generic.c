@@ -11,6 +11,7 @@
 #include <sof/audio/crossover/crossover.h>
 #include <sof/math/iir_df2t.h>
 
+#if !IIR_X86
 /*
  * \brief Splits x into two based on the coefficients set in the lp
  *        and hp filters. The output of the lp is in y1, the output of
@@ -84,6 +85,7 @@ static void crossover_generic_split_4way(int32_t in,
 	crossover_generic_lr4_split(&state->lowpass[2], &state->highpass[2],
 				    z2, &out[2], &out[3]);
 }
+#endif /* !IIR_X86 */
 
 #if CONFIG_FORMAT_S16LE
 static void crossover_s16_default_pass(const struct comp_dev *dev,
@@ -134,135 +136,214 @@ static void crossover_s32_default_pass(const struct comp_dev *dev,
 }
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
-#if CONFIG_FORMAT_S16LE
-static void crossover_s16_default(const struct comp_dev *dev,
-				  const struct comp_buffer __sparse_cache *source,
-				  struct comp_buffer __sparse_cache *sinks[],
-				  int32_t num_sinks,
-				  uint32_t frames)
+#if IIR_X86
+/*
+ * \brief Block version of crossover_generic_lr4_split() for all channels.
+ *        The lowpass output y1 can be the same buffer as input x.
+ */
+static void crossover_block_lr4_split(struct crossover_state state[], int k,
+				      int nch, int32_t *x, int32_t *y1,
+				      int32_t *y2, int frames)
 {
-	struct comp_data *cd = comp_get_drvdata(dev);
-	struct crossover_state *state;
-	const struct audio_stream __sparse_cache *source_stream = &source->stream;
-	struct audio_stream __sparse_cache *sink_stream;
-	int16_t *x, *y;
-	int ch, i, j;
-	int idx;
-	int nch = source_stream->channels;
-	int32_t out[num_sinks];
+	struct iir_state_df2t *lp[PLATFORM_MAX_CHANNELS];
+	struct iir_state_df2t *hp[PLATFORM_MAX_CHANNELS];
+	int ch;
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
-		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source_stream, idx);
-			cd->crossover_split(*x << 16, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_write_frag_s16(sink_stream,
-								idx);
-				*y = sat_int16(Q_SHIFT_RND(out[j], 31, 15));
-			}
-
-			idx += nch;
-		}
+		lp[ch] = &state[ch].lowpass[k];
+		hp[ch] = &state[ch].highpass[k];
 	}
+
+	/* the channels are in SIMD lanes on x86 hosts */
+	iir_df2t_multich(hp, nch, x, y2, frames);
+	iir_df2t_multich(lp, nch, x, y1, frames);
 }
-#endif /* CONFIG_FORMAT_S16LE */
 
-#if CONFIG_FORMAT_S24LE
-static void crossover_s24_default(const struct comp_dev *dev,
-				  const struct comp_buffer __sparse_cache *source,
-				  struct comp_buffer __sparse_cache *sinks[],
-				  int32_t num_sinks,
-				  uint32_t frames)
+static void crossover_split_2way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
 {
-	struct comp_data *cd = comp_get_drvdata(dev);
-	struct crossover_state *state;
-	const struct audio_stream __sparse_cache *source_stream = &source->stream;
-	struct audio_stream __sparse_cache *sink_stream;
-	int32_t *x, *y;
+	crossover_block_lr4_split(state, 0, nch, in, out[0], out[1], frames);
+}
+
+static void crossover_split_3way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
+{
+	int i;
+
+	crossover_block_lr4_split(state, 0, nch, in, out[0], out[1], frames);
+
+	/* Realign the phase of z1, out[2] is free for the highpass part */
+	crossover_block_lr4_split(state, 1, nch, out[0], out[0], out[2], frames);
+	for (i = 0; i < frames * nch; i++)
+		out[0][i] = sat_int32((int64_t)out[0][i] + out[2][i]);
+
+	crossover_block_lr4_split(state, 2, nch, out[1], out[1], out[2], frames);
+}
+
+static void crossover_split_4way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
+{
+	crossover_block_lr4_split(state, 1, nch, in, out[0], out[2], frames);
+	crossover_block_lr4_split(state, 0, nch, out[0], out[0], out[1], frames);
+	crossover_block_lr4_split(state, 2, nch, out[2], out[2], out[3], frames);
+}
+#else
+/*
+ * \brief Splits a block with the sample split function, one channel at a
+ *        time. The first band buffer can be the input buffer.
+ */
+static void crossover_block_split(crossover_split split, int num_bands,
+				  struct crossover_state state[], int nch,
+				  int32_t *in, int32_t *out[], int frames)
+{
+	int32_t y[CROSSOVER_4WAY_NUM_SINKS];
+	int samples = frames * nch;
 	int ch, i, j;
-	int idx;
-	int nch = source_stream->channels;
-	int32_t out[num_sinks];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
-		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			cd->crossover_split(*x << 8, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_write_frag_s32(sink_stream,
-								idx);
-				*y = sat_int24(Q_SHIFT_RND(out[j], 31, 23));
-			}
-
-			idx += nch;
+		for (i = ch; i < samples; i += nch) {
+			split(in[i], y, &state[ch]);
+			for (j = 0; j < num_bands; j++)
+				out[j][i] = y[j];
 		}
 	}
 }
+
+static void crossover_split_2way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
+{
+	crossover_block_split(crossover_generic_split_2way, CROSSOVER_2WAY_NUM_SINKS,
+			      state, nch, in, out, frames);
+}
+
+static void crossover_split_3way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
+{
+	crossover_block_split(crossover_generic_split_3way, CROSSOVER_3WAY_NUM_SINKS,
+			      state, nch, in, out, frames);
+}
+
+static void crossover_split_4way_block(struct crossover_state state[], int nch,
+				       int32_t *in, int32_t *out[], int frames)
+{
+	crossover_block_split(crossover_generic_split_4way, CROSSOVER_4WAY_NUM_SINKS,
+			      state, nch, in, out, frames);
+}
+#endif /* IIR_X86 */
+
+static void crossover_block_read(const struct audio_stream __sparse_cache *source,
+				 int idx, int32_t *buf, int samples)
+{
+	int16_t *x16;
+	int32_t *x32;
+	int i;
+
+	switch (source->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			x16 = audio_stream_read_frag_s16(source, idx + i);
+			buf[i] = *x16 << 16;
+		}
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32 << 8;
+		}
+		break;
 #endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32;
+		}
+		break;
+	}
+}
 
-#if CONFIG_FORMAT_S32LE
-static void crossover_s32_default(const struct comp_dev *dev,
-				  const struct comp_buffer __sparse_cache *source,
-				  struct comp_buffer __sparse_cache *sinks[],
-				  int32_t num_sinks,
-				  uint32_t frames)
+static void crossover_block_write(struct audio_stream __sparse_cache *sink,
+				  int idx, const int32_t *buf, int samples)
 {
-	struct comp_data *cd = comp_get_drvdata(dev);
-	struct crossover_state *state;
-	const struct audio_stream __sparse_cache *source_stream = &source->stream;
-	struct audio_stream __sparse_cache *sink_stream;
-	int32_t *x, *y;
-	int ch, i, j;
-	int idx;
-	int nch = source_stream->channels;
-	int32_t out[num_sinks];
+	int16_t *y16;
+	int32_t *y32;
+	int i;
 
-	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
-		state = &cd->state[0];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			cd->crossover_split(*x, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_write_frag_s32(sink_stream,
-								idx);
-				*y = out[j];
-			}
-
-			idx += nch;
+	switch (sink->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			y16 = audio_stream_write_frag_s16(sink, idx + i);
+			*y16 = sat_int16(Q_SHIFT_RND(buf[i], 31, 15));
+		}
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = sat_int24(Q_SHIFT_RND(buf[i], 31, 23));
+		}
+		break;
+#endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = buf[i];
 		}
+		break;
+	}
+}
+
+/*
+ * \brief Processes the period in blocks of frames. Each block is converted
+ *        to Q1.31, split to the band buffers while it is in cache and
+ *        written to the sinks.
+ */
+static void crossover_default(const struct comp_dev *dev,
+			      const struct comp_buffer __sparse_cache *source,
+			      struct comp_buffer __sparse_cache *sinks[],
+			      int32_t num_sinks, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t *out[CROSSOVER_4WAY_NUM_SINKS];
+	int nch = source->stream.channels;
+	int idx = 0;
+	int samples;
+	int j, n;
+
+	for (j = 0; j < num_sinks; j++)
+		out[j] = cd->block_buf[j];
+
+	while (frames) {
+		n = MIN(frames, CROSSOVER_BLOCK_FRAMES);
+		samples = n * nch;
+
+		crossover_block_read(&source->stream, idx, cd->block_buf[0], samples);
+		cd->crossover_split_block(cd->state, nch, cd->block_buf[0], out, n);
+		for (j = 0; j < num_sinks; j++)
+			if (sinks[j])
+				crossover_block_write(&sinks[j]->stream, idx, out[j], samples);
+
+		idx += samples;
+		frames -= n;
 	}
 }
-#endif /* CONFIG_FORMAT_S32LE */
 
 const struct crossover_proc_fnmap crossover_proc_fnmap[] = {
 /* { SOURCE_FORMAT , PROCESSING FUNCTION } */
 #if CONFIG_FORMAT_S16LE
-	{ SOF_IPC_FRAME_S16_LE, crossover_s16_default },
+	{ SOF_IPC_FRAME_S16_LE, crossover_default },
 #endif /* CONFIG_FORMAT_S16LE */
 
 #if CONFIG_FORMAT_S24LE
-	{ SOF_IPC_FRAME_S24_4LE, crossover_s24_default },
+	{ SOF_IPC_FRAME_S24_4LE, crossover_default },
 #endif /* CONFIG_FORMAT_S24LE */
 
 #if CONFIG_FORMAT_S32LE
-	{ SOF_IPC_FRAME_S32_LE, crossover_s32_default },
+	{ SOF_IPC_FRAME_S32_LE, crossover_default },
 #endif /* CONFIG_FORMAT_S32LE */
 };
 
@@ -283,10 +364,8 @@ const struct crossover_proc_fnmap crossover_proc_fnmap_pass[] = {
 
 const size_t crossover_proc_fncount = ARRAY_SIZE(crossover_proc_fnmap);
 
-const crossover_split crossover_split_fnmap[] = {
-	crossover_generic_split_2way,
-	crossover_generic_split_3way,
-	crossover_generic_split_4way,
+const crossover_split_block crossover_split_block_fnmap[] = {
+	crossover_split_2way_block,
+	crossover_split_3way_block,
+	crossover_split_4way_block,
 };
-
-const size_t crossover_split_fncount = ARRAY_SIZE(crossover_split_fnmap);
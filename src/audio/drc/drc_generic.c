@@ -256,194 +256,90 @@ void drc_update_envelope(struct drc_state *state, const struct sof_drc_params *p
 }
 
 /* Calculate compress_gain from the envelope and apply total_gain to compress
- * the next output division. */
+ * the next output division. The serial envelope recurrence gives the gains for
+ * the whole division first, then they are applied to each channel block.
+ */
 void drc_compress_output(struct drc_state *state,
 			 const struct sof_drc_params *p,
 			 int nbyte,
 			 int nch)
 {
 	const int div_start = state->pre_delay_read_index;
-	int count = DRC_DIVISION_FRAMES >> 2;
-
+	int32_t total_gain[DRC_DIVISION_FRAMES]; /* Q8.24 */
 	int32_t c, base, r, r2, r4; /* Q2.30 */
 	int32_t x[4]; /* Q2.30 */
 	int32_t post_warp_compressor_gain;
-	int32_t total_gain;
-
-	int i, j, ch, inc;
+	int is_release;
+	int i, j, ch;
 	int16_t *sample16_p; /* for s16 format case */
 	int32_t *sample32_p; /* for s24 and s32 format cases */
-	int32_t sample;
-	int is_2byte = (nbyte == 2); /* otherwise is 4-bytes */
 
 	/* Exponential approach to desired gain. */
-	if (state->envelope_rate < ONE_Q30) {
+	is_release = state->envelope_rate >= ONE_Q30;
+	if (!is_release) {
 		/* Attack - reduce gain to desired. */
 		c = state->compressor_gain - state->scaled_desired_gain;
 		base = state->scaled_desired_gain;
 		r = ONE_Q30 - state->envelope_rate;
-		x[0] = Q_MULTSR_32X32((int64_t)c,  r, 30, 30, 30);
-		for (j = 1; j < 4; j++)
-			x[j] = Q_MULTSR_32X32((int64_t)x[j - 1], r, 30, 30, 30);
-		r2 = Q_MULTSR_32X32((int64_t)r, r, 30, 30, 30);
-		r4 = Q_MULTSR_32X32((int64_t)r2, r2, 30, 30, 30);
-
-		i = 0;
-		inc = 0;
-		if (is_2byte) { /* 2 bytes per sample */
-			while (1) {
-				for (j = 0; j < 4; j++) {
-					/* Warp pre-compression gain to smooth out sharp
-					 * exponential transition points.
-					 */
-					post_warp_compressor_gain =
-						drc_sin_fixed(x[j] + base); /* Q1.31 */
-
-					/* Calculate total gain using master gain. */
-					total_gain = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
-								    post_warp_compressor_gain,
-								    24, 31, 24); /* Q8.24 */
-
-					/* Apply final gain. */
-					for (ch = 0; ch < nch; ch++) {
-						sample16_p =
-							(int16_t *)state->pre_delay_buffers[ch] +
-								div_start + inc;
-						sample = (int32_t)*sample16_p;
-						*sample16_p =
-							sat_int16(Q_MULTSR_32X32((int64_t)sample,
-										 total_gain,
-										 15, 24, 15));
-					}
-					inc++;
-				}
-
-				if (++i == count)
-					break;
-
-				for (j = 0; j < 4; j++)
-					x[j] = Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30);
-			}
-		} else { /* 4 bytes per sample */
-			while (1) {
-				for (j = 0; j < 4; j++) {
-					/* Warp pre-compression gain to smooth out sharp
-					 * exponential transition points.
-					 */
-					post_warp_compressor_gain =
-						drc_sin_fixed(x[j] + base); /* Q1.31 */
-
-					/* Calculate total gain using master gain. */
-					total_gain = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
-								    post_warp_compressor_gain,
-								    24, 31, 24); /* Q8.24 */
-
-					/* Apply final gain. */
-					for (ch = 0; ch < nch; ch++) {
-						sample32_p =
-							(int32_t *)state->pre_delay_buffers[ch] +
-								div_start + inc;
-						sample = *sample32_p;
-						*sample32_p =
-							sat_int32(Q_MULTSR_32X32((int64_t)sample,
-										 total_gain,
-										 31, 24, 31));
-					}
-					inc++;
-				}
-
-				if (++i == count)
-					break;
-
-				for (j = 0; j < 4; j++)
-					x[j] = Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30);
-			}
-		}
-
-		state->compressor_gain = x[3] + base;
 	} else {
 		/* Release - exponentially increase gain to 1.0 */
 		c = state->compressor_gain;
+		base = 0;
 		r = state->envelope_rate;
-		x[0] = Q_MULTSR_32X32((int64_t)c,  r, 30, 30, 30);
-		for (j = 1; j < 4; j++)
-			x[j] = Q_MULTSR_32X32((int64_t)x[j - 1], r, 30, 30, 30);
-		r2 = Q_MULTSR_32X32((int64_t)r, r, 30, 30, 30);
-		r4 = Q_MULTSR_32X32((int64_t)r2, r2, 30, 30, 30);
-
-		i = 0;
-		inc = 0;
-		if (is_2byte) { /* 2 bytes per sample */
-			while (1) {
-				for (j = 0; j < 4; j++) {
-					/* Warp pre-compression gain to smooth out sharp
-					 * exponential transition points.
-					 */
-					post_warp_compressor_gain = drc_sin_fixed(x[j]); /* Q1.31 */
-
-					/* Calculate total gain using master gain. */
-					total_gain = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
-								    post_warp_compressor_gain,
-								    24, 31, 24); /* Q8.24 */
-
-					/* Apply final gain. */
-					for (ch = 0; ch < nch; ch++) {
-						sample16_p =
-							(int16_t *)state->pre_delay_buffers[ch] +
-								div_start + inc;
-						sample = (int32_t)*sample16_p;
-						*sample16_p =
-							sat_int16(Q_MULTSR_32X32((int64_t)sample,
-										 total_gain,
-										 15, 24, 15));
-					}
-					inc++;
-				}
-
-				if (++i == count)
-					break;
-
-				for (j = 0; j < 4; j++)
-					x[j] = MIN(ONE_Q30,
-						   Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30));
-			}
-		} else { /* 4 bytes per sample */
-			while (1) {
-				for (j = 0; j < 4; j++) {
-					/* Warp pre-compression gain to smooth out sharp
-					 * exponential transition points.
-					 */
-					post_warp_compressor_gain = drc_sin_fixed(x[j]); /* Q1.31 */
-
-					/* Calculate total gain using master gain. */
-					total_gain = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
-								    post_warp_compressor_gain,
-								    24, 31, 24); /* Q8.24 */
-
-					/* Apply final gain. */
-					for (ch = 0; ch < nch; ch++) {
-						sample32_p =
-							(int32_t *)state->pre_delay_buffers[ch] +
-								div_start + inc;
-						sample = *sample32_p;
-						*sample32_p =
-							sat_int32(Q_MULTSR_32X32((int64_t)sample,
-										 total_gain,
-										 31, 24, 31));
-					}
-					inc++;
-				}
-
-				if (++i == count)
-					break;
-
-				for (j = 0; j < 4; j++)
-					x[j] = MIN(ONE_Q30,
-						   Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30));
-			}
+	}
+
+	x[0] = Q_MULTSR_32X32((int64_t)c,  r, 30, 30, 30);
+	for (j = 1; j < 4; j++)
+		x[j] = Q_MULTSR_32X32((int64_t)x[j - 1], r, 30, 30, 30);
+	r2 = Q_MULTSR_32X32((int64_t)r, r, 30, 30, 30);
+	r4 = Q_MULTSR_32X32((int64_t)r2, r2, 30, 30, 30);
+
+	i = 0;
+	while (1) {
+		for (j = 0; j < 4; j++) {
+			/* Warp pre-compression gain to smooth out sharp
+			 * exponential transition points.
+			 */
+			post_warp_compressor_gain = drc_sin_fixed(x[j] + base); /* Q1.31 */
+
+			/* Calculate total gain using master gain. */
+			total_gain[i + j] = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
+							   post_warp_compressor_gain,
+							   24, 31, 24); /* Q8.24 */
+		}
+
+		i += 4;
+		if (i == DRC_DIVISION_FRAMES)
+			break;
+
+		for (j = 0; j < 4; j++) {
+			x[j] = Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30);
+			if (is_release)
+				x[j] = MIN(ONE_Q30, x[j]);
 		}
+	}
+
+	state->compressor_gain = x[3] + base;
 
-		state->compressor_gain = x[3];
+	/* Apply final gain. The pre-delay is a multiple of the division so the
+	 * division is contiguous in each channel buffer.
+	 */
+	if (nbyte == 2) { /* 2 bytes per sample */
+		for (ch = 0; ch < nch; ch++) {
+			sample16_p = (int16_t *)state->pre_delay_buffers[ch] + div_start;
+			for (i = 0; i < DRC_DIVISION_FRAMES; i++)
+				sample16_p[i] =
+					sat_int16(Q_MULTSR_32X32((int64_t)sample16_p[i],
+								 total_gain[i], 15, 24, 15));
+		}
+	} else { /* 4 bytes per sample */
+		for (ch = 0; ch < nch; ch++) {
+			sample32_p = (int32_t *)state->pre_delay_buffers[ch] + div_start;
+			for (i = 0; i < DRC_DIVISION_FRAMES; i++)
+				sample32_p[i] =
+					sat_int32(Q_MULTSR_32X32((int64_t)sample32_p[i],
+								 total_gain[i], 31, 24, 31));
+		}
 	}
 }
 
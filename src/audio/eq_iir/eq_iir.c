@@ -292,6 +292,111 @@ static void eq_iir_s32_24_default(const struct comp_dev *dev,
 }
 #endif /* CONFIG_FORMAT_S32LE && CONFIG_FORMAT_S24LE */
 
+#if IIR_DF1_X86
+
+/* Frames per block converted to Q1.31 for iir_df1_multich() */
+#define EQ_IIR_X86_FRAMES	64
+
+/* Read samples as Q1.31 in the same way as the iir_df1_s16() etc. */
+static void eq_iir_x86_read(const struct audio_stream __sparse_cache *source,
+			    int idx, int32_t *buf, int samples)
+{
+	int16_t *x16;
+	int32_t *x32;
+	int i;
+
+	switch (source->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			x16 = audio_stream_read_frag_s16(source, idx + i);
+			buf[i] = (int32_t)*x16 << 16;
+		}
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32 << 8;
+		}
+		break;
+#endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32;
+		}
+		break;
+	}
+}
+
+static void eq_iir_x86_write(struct audio_stream __sparse_cache *sink,
+			     int idx, const int32_t *buf, int samples)
+{
+	int16_t *y16;
+	int32_t *y32;
+	int i;
+
+	switch (sink->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			y16 = audio_stream_write_frag_s16(sink, idx + i);
+			*y16 = sat_int16(Q_SHIFT_RND(buf[i], 31, 15));
+		}
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = sat_int24(Q_SHIFT_RND(buf[i], 31, 23));
+		}
+		break;
+#endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = buf[i];
+		}
+		break;
+	}
+}
+
+/*
+ * EQ IIR for x86 host builds. A block of frames is converted to Q1.31 and
+ * the channels are filtered in SIMD lanes. Handles all formats of
+ * fm_configured[] with output identical to the functions above.
+ */
+static void eq_iir_x86(const struct comp_dev *dev,
+		       const struct audio_stream __sparse_cache *source,
+		       struct audio_stream __sparse_cache *sink, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	struct iir_state_df1 *filter[PLATFORM_MAX_CHANNELS];
+	int32_t buf[EQ_IIR_X86_FRAMES * PLATFORM_MAX_CHANNELS];
+	const int nch = source->channels;
+	int idx = 0;
+	int samples;
+	int n;
+	int i;
+
+	for (i = 0; i < nch; i++)
+		filter[i] = &cd->iir[i];
+
+	while (frames) {
+		n = MIN(frames, EQ_IIR_X86_FRAMES);
+		samples = n * nch;
+		eq_iir_x86_read(source, idx, buf, samples);
+		iir_df1_multich(filter, nch, buf, buf, n);
+		eq_iir_x86_write(sink, idx, buf, samples);
+		idx += samples;
+		frames -= n;
+	}
+}
+#endif /* IIR_DF1_X86 */
+
 static void eq_iir_pass(const struct comp_dev *dev,
 			const struct audio_stream __sparse_cache *source,
 			struct audio_stream __sparse_cache *sink,
@@ -928,6 +1033,10 @@ static int eq_iir_prepare(struct comp_dev *dev)
 			ret = -EINVAL;
 			goto out;
 		}
+#if IIR_DF1_X86
+		/* filter the channels in SIMD lanes on x86 hosts */
+		cd->eq_iir_func = eq_iir_x86;
+#endif
 		comp_info(dev, "eq_iir_prepare(), IIR is configured.");
 	} else {
 		cd->eq_iir_func = eq_iir_find_func(source_format, sink_format, fm_passthrough,
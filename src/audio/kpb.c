@@ -109,7 +109,7 @@ static void kpb_copy_samples(struct comp_buffer __sparse_cache *sink,
 			     struct comp_buffer __sparse_cache *source, size_t size,
 			     size_t sample_width, uint32_t channels);
 static void kpb_drain_samples(void *source, struct audio_stream __sparse_cache *sink,
-			      size_t size, size_t sample_width);
+			      int offset, size_t size, size_t sample_width);
 static void kpb_buffer_samples(const struct audio_stream __sparse_cache *source,
 			       int offset, void *sink, size_t size,
 			       size_t sample_width);
@@ -501,7 +501,27 @@ static size_t kpb_allocate_history_buffer(struct comp_data *kpb,
 	kpb->hd.c_hb->prev = kpb->hd.c_hb;
 	hb = kpb->hd.c_hb;
 
-	/* Allocate history buffer/s. KPB history buffer has a size of
+	/* Prefer a single block from any of the memory pools. The history
+	 * buffer is then one contiguous ring which is buffered and drained
+	 * with at most two copies per request.
+	 */
+	for (i = 0; i < ARRAY_SIZE(hb_mcp); i++) {
+		new_mem_block = rballoc(0, hb_mcp[i], hb_size);
+		if (new_mem_block) {
+			comp_cl_info(&comp_kpb, "kpb_allocate_history_buffer(): contiguous ring of %d bytes",
+				     hb_size);
+			hb->start_addr = new_mem_block;
+			hb->end_addr = (char *)new_mem_block + hb_size;
+			hb->w_ptr = new_mem_block;
+			hb->r_ptr = new_mem_block;
+			hb->state = KPB_BUFFER_FREE;
+			return hb_size;
+		}
+	}
+
+	i = 0;
+
+	/* Otherwise allocate history buffer/s. KPB history buffer has a size of
 	 * KPB_MAX_BUFFER_SIZE, since there is no single memory block
 	 * that big, we need to allocate couple smaller blocks which
 	 * linked together will form history buffer.
@@ -1451,11 +1471,12 @@ static enum task_state kpb_draining_task(void *arg)
 	size_t sample_width = draining_data->sample_width;
 	size_t size_to_read;
 	size_t size_to_copy;
-	bool move_buffer = false;
+	size_t offset;
 	uint32_t drained = 0;
 	uint64_t draining_time_start;
 	uint64_t draining_time_end;
 	uint64_t draining_time_ms;
+	uint64_t draining_time_us;
 	uint64_t drain_interval = draining_data->drain_interval;
 	uint64_t next_copy_time = 0;
 	uint64_t current_time;
@@ -1499,38 +1520,42 @@ static enum task_state kpb_draining_task(void *arg)
 			period_copy_start = sof_cycle_get_64();
 		}
 
-		size_to_read = (uintptr_t)buff->end_addr - (uintptr_t)buff->r_ptr;
-
-		if (size_to_read > audio_stream_get_free_bytes(&sink->stream)) {
-			if (audio_stream_get_free_bytes(&sink->stream) >= drain_req)
-				size_to_copy = drain_req;
-			else
-				size_to_copy = audio_stream_get_free_bytes(&sink->stream);
-		} else {
-			if (size_to_read > drain_req) {
-				size_to_copy = drain_req;
-			} else {
-				size_to_copy = size_to_read;
-				move_buffer = true;
+		/* Fill the sink as much as possible, in synchronized mode
+		 * up to the end of the current host period. When the copy
+		 * lags behind the host the next period starts right away.
+		 */
+		size_to_copy = MIN(drain_req, audio_stream_get_free_bytes(&sink->stream));
+		if (sync_mode_on) {
+			if (period_bytes >= period_bytes_limit) {
+				period_bytes = 0;
+				period_copy_start = sof_cycle_get_64();
 			}
+			size_to_copy = MIN(size_to_copy, period_bytes_limit - period_bytes);
 		}
 
-		kpb_drain_samples(buff->r_ptr, &sink->stream, size_to_copy,
-				  sample_width);
+		/* Copy in parts split by the end of the ring or of the history
+		 * buffer segments.
+		 */
+		for (offset = 0; offset < size_to_copy; offset += size_to_read) {
+			size_to_read = (uintptr_t)buff->end_addr - (uintptr_t)buff->r_ptr;
+			size_to_read = MIN(size_to_read, size_to_copy - offset);
+
+			kpb_drain_samples(buff->r_ptr, &sink->stream, offset,
+					  size_to_read, sample_width);
+
+			buff->r_ptr = (char *)buff->r_ptr + (uint32_t)size_to_read;
+			if (buff->r_ptr == buff->end_addr) {
+				buff->r_ptr = buff->start_addr;
+				buff = buff->next;
+			}
+		}
 
-		buff->r_ptr = (char *)buff->r_ptr + (uint32_t)size_to_copy;
 		drain_req -= size_to_copy;
 		drained += size_to_copy;
 		period_bytes += size_to_copy;
 		kpb->hd.free += MIN(kpb->hd.buffer_size -
 				    kpb->hd.free, size_to_copy);
 
-		if (move_buffer) {
-			buff->r_ptr = buff->start_addr;
-			buff = buff->next;
-			move_buffer = false;
-		}
-
 		if (size_to_copy) {
 			comp_update_buffer_produce(sink, size_to_copy);
 			comp_copy(sink->sink);
@@ -1591,6 +1616,11 @@ out:
 		comp_cl_info(&comp_kpb, "KPB: kpb_draining_task(), done. %u drained in > %u ms",
 			     drained, UINT_MAX);
 
+	/* Throughput in bytes per millisecond, the draining time is short */
+	draining_time_us = k_cyc_to_us_near64(draining_time_end - draining_time_start);
+	comp_cl_info(&comp_kpb, "KPB: kpb_draining_task(), throughput %u bytes/ms",
+		     (unsigned int)((uint64_t)drained * 1000 / MAX(draining_time_us, 1)));
+
 	return SOF_TASK_STATE_COMPLETED;
 }
 
@@ -1642,6 +1672,10 @@ static void kpb_convert_24b_to_32b(const void *linear_source, int ioffset,
 	}
 }
 #else
+/* The packed 24 bit samples are converted four at a time from three 32 bit
+ * words. The first samples are converted one at a time until the packed
+ * data is word aligned.
+ */
 static void kpb_convert_24b_to_32b(const void *source, int ioffset,
 				   struct audio_stream __sparse_cache *sink,
 				   int ooffset, unsigned int samples)
@@ -1649,6 +1683,8 @@ static void kpb_convert_24b_to_32b(const void *source, int ioffset,
 	int ssize = audio_stream_sample_bytes(sink);
 	uint8_t *src = (uint8_t *)source + ioffset * 3;
 	int32_t *dst = audio_stream_wrap(sink, (uint8_t *)sink->w_ptr + ooffset * ssize);
+	const uint32_t *src32;
+	uint32_t w0, w1, w2;
 	int processed;
 	int nmax, i, n;
 
@@ -1657,7 +1693,27 @@ static void kpb_convert_24b_to_32b(const void *source, int ioffset,
 		n = samples - processed;
 		nmax = KPB_BYTES_TO_S32_SAMPLES(audio_stream_bytes_without_wrap(sink, dst));
 		n = MIN(n, nmax);
-		for (i = 0; i < n; i += 1) {
+		for (i = 0; i < n && !IS_ALIGNED((uintptr_t)src, 4); i++) {
+			*dst = (src[2] << 16) | (src[1] << 8) | src[0];
+			dst++;
+			src += 3;
+		}
+
+		src32 = (const uint32_t *)src;
+		for (; i < n - 3; i += 4) {
+			w0 = src32[0];
+			w1 = src32[1];
+			w2 = src32[2];
+			dst[0] = w0 & 0xFFFFFF;
+			dst[1] = (w0 >> 24) | ((w1 & 0xFFFF) << 8);
+			dst[2] = (w1 >> 16) | ((w2 & 0xFF) << 16);
+			dst[3] = w2 >> 8;
+			dst += 4;
+			src32 += 3;
+		}
+
+		src = (uint8_t *)src32;
+		for (; i < n; i++) {
 			*dst = (src[2] << 16) | (src[1] << 8) | src[0];
 			dst++;
 			src += 3;
@@ -1668,32 +1724,37 @@ static void kpb_convert_24b_to_32b(const void *source, int ioffset,
 /**
  * \brief Drain data samples safe, according to configuration.
  *
- * \param[in] sink - pointer to sink buffer.
  * \param[in] source - pointer to source buffer.
+ * \param[in] sink - pointer to sink buffer.
+ * \param[in] offset - start offset of sink buffer in bytes.
  * \param[in] size - requested copy size in bytes.
  *
  * \return none.
  */
 static void kpb_drain_samples(void *source, struct audio_stream __sparse_cache *sink,
-			      size_t size, size_t sample_width)
+			      int offset, size_t size, size_t sample_width)
 {
 	unsigned int samples;
+	int samples_offset;
 
 	switch (sample_width) {
 #if CONFIG_FORMAT_S16LE
 	case 16:
 		samples = KPB_BYTES_TO_S16_SAMPLES(size);
-		audio_stream_copy_from_linear(source, 0, sink, 0, samples);
+		samples_offset = KPB_BYTES_TO_S16_SAMPLES(offset);
+		audio_stream_copy_from_linear(source, 0, sink, samples_offset, samples);
 		break;
 #endif /* CONFIG_FORMAT_S16LE */
 #if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
 	case 24:
 		samples = size / ((sample_width >> 3) * sink->channels);
-		kpb_convert_24b_to_32b(source, 0, sink, 0, samples);
+		samples_offset = KPB_BYTES_TO_S32_SAMPLES(offset);
+		kpb_convert_24b_to_32b(source, 0, sink, samples_offset, samples);
 		break;
 	case 32:
 		samples = KPB_BYTES_TO_S32_SAMPLES(size);
-		audio_stream_copy_from_linear(source, 0, sink, 0, samples);
+		samples_offset = KPB_BYTES_TO_S32_SAMPLES(offset);
+		audio_stream_copy_from_linear(source, 0, sink, samples_offset, samples);
 		break;
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 	default:
@@ -1740,12 +1801,16 @@ static void kpb_convert_32b_to_24b(const struct audio_stream __sparse_cache *sou
 	}
 }
 #else
+/* The samples are packed four at a time to three 32 bit words. The first
+ * samples are packed one at a time until the packed data is word aligned.
+ */
 static void kpb_convert_32b_to_24b(const struct audio_stream __sparse_cache *source, int ioffset,
 				   void *sink, int ooffset, unsigned int samples)
 {
 	int ssize = audio_stream_sample_bytes(source);
-	int32_t *src = audio_stream_wrap(source, (uint8_t *)source->r_ptr + ioffset * ssize);
+	uint32_t *src = audio_stream_wrap(source, (uint8_t *)source->r_ptr + ioffset * ssize);
 	uint8_t *dst = (uint8_t *)sink + ooffset * 3;
+	uint32_t *dst32;
 	int processed;
 	int nmax, i, n;
 
@@ -1754,7 +1819,25 @@ static void kpb_convert_32b_to_24b(const struct audio_stream __sparse_cache *sou
 		n = samples - processed;
 		nmax = KPB_BYTES_TO_S32_SAMPLES(audio_stream_bytes_without_wrap(source, src));
 		n = MIN(n, nmax);
-		for (i = 0; i < n; i += 1) {
+		for (i = 0; i < n && !IS_ALIGNED((uintptr_t)dst, 4); i++) {
+			dst[0] = *src & 0xFF;
+			dst[1] = (*src >> 8) & 0xFF;
+			dst[2] = (*src >> 16) & 0xFF;
+			dst += 3;
+			src++;
+		}
+
+		dst32 = (uint32_t *)dst;
+		for (; i < n - 3; i += 4) {
+			dst32[0] = (src[0] & 0xFFFFFF) | (src[1] << 24);
+			dst32[1] = ((src[1] >> 8) & 0xFFFF) | (src[2] << 16);
+			dst32[2] = ((src[2] >> 16) & 0xFF) | (src[3] << 8);
+			dst32 += 3;
+			src += 4;
+		}
+
+		dst = (uint8_t *)dst32;
+		for (; i < n; i++) {
 			dst[0] = *src & 0xFF;
 			dst[1] = (*src >> 8) & 0xFF;
 			dst[2] = (*src >> 16) & 0xFF;
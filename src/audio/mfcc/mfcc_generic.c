@@ -134,88 +134,36 @@ static void mfcc_source_copy_s16(struct input_stream_buffer *bsource, struct mfc
 	buf->w_ptr = w;
 }
 
-static void mfcc_fill_prev_samples(struct mfcc_buffer *buf, int16_t *prev_data,
-				   int prev_data_length)
-{
-	/* Fill prev_data from input buffer */
-	int16_t *r = buf->r_ptr;
-	int16_t *p = prev_data;
-	int copied;
-	int nmax;
-	int n;
-
-	for (copied = 0; copied < prev_data_length; copied += n) {
-		nmax = prev_data_length - copied;
-		n = mfcc_buffer_samples_without_wrap(buf, r);
-		n = MIN(n, nmax);
-		memcpy(p, r, sizeof(int16_t) * n); /* Not using memcpy_s() due to speed need */
-		p += n;
-		r += n;
-		r = mfcc_buffer_wrap(buf, r);
-	}
-
-	buf->s_avail -= copied;
-	buf->s_free += copied;
-	buf->r_ptr = r;
-}
-
-static void mfcc_fill_fft_buffer(struct mfcc_state *state)
+#ifdef MFCC_NORMALIZE_FFT
+/* Find block scale left shift for the frame of fft_size samples from the
+ * read position of the input buffer.
+ */
+static int mfcc_normalize_fft_buffer(struct mfcc_state *state)
 {
 	struct mfcc_buffer *buf = &state->buf;
 	struct mfcc_fft *fft = &state->fft;
 	int16_t *r = buf->r_ptr;
-	int copied;
+	int32_t absx;
+	int32_t smax = 0;
+	int32_t x;
+	int checked;
 	int nmax;
-	int idx = fft->fft_fill_start_idx;
+	int shift;
 	int j;
 	int n;
 
-	/* Copy overlapped samples from state buffer. Imaginary part of input
-	 * remains zero.
-	 */
-	for (j = 0; j < state->prev_data_size; j++)
-		fft->fft_buf[idx + j].real = state->prev_data[j];
-
-	/* Copy hop size of new data from circular buffer */
-	idx += state->prev_data_size;
-	for (copied = 0; copied < fft->fft_hop_size; copied += n) {
-		nmax = fft->fft_hop_size - copied;
+	for (checked = 0; checked < fft->fft_size; checked += n) {
+		nmax = fft->fft_size - checked;
 		n = mfcc_buffer_samples_without_wrap(buf, r);
 		n = MIN(n, nmax);
 		for (j = 0; j < n; j++) {
-			fft->fft_buf[idx].real = *r;
-			r++;
-			idx++;
+			x = r[j];
+			absx = (x < 0) ? -x : x;
+			if (smax < absx)
+				smax = absx;
 		}
-		r = mfcc_buffer_wrap(buf, r);
-	}
-
-	buf->s_avail -= copied;
-	buf->s_free += copied;
-	buf->r_ptr = r;
 
-	/* Copy for next time data back to overlap buffer */
-	idx = fft->fft_fill_start_idx + fft->fft_hop_size;
-	for (j = 0; j < state->prev_data_size; j++)
-		state->prev_data[j] = fft->fft_buf[idx + j].real;
-}
-
-#ifdef MFCC_NORMALIZE_FFT
-static int mfcc_normalize_fft_buffer(struct mfcc_state *state)
-{
-	struct mfcc_fft *fft = &state->fft;
-	int32_t absx;
-	int32_t smax = 0;
-	int32_t x;
-	int shift;
-	int j;
-	int i = fft->fft_fill_start_idx;
-
-	for (j = 0; j < fft->fft_size; j++) {
-		x = fft->fft_buf[i + j].real;
-		absx = (x < 0) ? -x : x;
-		if (smax < absx)
-			smax = absx;
+		r = mfcc_buffer_wrap(buf, r + n);
 	}
 
 	shift = norm_int32(smax << 15) - 1; /* 16 bit data */
@@ -225,28 +173,58 @@ static int mfcc_normalize_fft_buffer(struct mfcc_state *state)
 }
 #endif
 
-static void mfcc_apply_window(struct mfcc_state *state, int input_shift)
+/* Copy the frame of fft_size samples from input buffer to the real FFT input
+ * with the window function and the normalize shift applied in the same pass.
+ * The frames overlap, so only the hop size of samples is removed from the
+ * input buffer.
+ */
+static void mfcc_fill_fft_buffer(struct mfcc_state *state, int input_shift)
 {
+	struct mfcc_buffer *buf = &state->buf;
 	struct mfcc_fft *fft = &state->fft;
+	int16_t *r = buf->r_ptr;
+	int16_t *win = state->window;
+	int idx = fft->fft_fill_start_idx;
+	int copied;
+	int nmax;
 	int j;
-	int i = fft->fft_fill_start_idx;
-
+	int n;
 #if MFCC_FFT_BITS == 16
 	/* TODO: Use proper multiply and saturate function to make sure no overflows */
-	int32_t x;
+	int16_t *x = &fft->fft_buf[idx];
+	int32_t p;
 	int s = 14 - input_shift; /* Q1.15 x Q1.15 -> Q30 -> Q15, shift by 15 - 1 for round */
-
-	for (j = 0; j < fft->fft_size; j++) {
-		x = (int32_t)fft->fft_buf[i + j].real * state->window[j];
-		fft->fft_buf[i + j].real = ((x >> s) + 1) >> 1;
-	}
 #else
 	/* TODO: Use proper multiply and saturate function to make sure no overflows */
+	int32_t *x = &fft->fft_buf[idx];
 	int s = input_shift + 1; /* To convert 16 -> 32 with Q1.15 x Q1.15 -> Q30 -> Q31 */
+#endif
 
-	for (j = 0; j < fft->fft_size; j++)
-		fft->fft_buf[i + j].real = (fft->fft_buf[i + j].real * state->window[j]) << s;
+	for (copied = 0; copied < fft->fft_size; copied += n) {
+		nmax = fft->fft_size - copied;
+		n = mfcc_buffer_samples_without_wrap(buf, r);
+		n = MIN(n, nmax);
+		for (j = 0; j < n; j++) {
+#if MFCC_FFT_BITS == 16
+			p = (int32_t)r[j] * win[j];
+			x[j] = ((p >> s) + 1) >> 1;
+#else
+			x[j] = ((int32_t)r[j] * win[j]) << s;
 #endif
+		}
+
+		r = mfcc_buffer_wrap(buf, r + n);
+		win += n;
+		x += n;
+	}
+
+	/* Clear the padding since the buffer has been used as scratch */
+	bzero(fft->fft_buf, idx * sizeof(fft->fft_buf[0]));
+	bzero(x, (fft->fft_padded_size - fft->fft_size - idx) * sizeof(fft->fft_buf[0]));
+
+	buf->r_ptr = mfcc_buffer_wrap(buf, buf->r_ptr + fft->fft_hop_size);
+	buf->s_avail -= fft->fft_hop_size;
+	buf->s_free += fft->fft_hop_size;
 }
 
 /*
@@ -278,23 +256,11 @@ static int mfcc_stft_process(const struct comp_dev *dev, struct mfcc_state *stat
 		state->waiting_fill = false;
 	}
 
-	/* Phase 2, move first prev_size data to previous data buffer, remove
-	 * samples from input buffer.
+	/* Check if enough samples in buffer for FFT hop, the overlap with the
+	 * previous frame remains in the buffer.
 	 */
-	if (!state->prev_samples_valid) {
-		mfcc_fill_prev_samples(buf, state->prev_data, state->prev_data_size);
-		state->prev_samples_valid = true;
-	}
-
-	/* Check if enough samples in buffer for FFT hop */
-	m = buf->s_avail / fft->fft_hop_size;
+	m = (buf->s_avail - state->prev_data_size) / fft->fft_hop_size;
 	for (i = 0; i < m; i++) {
-		/* Clear FFT input buffer because it has been used as scratch */
-		bzero(fft->fft_buf, fft->fft_buffer_size);
-
-		/* Copy data to FFT input buffer from overlap buffer and from new samples buffer */
-		mfcc_fill_fft_buffer(state);
-
 		/* TODO: remove_dc_offset */
 
 		/* TODO: use_energy & raw_energy */
@@ -306,26 +272,21 @@ static int mfcc_stft_process(const struct comp_dev *dev, struct mfcc_state *stat
 		input_shift = 0;
 #endif
 
-		/* Window function */
-		mfcc_apply_window(state, input_shift);
+		/* Copy windowed frame to FFT input buffer */
+		mfcc_fill_fft_buffer(state, input_shift);
 
 		/* TODO: use_energy & !raw_energy */
 
 #ifdef DEBUGFILES
 		for (j = 0; j < fft->fft_padded_size; j++)
-			fprintf(fh_fft_in, "%d %d\n", fft->fft_buf[j].real, fft->fft_buf[j].imag);
+			fprintf(fh_fft_in, "%d %d\n", fft->fft_buf[j], 0);
 #endif
 
-		/* The FFT out buffer needs to be cleared to avoid to corrupt
-		 * the output. TODO: check moving it to FFT lib.
-		 */
-		bzero(fft->fft_out, fft->fft_buffer_size);
-
-		/* Compute FFT */
+		/* Compute real input FFT */
 #if MFCC_FFT_BITS == 16
-		fft_execute_16(fft->fft_plan, false);
+		fft_execute_real_16(fft->fft_plan, false);
 #else
-		fft_execute_32(fft->fft_plan, false);
+		fft_execute_real_32(fft->fft_plan, false);
 #endif
 
 #ifdef DEBUGFILES_READ_FFT
@@ -374,9 +335,9 @@ static int mfcc_stft_process(const struct comp_dev *dev, struct mfcc_state *stat
 		}
 #endif
 
-		/* Multiply Mel spectra with DCT matrix to get cepstral coefficients */
+		/* DCT of Mel spectra to get cepstral coefficients */
 		mat_init_16b(state->cepstral_coef, 1, state->dct.num_out, 7); /* Q8.7 */
-		mat_multiply(state->mel_spectra, state->dct.matrix, state->cepstral_coef);
+		dct_execute_16(&state->dct, state->mel_spectra->data, state->cepstral_coef->data);
 
 		/* Apply cepstral lifter */
 		if (state->lifter.cepstral_lifter != 0)
@@ -40,7 +40,7 @@ static void mfcc_init_debug_open(void)
 {
 	fh_window = fopen("fft_win.txt", "w");
 	fh_triangles = fopen("mel_triangles.txt", "w");
-	fh_dct = fopen("dct_matrix.txt", "w");
+	fh_dct = fopen("dct_table.txt", "w");
 	fh_lifter = fopen("lifter.txt", "w");
 }
 
@@ -195,13 +195,14 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 		  config->preemphasis_coefficient,
 		  fft->fft_size, fft->fft_padded_size, fft->fft_hop_size);
 
-	/* Calculated parameters */
+	/* Calculated parameters. The overlap of frames is kept in the input
+	 * buffer, the frames are windowed from it directly to FFT input.
+	 */
 	state->prev_data_size = fft->fft_size - fft->fft_hop_size;
 	state->buffer_size = fft->fft_size + max_frames;
 
-	/* Allocate buffer input samples and overlap buffer */
-	state->sample_buffers_size = sizeof(int16_t) *
-		(state->buffer_size + state->prev_data_size + fft->fft_size);
+	/* Allocate buffer for input samples and window */
+	state->sample_buffers_size = sizeof(int16_t) * (state->buffer_size + fft->fft_size);
 
 	comp_info(dev, "mfcc_setup(), buffer_size = %d, prev_size = %d",
 		  state->buffer_size, state->prev_data_size);
@@ -215,10 +216,12 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 	}
 
 	mfcc_init_buffer(&state->buf, state->buffers, state->buffer_size);
-	state->prev_data = state->buffers + state->buffer_size;
-	state->window = state->prev_data + state->prev_data_size;
+	state->window = state->buffers + state->buffer_size;
 
-	/* Allocate buffers for FFT input and output data */
+	/* Allocate buffers for FFT input and output data. The real FFT input needs
+	 * only half of the size but the buffer is used as scratch for the power
+	 * spectra.
+	 */
 #if MFCC_FFT_BITS == 16
 	fft->fft_buffer_size = fft->fft_padded_size * sizeof(struct icomplex16);
 #else
@@ -240,9 +243,9 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 
 	fft->fft_fill_start_idx = 0; /* From config pad_type */
 
-	/* Setup FFT */
-	fft->fft_plan = fft_plan_new(fft->fft_buf, fft->fft_out, fft->fft_padded_size,
-				     MFCC_FFT_BITS);
+	/* Setup real input FFT */
+	fft->fft_plan = fft_plan_new_real(fft->fft_buf, fft->fft_out, fft->fft_padded_size,
+					  MFCC_FFT_BITS);
 	if (!fft->fft_plan) {
 		comp_err(dev, "mfcc_setup(): Failed FFT init");
 		ret = -EINVAL;
@@ -288,7 +291,7 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 	dct->num_out = config->num_ceps;
 	dct->type = (enum dct_type)config->dct;
 	dct->ortho = true;
-	ret = dct_initialize_16(dct);
+	ret = dct_initialize_table_16(dct);
 	if (ret < 0) {
 		comp_err(dev, "mfcc_setup(): Failed DCT init");
 		goto free_melfb_data;
@@ -299,13 +302,13 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 	ret = mfcc_get_cepstral_lifter(&state->lifter);
 	if (ret < 0) {
 		comp_err(dev, "mfcc_setup(): Failed cepstral lifter");
-		goto free_dct_matrix;
+		goto free_dct_table;
 	}
 
 	/* Scratch overlay during runtime
 	 *
 	 *  +--------------------------------------------------------+
-	 *  | 1. fft_buf[], 16 bits,size x 4, e.g. 512 -> 2048 bytes |
+	 *  | 1. fft_buf[], e.g. 2048 bytes, 16 bits real input x512 |
 	 *  +-------------------------------------+------------------+
 	 *  | 3. power_spectra[],                 |
 	 *  |    32 bits, e.g. x257 -> 1028 bytes |
@@ -338,12 +341,9 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 	for (i = 0; i < fb->data_length; i++)
 		fprintf(fh_triangles, "%d\n", fb->data[i]);
 
-	for (i = 0; i < dct->num_in; i++) {
-		for (j = 0; j < dct->num_out; j++)
-			fprintf(fh_dct, " %d", mat_get_scalar_16b(dct->matrix, i, j));
-
-		fprintf(fh_dct, "\n");
-	}
+	fprintf(fh_dct, "%d\n", dct->dc_coef);
+	for (i = 0; i < 4 * dct->num_in; i++)
+		fprintf(fh_dct, "%d\n", dct->cos_table[i]);
 
 	for (j = 0; j < dct->num_out; j++)
 		fprintf(fh_lifter, "%d\n", mat_get_scalar_16b(state->lifter.matrix, 0, j));
@@ -353,13 +353,12 @@ int mfcc_setup(struct processing_module *mod, int max_frames, int sample_rate, i
 
 	/* Set initial state for STFT */
 	state->waiting_fill = true;
-	state->prev_samples_valid = false;
 
 	comp_dbg(dev, "mfcc_setup(), done");
 	return 0;
 
-free_dct_matrix:
-	rfree(state->dct.matrix);
+free_dct_table:
+	rfree(state->dct.cos_table);
 
 free_melfb_data:
 	rfree(fb->data);
@@ -384,7 +383,7 @@ void mfcc_free_buffers(struct mfcc_comp_data *cd)
 	rfree(cd->state.fft.fft_out);
 	rfree(cd->state.buffers);
 	rfree(cd->state.melfb.data);
-	rfree(cd->state.dct.matrix);
+	rfree(cd->state.dct.cos_table);
 	rfree(cd->state.lifter.matrix);
 
 #ifdef MFCC_DEBUGFILES
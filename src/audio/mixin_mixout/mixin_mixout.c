@@ -77,6 +77,7 @@ struct mixin_data {
 	normal_mix_func normal_mix_channel;
 	remap_mix_func remap_mix_channel;
 	mute_func mute_channel;
+	remap_frames_func remap_frames;
 	struct mixin_sink_config sink_config[MIXIN_MAX_SINKS];
 };
 
@@ -212,21 +213,34 @@ static int mix_and_remap(struct comp_dev *dev, const struct mixin_data *mixin_da
 			uint8_t source_channel =
 				(sink_config->output_channel_map >> (i * 4)) & 0xf;
 
-			if (source_channel == 0xf) {
+			if (source_channel != 0xf && source_channel >= source->channels) {
+				comp_err(dev, "Out of range chmap: 0x%x, src channels: %u",
+					 sink_config->output_channel_map,
+					 source->channels);
+				return -EINVAL;
+			}
+		}
+
+		/* all sink channels in one pass over the frames when available */
+		if (mixin_data->remap_frames) {
+			mixin_data->remap_frames(sink, start_frame, mixed_frames, source,
+						 frame_count, sink_config->output_channel_map,
+						 sink_config->gain);
+			return 0;
+		}
+
+		for (i = 0; i < sink->channels; i++) {
+			uint8_t source_channel =
+				(sink_config->output_channel_map >> (i * 4)) & 0xf;
+
+			if (source_channel == 0xf)
 				mixin_data->mute_channel(sink, i, start_frame, mixed_frames,
 							 frame_count);
-			} else {
-				if (source_channel >= source->channels) {
-					comp_err(dev, "Out of range chmap: 0x%x, src channels: %u",
-						 sink_config->output_channel_map,
-						 source->channels);
-					return -EINVAL;
-				}
+			else
 				mixin_data->remap_mix_channel(sink, i, sink->channels, start_frame,
 							mixed_frames, source, source_channel,
 							source->channels, frame_count,
 							sink_config->gain);
-			}
 		}
 	} else {
 		comp_err(dev, "Unexpected mixer mode: %d", sink_config->mixer_mode);
@@ -569,6 +583,7 @@ static int mixin_reset(struct processing_module *mod)
 	mixin_data->normal_mix_channel = NULL;
 	mixin_data->remap_mix_channel = NULL;
 	mixin_data->mute_channel = NULL;
+	mixin_data->remap_frames = NULL;
 
 	return 0;
 }
@@ -703,13 +718,15 @@ static int mixin_prepare(struct processing_module *mod)
 		md->normal_mix_channel = normal_mix_get_processing_function(fmt);
 		md->remap_mix_channel = remap_mix_get_processing_function(fmt);
 		md->mute_channel = mute_mix_get_processing_function(fmt);
+		md->remap_frames = remap_frames_get_processing_function(fmt);
 		break;
 	default:
 		comp_err(dev, "unsupported data format %d", fmt);
 		return -EINVAL;
 	}
 
-	if (!md->normal_mix_channel || !md->remap_mix_channel || !md->mute_channel) {
+	if (!md->normal_mix_channel ||
+	    (!md->remap_frames && (!md->remap_mix_channel || !md->mute_channel))) {
 		comp_err(dev, "have not found the suitable processing function");
 		return -EINVAL;
 	}
@@ -56,6 +56,8 @@ static void normal_mix_channel_s16(struct audio_stream __sparse_cache *sink, int
 		nmax = audio_stream_samples_without_wrap_s16(sink, dst);
 		n = MIN(n, nmax);
 		memcpy_s(dst, n * sizeof(int16_t), src, n * sizeof(int16_t));
+		dst += n;
+		src += n;
 	}
 }
 
@@ -68,7 +70,7 @@ static void remap_mix_channel_s16(struct audio_stream __sparse_cache *sink,
 {
 	int16_t *dst, *src;
 	int32_t frames_to_mix, frames_to_copy, left_frames;
-	int32_t n, nmax, frames, i, samples;
+	int32_t nmax, frames, i;
 
 	/* audio_stream_wrap() is required and is done below in a loop */
 	dst = (int16_t *)sink->w_ptr + start_frame * sink_channel_count + sink_channel_index;
@@ -82,37 +84,31 @@ static void remap_mix_channel_s16(struct audio_stream __sparse_cache *sink,
 	for (left_frames = frames_to_mix; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
-		/* calculate the remaining samples*/
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s16(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s16(sink, dst);
-		n = MIN(n, nmax);
-		/* frames is the processed frame count in this loop*/
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = sat_int16((int32_t)*dst +
 			       q_mults_16x16(*src, gain, IPC4_MIXIN_GAIN_SHIFT));
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 
 	for (left_frames = frames_to_copy; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s16(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s16(sink, dst);
-		n = MIN(n, nmax);
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = (int16_t)q_mults_16x16(*src, gain, IPC4_MIXIN_GAIN_SHIFT);
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 }
@@ -193,6 +189,8 @@ static void normal_mix_channel_s24(struct audio_stream __sparse_cache *sink, int
 		nmax = audio_stream_samples_without_wrap_s24(sink, dst);
 		n = MIN(n, nmax);
 		memcpy_s(dst, n * sizeof(int32_t), src, n * sizeof(int32_t));
+		dst += n;
+		src += n;
 	}
 }
 
@@ -205,7 +203,7 @@ static void remap_mix_channel_s24(struct audio_stream __sparse_cache *sink,
 {
 	int32_t *dst, *src;
 	int32_t frames_to_mix, frames_to_copy, left_frames;
-	int32_t n, nmax, i, frames, samples;
+	int32_t nmax, i, frames;
 
 	/* audio_stream_wrap() is required and is done below in a loop */
 	dst = (int32_t *)sink->w_ptr + start_frame * sink_channel_count + sink_channel_index;
@@ -219,39 +217,33 @@ static void remap_mix_channel_s24(struct audio_stream __sparse_cache *sink,
 	for (left_frames = frames_to_mix; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
-		/* calculate the remaining samples*/
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s24(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s24(sink, dst);
-		n = MIN(n, nmax);
-		/* frames is the processed frame count in this loop*/
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = sat_int24(sign_extend_s24(*dst) +
 					  (int32_t)q_mults_32x32(sign_extend_s24(*src),
 					  gain, IPC4_MIXIN_GAIN_SHIFT));
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 
 	for (left_frames = frames_to_copy; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s24(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s24(sink, dst);
-		n = MIN(n, nmax);
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = (int32_t)q_mults_32x32(sign_extend_s24(*src),
 							   gain, IPC4_MIXIN_GAIN_SHIFT);
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 }
@@ -302,6 +294,8 @@ static void normal_mix_channel_s32(struct audio_stream __sparse_cache *sink, int
 		nmax = audio_stream_samples_without_wrap_s32(sink, dst);
 		n = MIN(n, nmax);
 		memcpy_s(dst, n * sizeof(int32_t), src, n * sizeof(int32_t));
+		dst += n;
+		src += n;
 	}
 }
 
@@ -313,7 +307,7 @@ static void remap_mix_channel_s32(struct audio_stream __sparse_cache *sink,
 				  int32_t frame_count, uint16_t gain)
 {
 	int32_t frames_to_mix, frames_to_copy, left_frames;
-	int32_t n, nmax, frames, i, samples;
+	int32_t nmax, frames, i;
 	int32_t *dst, *src;
 
 	/* audio_stream_wrap() is required and is done below in a loop */
@@ -328,37 +322,31 @@ static void remap_mix_channel_s32(struct audio_stream __sparse_cache *sink,
 	for (left_frames = frames_to_mix; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
-		/* calculate the remaining samples*/
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s32(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s32(sink, dst);
-		n = MIN(n, nmax);
-		/* frames is the processed frame count in this loop*/
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = sat_int32((int64_t)*dst +
 					  q_mults_32x32(*src, gain, IPC4_MIXIN_GAIN_SHIFT));
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 
 	for (left_frames = frames_to_copy; left_frames > 0; left_frames -= frames) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
+		/* the frames of this channel before either buffer wraps */
 		nmax = audio_stream_samples_without_wrap_s32(source, src);
-		samples = left_frames * source_channel_count;
-		n = MIN(samples, nmax);
+		frames = MIN(left_frames, SOF_DIV_ROUND_UP(nmax, source_channel_count));
 		nmax = audio_stream_samples_without_wrap_s32(sink, dst);
-		n = MIN(n, nmax);
-		frames = 0;
-		for (i = 0; i < n; i += source_channel_count) {
+		frames = MIN(frames, SOF_DIV_ROUND_UP(nmax, sink_channel_count));
+		for (i = 0; i < frames; i++) {
 			*dst = (int32_t)q_mults_32x32(*src, gain, IPC4_MIXIN_GAIN_SHIFT);
 			src += source_channel_count;
 			dst += sink_channel_count;
-			frames++;
 		}
 	}
 }
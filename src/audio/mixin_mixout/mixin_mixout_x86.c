@@ -0,0 +1,525 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <ipc4/mixin_mixout.h>
+#include <sof/common.h>
+#include <rtos/string.h>
+
+#ifdef MIXIN_MIXOUT_X86
+
+#include <immintrin.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * AVX2 version for x86 host builds
+ *
+ * The streams are processed in blocks that end at the next buffer wrap of
+ * either the source or the sink, so the inner loops run on plain pointers.
+ * Normal mode mixes whole vectors with saturating adds. Remap mode handles
+ * all sink channels of a frame in one pass: the source frame is loaded to
+ * 32 bit lanes, permuted to the sink channel order, scaled by the gain and
+ * stored with the sink channel mask. Muted channels are left as they are
+ * where the sink has been mixed and cleared elsewhere, as mute_channel_s16()
+ * and mute_channel_s32() of the generic version do.
+ *
+ * The results are the same as from the generic version for gains up to
+ * IPC4_MIXIN_UNITY_GAIN, see mixin_set_config().
+ */
+
+/* Samples per vector */
+#define MIX_X86_S16_LANES	16
+#define MIX_X86_S32_LANES	8
+
+/* Largest frame of the remap mode in bytes */
+#define MIX_X86_FRAME_BYTES	(MIX_X86_S32_LANES * sizeof(int32_t))
+
+struct mix_x86_remap {
+	__m256i index;		/* source channel of each sink channel lane */
+	__m256i mute;		/* all ones in lanes of muted sink channels */
+	__m256i sink_mask;	/* all ones in lanes of sink channels */
+	__m256i mix_mask;	/* sink channel lanes that are not muted */
+	__m256i source_mask;	/* all ones in lanes of source channels */
+	__m256i gain;
+	bool unity;
+	int sink_channels;
+	int source_channels;
+};
+
+typedef void (*mix_x86_normal_block)(void *dst, const void *src, int32_t n);
+
+typedef void (*mix_x86_remap_block)(void *dst, const void *src, int32_t n, bool mix,
+				    const struct mix_x86_remap *r);
+
+/* Saturating adds for the lanes of 24 and 32 bit samples */
+static inline __m256i mix_x86_sat_s24(__m256i a, __m256i b)
+{
+	a = _mm256_srai_epi32(_mm256_slli_epi32(a, 8), 8);
+	b = _mm256_srai_epi32(_mm256_slli_epi32(b, 8), 8);
+	a = _mm256_add_epi32(a, b);
+	a = _mm256_max_epi32(a, _mm256_set1_epi32(INT24_MINVALUE));
+	return _mm256_min_epi32(a, _mm256_set1_epi32(INT24_MAXVALUE));
+}
+
+static inline __m256i mix_x86_sat_s32(__m256i a, __m256i b)
+{
+	__m256i sum = _mm256_add_epi32(a, b);
+	__m256i sat = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(INT32_MAX));
+	__m256i ovf = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, sum));
+
+	/* overflow when the operands have the same sign and the sum has not */
+	return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(sum),
+						    _mm256_castsi256_ps(sat),
+						    _mm256_castsi256_ps(ovf)));
+}
+
+#if CONFIG_FORMAT_S16LE
+static void mix_x86_normal_block_s16(void *dst, const void *src, int32_t n)
+{
+	const int16_t *s = src;
+	int16_t *d = dst;
+	__m256i x;
+	__m256i y;
+	int32_t i;
+
+	for (i = 0; i + MIX_X86_S16_LANES <= n; i += MIX_X86_S16_LANES) {
+		x = _mm256_loadu_si256((const __m256i *)(d + i));
+		y = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_storeu_si256((__m256i *)(d + i), _mm256_adds_epi16(x, y));
+	}
+
+	for (; i < n; i++)
+		d[i] = sat_int16(d[i] + s[i]);
+}
+#endif
+
+#if CONFIG_FORMAT_S24LE
+static void mix_x86_normal_block_s24(void *dst, const void *src, int32_t n)
+{
+	const int32_t *s = src;
+	int32_t *d = dst;
+	__m256i x;
+	__m256i y;
+	int32_t i;
+
+	for (i = 0; i + MIX_X86_S32_LANES <= n; i += MIX_X86_S32_LANES) {
+		x = _mm256_loadu_si256((const __m256i *)(d + i));
+		y = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_storeu_si256((__m256i *)(d + i), mix_x86_sat_s24(x, y));
+	}
+
+	for (; i < n; i++)
+		d[i] = sat_int24(sign_extend_s24(d[i]) + sign_extend_s24(s[i]));
+}
+#endif
+
+#if CONFIG_FORMAT_S32LE
+static void mix_x86_normal_block_s32(void *dst, const void *src, int32_t n)
+{
+	const int32_t *s = src;
+	int32_t *d = dst;
+	__m256i x;
+	__m256i y;
+	int32_t i;
+
+	for (i = 0; i + MIX_X86_S32_LANES <= n; i += MIX_X86_S32_LANES) {
+		x = _mm256_loadu_si256((const __m256i *)(d + i));
+		y = _mm256_loadu_si256((const __m256i *)(s + i));
+		_mm256_storeu_si256((__m256i *)(d + i), mix_x86_sat_s32(x, y));
+	}
+
+	for (; i < n; i++)
+		d[i] = sat_int32((int64_t)d[i] + s[i]);
+}
+#endif
+
+/* Normal mode in wrap free blocks, see normal_mix_channel_s16() of the
+ * generic version for the parameters. The frames are samples here.
+ */
+static void mix_x86_normal(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+			   int32_t mixed_frames, const struct audio_stream __sparse_cache *source,
+			   int32_t frame_count, int sample_bytes, mix_x86_normal_block block)
+{
+	int32_t frames_to_mix, frames_to_copy, left_frames;
+	int32_t n, nmax;
+	uint8_t *dst = (uint8_t *)sink->w_ptr + start_frame * sample_bytes;
+	uint8_t *src = source->r_ptr;
+
+	assert(mixed_frames >= start_frame);
+	frames_to_mix = mixed_frames - start_frame;
+	frames_to_mix = MIN(frames_to_mix, frame_count);
+	frames_to_copy = frame_count - frames_to_mix;
+
+	for (left_frames = frames_to_mix; left_frames > 0; left_frames -= n) {
+		src = audio_stream_wrap(source, src);
+		dst = audio_stream_wrap(sink, dst);
+		nmax = audio_stream_bytes_without_wrap(source, src) / sample_bytes;
+		n = MIN(left_frames, nmax);
+		nmax = audio_stream_bytes_without_wrap(sink, dst) / sample_bytes;
+		n = MIN(n, nmax);
+		block(dst, src, n);
+		dst += n * sample_bytes;
+		src += n * sample_bytes;
+	}
+
+	/* nothing mixed to this part of the sink yet, e.g. with one active mixin */
+	for (left_frames = frames_to_copy; left_frames > 0; left_frames -= n) {
+		src = audio_stream_wrap(source, src);
+		dst = audio_stream_wrap(sink, dst);
+		nmax = audio_stream_bytes_without_wrap(source, src) / sample_bytes;
+		n = MIN(left_frames, nmax);
+		nmax = audio_stream_bytes_without_wrap(sink, dst) / sample_bytes;
+		n = MIN(n, nmax);
+		memcpy_s(dst, n * sample_bytes, src, n * sample_bytes);
+		dst += n * sample_bytes;
+		src += n * sample_bytes;
+	}
+}
+
+#if CONFIG_FORMAT_S16LE
+static void normal_mix_channel_s16(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+				   int32_t mixed_frames,
+				   const struct audio_stream __sparse_cache *source,
+				   int32_t frame_count, uint16_t gain)
+{
+	mix_x86_normal(sink, start_frame, mixed_frames, source, frame_count, sizeof(int16_t),
+		       mix_x86_normal_block_s16);
+}
+#endif
+
+#if CONFIG_FORMAT_S24LE
+static void normal_mix_channel_s24(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+				   int32_t mixed_frames,
+				   const struct audio_stream __sparse_cache *source,
+				   int32_t frame_count, uint16_t gain)
+{
+	mix_x86_normal(sink, start_frame, mixed_frames, source, frame_count, sizeof(int32_t),
+		       mix_x86_normal_block_s24);
+}
+#endif
+
+#if CONFIG_FORMAT_S32LE
+static void normal_mix_channel_s32(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+				   int32_t mixed_frames,
+				   const struct audio_stream __sparse_cache *source,
+				   int32_t frame_count, uint16_t gain)
+{
+	mix_x86_normal(sink, start_frame, mixed_frames, source, frame_count, sizeof(int32_t),
+		       mix_x86_normal_block_s32);
+}
+#endif
+
+static void mix_x86_remap_init(struct mix_x86_remap *r, int sink_channels, int source_channels,
+			       uint32_t channel_map, uint16_t gain)
+{
+	int32_t index[MIX_X86_S32_LANES];
+	int32_t mute[MIX_X86_S32_LANES];
+	int32_t sink_mask[MIX_X86_S32_LANES];
+	int32_t source_mask[MIX_X86_S32_LANES];
+	int ch;
+	int i;
+
+	assert(sink_channels <= MIX_X86_S32_LANES && source_channels <= MIX_X86_S32_LANES);
+
+	for (i = 0; i < MIX_X86_S32_LANES; i++) {
+		ch = i < sink_channels ? (channel_map >> (i * 4)) & 0xf : 0xf;
+		mute[i] = ch == 0xf ? -1 : 0;
+		index[i] = ch == 0xf ? 0 : ch;
+		sink_mask[i] = i < sink_channels ? -1 : 0;
+		source_mask[i] = i < source_channels ? -1 : 0;
+	}
+
+	r->index = _mm256_loadu_si256((const __m256i *)index);
+	r->mute = _mm256_loadu_si256((const __m256i *)mute);
+	r->sink_mask = _mm256_loadu_si256((const __m256i *)sink_mask);
+	r->source_mask = _mm256_loadu_si256((const __m256i *)source_mask);
+	r->mix_mask = _mm256_andnot_si256(r->mute, r->sink_mask);
+	r->gain = _mm256_set1_epi32(gain);
+	r->unity = gain == IPC4_MIXIN_UNITY_GAIN;
+	r->sink_channels = sink_channels;
+	r->source_channels = source_channels;
+}
+
+/* Source samples in 32 bit lanes to the sink channel order */
+static inline __m256i mix_x86_remap_s32(__m256i x, const struct mix_x86_remap *r)
+{
+	return _mm256_permutevar8x32_epi32(x, r->index);
+}
+
+/* (int32_t)q_mults_32x32(x, gain, IPC4_MIXIN_GAIN_SHIFT) for the lanes and zero
+ * for the muted ones. The low halves of the 64 bit products shifted right hold
+ * the truncated results.
+ */
+static inline __m256i mix_x86_gain_s32(__m256i x, const struct mix_x86_remap *r)
+{
+	__m256i even;
+	__m256i odd;
+
+	if (!r->unity) {
+		even = _mm256_mul_epi32(x, r->gain);
+		odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), r->gain);
+		even = _mm256_srli_epi64(even, IPC4_MIXIN_GAIN_SHIFT);
+		odd = _mm256_slli_epi64(odd, 32 - IPC4_MIXIN_GAIN_SHIFT);
+		x = _mm256_blend_epi32(even, odd, 0xaa);
+	}
+
+	return _mm256_andnot_si256(r->mute, x);
+}
+
+/* q_mults_16x16(x, gain, IPC4_MIXIN_GAIN_SHIFT) for 16 bit samples in 32 bit lanes */
+static inline __m256i mix_x86_gain_s16(__m256i x, const struct mix_x86_remap *r)
+{
+	if (!r->unity)
+		x = _mm256_srai_epi32(_mm256_mullo_epi32(x, r->gain), IPC4_MIXIN_GAIN_SHIFT);
+
+	return _mm256_andnot_si256(r->mute, x);
+}
+
+#if CONFIG_FORMAT_S16LE
+static inline __m256i mix_x86_load_s16(const int16_t *p, int channels)
+{
+	int16_t tmp[MIX_X86_S32_LANES];
+	__m128i x;
+	int i;
+
+	switch (channels) {
+	case 4:
+		x = _mm_loadl_epi64((const __m128i *)p);
+		break;
+	case 8:
+		x = _mm_loadu_si128((const __m128i *)p);
+		break;
+	default:
+		for (i = 0; i < channels; i++)
+			tmp[i] = p[i];
+		for (; i < MIX_X86_S32_LANES; i++)
+			tmp[i] = 0;
+		x = _mm_loadu_si128((const __m128i *)tmp);
+		break;
+	}
+
+	return _mm256_cvtepi16_epi32(x);
+}
+
+static inline void mix_x86_store_s16(int16_t *p, int channels, __m256i x)
+{
+	int16_t tmp[MIX_X86_S32_LANES];
+	__m128i y = _mm_packs_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+	int i;
+
+	switch (channels) {
+	case 4:
+		_mm_storel_epi64((__m128i *)p, y);
+		break;
+	case 8:
+		_mm_storeu_si128((__m128i *)p, y);
+		break;
+	default:
+		_mm_storeu_si128((__m128i *)tmp, y);
+		for (i = 0; i < channels; i++)
+			p[i] = tmp[i];
+		break;
+	}
+}
+
+static void mix_x86_remap_block_s16(void *dst, const void *src, int32_t n, bool mix,
+				    const struct mix_x86_remap *r)
+{
+	const int16_t *s = src;
+	int16_t *d = dst;
+	__m256i x;
+	int32_t i;
+
+	for (i = 0; i < n; i++) {
+		x = mix_x86_load_s16(s, r->source_channels);
+		x = mix_x86_gain_s16(mix_x86_remap_s32(x, r), r);
+		if (mix)
+			x = _mm256_add_epi32(x, mix_x86_load_s16(d, r->sink_channels));
+		else
+			/* plain cast to 16 bits, the pack saturates */
+			x = _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+
+		mix_x86_store_s16(d, r->sink_channels, x);
+		s += r->source_channels;
+		d += r->sink_channels;
+	}
+}
+#endif
+
+#if CONFIG_FORMAT_S24LE
+static void mix_x86_remap_block_s24(void *dst, const void *src, int32_t n, bool mix,
+				    const struct mix_x86_remap *r)
+{
+	const int32_t *s = src;
+	int32_t *d = dst;
+	__m256i x;
+	__m256i y;
+	int32_t i;
+
+	for (i = 0; i < n; i++) {
+		x = _mm256_maskload_epi32(s, r->source_mask);
+		x = _mm256_srai_epi32(_mm256_slli_epi32(x, 8), 8);
+		x = mix_x86_gain_s32(mix_x86_remap_s32(x, r), r);
+		if (mix) {
+			y = _mm256_maskload_epi32(d, r->mix_mask);
+			_mm256_maskstore_epi32(d, r->mix_mask, mix_x86_sat_s24(y, x));
+		} else {
+			_mm256_maskstore_epi32(d, r->sink_mask, x);
+		}
+
+		s += r->source_channels;
+		d += r->sink_channels;
+	}
+}
+#endif
+
+#if CONFIG_FORMAT_S32LE
+static void mix_x86_remap_block_s32(void *dst, const void *src, int32_t n, bool mix,
+				    const struct mix_x86_remap *r)
+{
+	const int32_t *s = src;
+	int32_t *d = dst;
+	__m256i x;
+	__m256i y;
+	int32_t i;
+
+	for (i = 0; i < n; i++) {
+		x = _mm256_maskload_epi32(s, r->source_mask);
+		x = mix_x86_gain_s32(mix_x86_remap_s32(x, r), r);
+		if (mix) {
+			y = _mm256_maskload_epi32(d, r->mix_mask);
+			_mm256_maskstore_epi32(d, r->mix_mask, mix_x86_sat_s32(y, x));
+		} else {
+			_mm256_maskstore_epi32(d, r->sink_mask, x);
+		}
+
+		s += r->source_channels;
+		d += r->sink_channels;
+	}
+}
+#endif
+
+/* Copies bytes from or to a stream where they may cross the buffer wrap */
+static void mix_x86_read_wrap(const struct audio_stream __sparse_cache *stream,
+			      uint8_t *dst, const uint8_t *src, int bytes)
+{
+	int i;
+
+	for (i = 0; i < bytes; i++) {
+		src = audio_stream_wrap(stream, (void *)src);
+		dst[i] = *src++;
+	}
+}
+
+static void mix_x86_write_wrap(const struct audio_stream __sparse_cache *stream,
+			       uint8_t *dst, const uint8_t *src, int bytes)
+{
+	int i;
+
+	for (i = 0; i < bytes; i++) {
+		dst = audio_stream_wrap(stream, dst);
+		*dst++ = src[i];
+	}
+}
+
+/* Remap mode in wrap free blocks, a frame that is split by the wrap of either
+ * buffer is processed through temporary copies.
+ */
+static void mix_x86_remap(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+			  int32_t mixed_frames, const struct audio_stream __sparse_cache *source,
+			  int32_t frame_count, uint32_t channel_map, uint16_t gain,
+			  mix_x86_remap_block block)
+{
+	uint8_t src_frame[MIX_X86_FRAME_BYTES];
+	uint8_t dst_frame[MIX_X86_FRAME_BYTES];
+	struct mix_x86_remap r;
+	const int sink_frame_bytes = audio_stream_frame_bytes(sink);
+	const int source_frame_bytes = audio_stream_frame_bytes(source);
+	int32_t frames_to_mix, left_frames;
+	int32_t n, nmax;
+	uint8_t *dst = (uint8_t *)sink->w_ptr + start_frame * sink_frame_bytes;
+	uint8_t *src = source->r_ptr;
+	bool mix;
+
+	mix_x86_remap_init(&r, sink->channels, source->channels, channel_map, gain);
+
+	assert(mixed_frames >= start_frame);
+	frames_to_mix = mixed_frames - start_frame;
+	frames_to_mix = MIN(frames_to_mix, frame_count);
+
+	for (left_frames = frame_count; left_frames > 0; left_frames -= n) {
+		mix = left_frames > frame_count - frames_to_mix;
+		src = audio_stream_wrap(source, src);
+		dst = audio_stream_wrap(sink, dst);
+		nmax = audio_stream_bytes_without_wrap(source, src) / source_frame_bytes;
+		n = MIN(left_frames, nmax);
+		nmax = audio_stream_bytes_without_wrap(sink, dst) / sink_frame_bytes;
+		n = MIN(n, nmax);
+
+		/* mixed and copied frames are separate blocks */
+		if (mix)
+			n = MIN(n, left_frames - (frame_count - frames_to_mix));
+
+		if (n) {
+			block(dst, src, n, mix, &r);
+			dst += n * sink_frame_bytes;
+			src += n * source_frame_bytes;
+			continue;
+		}
+
+		n = 1;
+		mix_x86_read_wrap(source, src_frame, src, source_frame_bytes);
+		mix_x86_read_wrap(sink, dst_frame, dst, sink_frame_bytes);
+		block(dst_frame, src_frame, 1, mix, &r);
+		mix_x86_write_wrap(sink, dst, dst_frame, sink_frame_bytes);
+		dst += sink_frame_bytes;
+		src += source_frame_bytes;
+	}
+}
+
+#if CONFIG_FORMAT_S16LE
+static void remap_frames_s16(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+			     int32_t mixed_frames, const struct audio_stream __sparse_cache *source,
+			     int32_t frame_count, uint32_t channel_map, uint16_t gain)
+{
+	mix_x86_remap(sink, start_frame, mixed_frames, source, frame_count, channel_map, gain,
+		      mix_x86_remap_block_s16);
+}
+#endif
+
+#if CONFIG_FORMAT_S24LE
+static void remap_frames_s24(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+			     int32_t mixed_frames, const struct audio_stream __sparse_cache *source,
+			     int32_t frame_count, uint32_t channel_map, uint16_t gain)
+{
+	mix_x86_remap(sink, start_frame, mixed_frames, source, frame_count, channel_map, gain,
+		      mix_x86_remap_block_s24);
+}
+#endif
+
+#if CONFIG_FORMAT_S32LE
+static void remap_frames_s32(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+			     int32_t mixed_frames, const struct audio_stream __sparse_cache *source,
+			     int32_t frame_count, uint32_t channel_map, uint16_t gain)
+{
+	mix_x86_remap(sink, start_frame, mixed_frames, source, frame_count, channel_map, gain,
+		      mix_x86_remap_block_s32);
+}
+#endif
+
+const struct mix_func_map mix_func_map[] = {
+#if CONFIG_FORMAT_S16LE
+	{ SOF_IPC_FRAME_S16_LE, normal_mix_channel_s16, NULL, NULL, remap_frames_s16},
+#endif
+#if CONFIG_FORMAT_S24LE
+	{ SOF_IPC_FRAME_S24_4LE, normal_mix_channel_s24, NULL, NULL, remap_frames_s24},
+#endif
+#if CONFIG_FORMAT_S32LE
+	{ SOF_IPC_FRAME_S32_LE, normal_mix_channel_s32, NULL, NULL, remap_frames_s32}
+#endif
+};
+
+const size_t mix_count = ARRAY_SIZE(mix_func_map);
+
+#endif
@@ -222,6 +222,8 @@ static int cadence_codec_init(struct processing_module *mod)
 
 	codec->private = cd;
 	codec->mpd.init_done = 0;
+	/* input is only read up to the available size */
+	mod->direct_input_access = true;
 	cd->self = NULL;
 	cd->mem_tabs = NULL;
 	cd->api = NULL;
@@ -178,6 +178,9 @@ static int dts_codec_init(struct processing_module *mod)
 	if (ret)
 		comp_err(dev, "dts_codec_init() failed %d %d", ret, dts_result);
 
+	/* input is only read up to the available size */
+	mod->direct_input_access = true;
+
 	comp_dbg(dev, "dts_codec_init() done");
 
 	return ret;
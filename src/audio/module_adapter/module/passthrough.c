@@ -17,6 +17,9 @@ DECLARE_TR_CTX(passthrough_tr, SOF_UUID(passthrough_uuid), LOG_LEVEL_INFO);
 static int passthrough_codec_init(struct processing_module *mod)
 {
 	comp_info(mod->dev, "passthrough_codec_init() start");
+
+	/* input is only read up to the available size */
+	mod->direct_input_access = true;
 	return 0;
 }
 
@@ -271,8 +271,12 @@ static void volume_ramp(struct processing_module *mod)
 {
 	struct vol_data *cd = module_get_private_data(mod);
 	struct comp_dev *dev = mod->dev;
-	int32_t vol;
+	int32_t vol = 0;
 	int32_t ramp_time;
+	int32_t ramp_rvolume = 0;
+	int32_t ramp_tvolume = 0;
+	int32_t ramp_coef = 0;
+	bool ramp_valid = false;
 	int i;
 	bool ramp_finished = true;
 
@@ -307,9 +311,19 @@ static void volume_ramp(struct processing_module *mod)
 
 		/* Update volume gain with ramp. The ramp gain value is
 		 * calculated from previous gain and ramp time. The slope
-		 * coefficient is calculated in volume_set_chan().
+		 * coefficient is calculated in volume_set_chan(). Channels
+		 * with the same ramp as the previous ramped one get the same
+		 * gain without calculating it again.
 		 */
-		vol = cd->ramp_func(mod, ramp_time, i);
+		if (!ramp_valid || cd->rvolume[i] != ramp_rvolume ||
+		    cd->tvolume[i] != ramp_tvolume || cd->ramp_coef[i] != ramp_coef) {
+			vol = cd->ramp_func(mod, ramp_time, i);
+			ramp_rvolume = cd->rvolume[i];
+			ramp_tvolume = cd->tvolume[i];
+			ramp_coef = cd->ramp_coef[i];
+			ramp_valid = true;
+		}
+
 		if (cd->volume[i] < cd->tvolume[i]) {
 			/* ramp up, check if ramp completed */
 			if (vol >= cd->tvolume[i] || vol >= cd->vol_max) {
@@ -65,12 +65,18 @@ static void vol_s24_to_s24(struct processing_module *mod, struct input_stream_bu
 	const int nch = source->channels;
 	int remaining_samples = frames * nch;
 #if CONFIG_COMP_PEAK_VOL
-	int32_t tmp = INT_MIN_FOR_NUMBER_OF_BITS(32);
+	int32_t tmp;
 #endif
 
 	x = source->r_ptr;
 	y = sink->w_ptr;
 
+#if CONFIG_COMP_PEAK_VOL
+	/* peak of each channel over the processed frames */
+	for (j = 0; j < nch; j++)
+		cd->peak_regs.peak_meter[j] = INT_MIN_FOR_NUMBER_OF_BITS(32);
+#endif
+
 	bsource->consumed += VOL_S32_SAMPLES_TO_BYTES(remaining_samples);
 	bsink->size += VOL_S32_SAMPLES_TO_BYTES(remaining_samples);
 	while (remaining_samples) {
@@ -82,6 +88,9 @@ static void vol_s24_to_s24(struct processing_module *mod, struct input_stream_bu
 			x0 = x + j;
 			y0 = y + j;
 			vol = cd->volume[j];
+#if CONFIG_COMP_PEAK_VOL
+			tmp = cd->peak_regs.peak_meter[j];
+#endif
 			for (i = 0; i < n; i += nch) {
 				*y0 = vol_mult_s24_to_s24(*x0, vol);
 #if CONFIG_COMP_PEAK_VOL
@@ -128,11 +137,17 @@ static void vol_s32_to_s32(struct processing_module *mod, struct input_stream_bu
 	const int nch = source->channels;
 	int remaining_samples = frames * nch;
 #if CONFIG_COMP_PEAK_VOL
-	int32_t tmp = INT_MIN_FOR_NUMBER_OF_BITS(32);
+	int32_t tmp;
 #endif
 
 	x = source->r_ptr;
 	y = sink->w_ptr;
+
+#if CONFIG_COMP_PEAK_VOL
+	/* peak of each channel over the processed frames */
+	for (j = 0; j < nch; j++)
+		cd->peak_regs.peak_meter[j] = INT_MIN_FOR_NUMBER_OF_BITS(32);
+#endif
 	bsource->consumed += VOL_S32_SAMPLES_TO_BYTES(remaining_samples);
 	bsink->size += VOL_S32_SAMPLES_TO_BYTES(remaining_samples);
 	while (remaining_samples) {
@@ -147,6 +162,9 @@ static void vol_s32_to_s32(struct processing_module *mod, struct input_stream_bu
 			x0 = x + j;
 			y0 = y + j;
 			vol = cd->volume[j];
+#if CONFIG_COMP_PEAK_VOL
+			tmp = cd->peak_regs.peak_meter[j];
+#endif
 			for (i = 0; i < n; i += nch) {
 				*y0 = q_multsr_sat_32x32(*x0, vol,
 							 Q_SHIFT_BITS_64(31, VOL_QXY_Y, 31));
@@ -195,12 +213,18 @@ static void vol_s16_to_s16(struct processing_module *mod, struct input_stream_bu
 	const int nch = source->channels;
 	int remaining_samples = frames * nch;
 #if CONFIG_COMP_PEAK_VOL
-	int16_t tmp = INT_MIN_FOR_NUMBER_OF_BITS(16);
+	int16_t tmp;
 #endif
 
 	x = source->r_ptr;
 	y = sink->w_ptr;
 
+#if CONFIG_COMP_PEAK_VOL
+	/* peak of each channel over the processed frames */
+	for (j = 0; j < nch; j++)
+		cd->peak_regs.peak_meter[j] = INT_MIN_FOR_NUMBER_OF_BITS(16);
+#endif
+
 	bsource->consumed += VOL_S16_SAMPLES_TO_BYTES(remaining_samples);
 	bsink->size += VOL_S16_SAMPLES_TO_BYTES(remaining_samples);
 	while (remaining_samples) {
@@ -212,6 +236,9 @@ static void vol_s16_to_s16(struct processing_module *mod, struct input_stream_bu
 			x0 = x + j;
 			y0 = y + j;
 			vol = cd->volume[j];
+#if CONFIG_COMP_PEAK_VOL
+			tmp = cd->peak_regs.peak_meter[j];
+#endif
 			for (i = 0; i < n; i += nch) {
 				*y0 = q_multsr_sat_32x32_16(*x0, vol,
 							    Q_SHIFT_BITS_32(15, VOL_QXY_Y, 15));
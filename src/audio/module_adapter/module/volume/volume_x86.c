@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/**
+ * \file
+ * \brief Volume AVX2 processing implementation for x86 host builds
+ */
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <rtos/string.h>
+#include <ipc/stream.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_DECLARE(volume_x86, CONFIG_SOF_LOG_LEVEL);
+
+#include <sof/audio/volume.h>
+
+#ifdef VOLUME_X86
+
+#include <immintrin.h>
+
+/*
+ * The interleaved samples are scaled in vectors of VOL_X86_LANES without
+ * regard to the frame boundaries. The channel gains are repeated to a lane
+ * gain table, so the gains for a vector that starts at channel ch are the
+ * VOL_X86_LANES words at gain[ch]. The table is built once per call, i.e.
+ * once per ramp step when the volume is ramped. The products are rounded
+ * and saturated as in q_multsr_sat_32x32() and its 16 and 24 bit variants,
+ * so the output is the same as from the generic version. With unity gain
+ * in all channels the samples are copied.
+ */
+
+/* Samples per vector */
+#define VOL_X86_LANES	8
+
+/* Q_SHIFT_BITS_64(qx, VOL_QXY_Y, qx) of the generic version */
+#define VOL_X86_SHIFT	VOL_QXY_Y
+
+struct vol_x86_state {
+	int32_t gain[SOF_IPC_MAX_CHANNELS + VOL_X86_LANES - 1];
+	int sample_bytes;
+	int nch;
+	int ch;			/* channel of the next sample */
+	int ch_step;		/* channel advance of a vector */
+#if CONFIG_COMP_PEAK_VOL
+	__m256i peak[SOF_IPC_MAX_CHANNELS];	/* vectors that start at channel ch */
+	int32_t peak_ch[SOF_IPC_MAX_CHANNELS];	/* samples outside the vectors */
+#endif
+};
+
+typedef void (*vol_x86_block)(struct vol_x86_state *st, const void *x, void *y, int n);
+
+static void vol_x86_init(struct vol_data *cd, struct vol_x86_state *st, int nch,
+			 int sample_bytes)
+{
+	int i;
+
+	for (i = 0; i < nch + VOL_X86_LANES - 1; i++)
+		st->gain[i] = cd->volume[i % nch];
+
+	st->sample_bytes = sample_bytes;
+	st->nch = nch;
+	st->ch = 0;
+	st->ch_step = VOL_X86_LANES % nch;
+
+#if CONFIG_COMP_PEAK_VOL
+	for (i = 0; i < nch; i++) {
+		st->peak[i] = _mm256_set1_epi32(INT32_MIN);
+		st->peak_ch[i] = INT32_MIN;
+	}
+#endif
+}
+
+/* Peak of each channel from the vectors and the single samples */
+static void vol_x86_peak_update(struct vol_data *cd, struct vol_x86_state *st)
+{
+#if CONFIG_COMP_PEAK_VOL
+	int32_t lanes[VOL_X86_LANES];
+	int ch;
+	int i;
+
+	for (ch = 0; ch < st->nch; ch++) {
+		_mm256_storeu_si256((__m256i *)lanes, st->peak[ch]);
+		for (i = 0; i < VOL_X86_LANES; i++)
+			st->peak_ch[(ch + i) % st->nch] =
+				MAX(st->peak_ch[(ch + i) % st->nch], lanes[i]);
+	}
+
+	for (ch = 0; ch < st->nch; ch++)
+		cd->peak_regs.peak_meter[ch] = st->peak_ch[ch];
+#endif
+	peak_vol_update(cd);
+}
+
+static inline __m256i vol_x86_gain(const struct vol_x86_state *st)
+{
+	return _mm256_loadu_si256((const __m256i *)&st->gain[st->ch]);
+}
+
+/* Peak and channel position after a vector */
+static inline void vol_x86_next(struct vol_x86_state *st, __m256i y)
+{
+#if CONFIG_COMP_PEAK_VOL
+	st->peak[st->ch] = _mm256_max_epi32(st->peak[st->ch], y);
+#endif
+	st->ch += st->ch_step;
+	if (st->ch >= st->nch)
+		st->ch -= st->nch;
+}
+
+/* Peak and channel position after a single sample */
+static inline void vol_x86_next_sample(struct vol_x86_state *st, int32_t y)
+{
+#if CONFIG_COMP_PEAK_VOL
+	st->peak_ch[st->ch] = MAX(st->peak_ch[st->ch], y);
+#endif
+	if (++st->ch == st->nch)
+		st->ch = 0;
+}
+
+/* ((p >> (VOL_X86_SHIFT - 1)) + 1) >> 1 of the 64 bit lanes. An offset
+ * keeps the products positive, so the logical shifts give the arithmetic
+ * ones.
+ */
+static inline __m256i vol_x86_round(__m256i p)
+{
+	p = _mm256_add_epi64(p, _mm256_set1_epi64x(1LL << 62));
+	p = _mm256_srli_epi64(p, VOL_X86_SHIFT - 1);
+	p = _mm256_srli_epi64(_mm256_add_epi64(p, _mm256_set1_epi64x(1)), 1);
+	return _mm256_sub_epi64(p, _mm256_set1_epi64x(1LL << (62 - VOL_X86_SHIFT)));
+}
+
+static inline __m256i vol_x86_sat32(__m256i p)
+{
+	const __m256i min = _mm256_set1_epi64x(INT32_MIN);
+	const __m256i max = _mm256_set1_epi64x(INT32_MAX);
+
+	p = _mm256_blendv_epi8(p, min, _mm256_cmpgt_epi64(min, p));
+	return _mm256_blendv_epi8(p, max, _mm256_cmpgt_epi64(p, max));
+}
+
+/* Scales the 32 bit lanes with the lane gains. The rounded products are
+ * truncated to 32 bits as the int32_t argument of sat_int24() and
+ * sat_int16() does, the caller saturates them to the sample width.
+ */
+static inline __m256i vol_x86_mult(__m256i x, __m256i g)
+{
+	__m256i even = _mm256_mul_epi32(x, g);
+	__m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(g, 32));
+
+	even = vol_x86_round(even);
+	odd = vol_x86_round(odd);
+	return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+}
+
+/* As vol_x86_mult() but saturated to 32 bits */
+static inline __m256i vol_x86_mult_s32(__m256i x, __m256i g)
+{
+	__m256i even = _mm256_mul_epi32(x, g);
+	__m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(g, 32));
+
+	even = vol_x86_sat32(vol_x86_round(even));
+	odd = vol_x86_sat32(vol_x86_round(odd));
+	return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+}
+
+/* Processing in wrap free blocks of samples */
+static void vol_x86_scale(struct processing_module *mod, struct input_stream_buffer *bsource,
+			  struct output_stream_buffer *bsink, uint32_t frames, int sample_bytes,
+			  vol_x86_block block)
+{
+	struct vol_data *cd = module_get_private_data(mod);
+	struct audio_stream __sparse_cache *source = bsource->data;
+	struct audio_stream __sparse_cache *sink = bsink->data;
+	struct vol_x86_state st;
+	const int nch = source->channels;
+	int remaining_samples = frames * nch;
+	uint8_t *x = source->r_ptr;
+	uint8_t *y = sink->w_ptr;
+	int nmax, n;
+
+	vol_x86_init(cd, &st, nch, sample_bytes);
+
+	bsource->consumed += remaining_samples * sample_bytes;
+	bsink->size += remaining_samples * sample_bytes;
+	while (remaining_samples) {
+		nmax = audio_stream_bytes_without_wrap(source, x) / sample_bytes;
+		n = MIN(remaining_samples, nmax);
+		nmax = audio_stream_bytes_without_wrap(sink, y) / sample_bytes;
+		n = MIN(n, nmax);
+		block(&st, x, y, n);
+		remaining_samples -= n;
+		x = audio_stream_wrap(source, x + n * sample_bytes);
+		y = audio_stream_wrap(sink, y + n * sample_bytes);
+	}
+
+	vol_x86_peak_update(cd, &st);
+}
+
+/* Unity gain in all channels, the peak meter needs the samples */
+static bool vol_x86_unity(struct processing_module *mod, int nch)
+{
+	struct vol_data *cd = module_get_private_data(mod);
+	int i;
+
+	if (IS_ENABLED(CONFIG_COMP_PEAK_VOL))
+		return false;
+
+	for (i = 0; i < nch; i++)
+		if (cd->volume[i] != VOL_ZERO_DB)
+			return false;
+
+	return true;
+}
+
+#if CONFIG_FORMAT_S24LE
+static void vol_x86_block_s24(struct vol_x86_state *st, const void *x, void *y, int n)
+{
+	const int32_t *in = x;
+	int32_t *out = y;
+	__m256i v;
+	int i;
+
+	for (i = 0; i + VOL_X86_LANES <= n; i += VOL_X86_LANES) {
+		v = _mm256_loadu_si256((const __m256i *)(in + i));
+		v = _mm256_srai_epi32(_mm256_slli_epi32(v, 8), 8);
+		v = vol_x86_mult(v, vol_x86_gain(st));
+		v = _mm256_max_epi32(_mm256_min_epi32(v, _mm256_set1_epi32(INT24_MAXVALUE)),
+				     _mm256_set1_epi32(INT24_MINVALUE));
+		_mm256_storeu_si256((__m256i *)(out + i), v);
+		vol_x86_next(st, v);
+	}
+
+	for (; i < n; i++) {
+		out[i] = q_multsr_sat_32x32_24(sign_extend_s24(in[i]), st->gain[st->ch],
+					       VOL_X86_SHIFT);
+		vol_x86_next_sample(st, out[i]);
+	}
+}
+
+/* Unity gain leaves the samples sign extended as q_multsr_sat_32x32_24() */
+static void vol_x86_copy_s24(struct vol_x86_state *st, const void *x, void *y, int n)
+{
+	const int32_t *in = x;
+	int32_t *out = y;
+	__m256i v;
+	int i;
+
+	for (i = 0; i + VOL_X86_LANES <= n; i += VOL_X86_LANES) {
+		v = _mm256_loadu_si256((const __m256i *)(in + i));
+		v = _mm256_srai_epi32(_mm256_slli_epi32(v, 8), 8);
+		_mm256_storeu_si256((__m256i *)(out + i), v);
+	}
+
+	for (; i < n; i++)
+		out[i] = sign_extend_s24(in[i]);
+}
+
+static void vol_s24_to_s24(struct processing_module *mod, struct input_stream_buffer *bsource,
+			   struct output_stream_buffer *bsink, uint32_t frames)
+{
+	struct audio_stream __sparse_cache *source = bsource->data;
+
+	vol_x86_scale(mod, bsource, bsink, frames, sizeof(int32_t),
+		      vol_x86_unity(mod, source->channels) ? vol_x86_copy_s24 : vol_x86_block_s24);
+}
+#endif /* CONFIG_FORMAT_S24LE */
+
+#if CONFIG_FORMAT_S32LE || CONFIG_FORMAT_S16LE
+static void vol_x86_copy(struct vol_x86_state *st, const void *x, void *y, int n)
+{
+	int bytes = n * st->sample_bytes;
+
+	memcpy_s(y, bytes, x, bytes);
+}
+#endif
+
+#if CONFIG_FORMAT_S32LE
+static void vol_x86_block_s32(struct vol_x86_state *st, const void *x, void *y, int n)
+{
+	const int32_t *in = x;
+	int32_t *out = y;
+	__m256i v;
+	int i;
+
+	for (i = 0; i + VOL_X86_LANES <= n; i += VOL_X86_LANES) {
+		v = _mm256_loadu_si256((const __m256i *)(in + i));
+		v = vol_x86_mult_s32(v, vol_x86_gain(st));
+		_mm256_storeu_si256((__m256i *)(out + i), v);
+		vol_x86_next(st, v);
+	}
+
+	for (; i < n; i++) {
+		out[i] = q_multsr_sat_32x32(in[i], st->gain[st->ch], VOL_X86_SHIFT);
+		vol_x86_next_sample(st, out[i]);
+	}
+}
+
+static void vol_s32_to_s32(struct processing_module *mod, struct input_stream_buffer *bsource,
+			   struct output_stream_buffer *bsink, uint32_t frames)
+{
+	struct audio_stream __sparse_cache *source = bsource->data;
+
+	vol_x86_scale(mod, bsource, bsink, frames, sizeof(int32_t),
+		      vol_x86_unity(mod, source->channels) ? vol_x86_copy : vol_x86_block_s32);
+}
+#endif /* CONFIG_FORMAT_S32LE */
+
+#if CONFIG_FORMAT_S16LE
+static void vol_x86_block_s16(struct vol_x86_state *st, const void *x, void *y, int n)
+{
+	const int16_t *in = x;
+	int16_t *out = y;
+	__m256i v;
+	int i;
+
+	for (i = 0; i + VOL_X86_LANES <= n; i += VOL_X86_LANES) {
+		v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in + i)));
+		v = vol_x86_mult(v, vol_x86_gain(st));
+		v = _mm256_max_epi32(_mm256_min_epi32(v, _mm256_set1_epi32(INT16_MAX)),
+				     _mm256_set1_epi32(INT16_MIN));
+		_mm_storeu_si128((__m128i *)(out + i),
+				 _mm_packs_epi32(_mm256_castsi256_si128(v),
+						 _mm256_extracti128_si256(v, 1)));
+		vol_x86_next(st, v);
+	}
+
+	for (; i < n; i++) {
+		out[i] = q_multsr_sat_32x32_16(in[i], st->gain[st->ch], VOL_X86_SHIFT);
+		vol_x86_next_sample(st, out[i]);
+	}
+}
+
+static void vol_s16_to_s16(struct processing_module *mod, struct input_stream_buffer *bsource,
+			   struct output_stream_buffer *bsink, uint32_t frames)
+{
+	struct audio_stream __sparse_cache *source = bsource->data;
+
+	vol_x86_scale(mod, bsource, bsink, frames, sizeof(int16_t),
+		      vol_x86_unity(mod, source->channels) ? vol_x86_copy : vol_x86_block_s16);
+}
+#endif /* CONFIG_FORMAT_S16LE */
+
+const struct comp_func_map volume_func_map[] = {
+#if CONFIG_FORMAT_S16LE
+	{ SOF_IPC_FRAME_S16_LE, vol_s16_to_s16 },
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	{ SOF_IPC_FRAME_S24_4LE, vol_s24_to_s24 },
+#endif /* CONFIG_FORMAT_S24LE */
+#if CONFIG_FORMAT_S32LE
+	{ SOF_IPC_FRAME_S32_LE, vol_s32_to_s32 },
+#endif /* CONFIG_FORMAT_S32LE */
+};
+
+const size_t volume_func_count = ARRAY_SIZE(volume_func_map);
+
+#endif /* VOLUME_X86 */
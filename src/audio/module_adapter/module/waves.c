@@ -640,6 +640,9 @@ static int waves_codec_init(struct processing_module *mod)
 	}
 	waves_codec->setup_cfg.avail = false;
 
+	/* input is only read up to the available size */
+	mod->direct_input_access = true;
+
 	/* copy the setup config only for the first init */
 	if (codec->state == MODULE_DISABLED && codec->cfg.avail) {
 		struct module_config *setup_cfg = &waves_codec->setup_cfg;
@@ -308,6 +308,17 @@ int module_adapter_prepare(struct comp_dev *dev)
 	 */
 	buff_size = MAX(mod->period_bytes, md->mpd.out_buff_size) * buff_periods;
 	mod->output_buffer_size = buff_size;
+	mod->direct_input_bytes = 0;
+
+	/* keep the local input buffers for the cases when input is not accessed directly */
+	mod->input_buffers_local = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+					   sizeof(*mod->input_buffers_local) *
+					   mod->num_input_buffers);
+	if (!mod->input_buffers_local) {
+		comp_err(dev, "module_adapter_prepare(): failed to allocate local input buffers");
+		ret = -ENOMEM;
+		goto out_free;
+	}
 
 	/* allocate memory for input buffer data */
 	list_for_item(blist, &dev->bsource_list) {
@@ -320,6 +331,7 @@ int module_adapter_prepare(struct comp_dev *dev)
 			ret = -ENOMEM;
 			goto in_free;
 		}
+		mod->input_buffers_local[i] = mod->input_buffers[i].data;
 		i++;
 	}
 
@@ -398,6 +410,8 @@ in_free:
 		rfree((__sparse_force void *)mod->input_buffers[i].data);
 
 	rfree(mod->input_buffers);
+	rfree(mod->input_buffers_local);
+	mod->input_buffers_local = NULL;
 	return ret;
 }
 
@@ -800,6 +814,26 @@ out:
 	return ret;
 }
 
+/*
+ * Function to return an input buffer to its local data after processing. Only a local copy
+ * of the source data is cleared, the source buffer passed in place is left untouched.
+ * @mod: processing module
+ * @index: input buffer index
+ * @size: size of the local input buffer
+ */
+static void module_input_buffer_release(struct processing_module *mod, int index, size_t size)
+{
+	struct input_stream_buffer *input = &mod->input_buffers[index];
+
+	if (input->data == mod->input_buffers_local[index])
+		bzero((__sparse_force void *)input->data, size);
+	else
+		input->data = mod->input_buffers_local[index];
+
+	input->size = 0;
+	input->consumed = 0;
+}
+
 int module_adapter_copy(struct comp_dev *dev)
 {
 	struct processing_module *mod = comp_get_drvdata(dev);
@@ -850,8 +884,17 @@ int module_adapter_copy(struct comp_dev *dev)
 		mod->input_buffers[i].size = bytes_to_process;
 		mod->input_buffers[i].consumed = 0;
 
-		ca_copy_from_source_to_module(&src_c->stream, mod->input_buffers[i].data,
-					      md->mpd.in_buff_size, bytes_to_process);
+		/* pass the source data in place if the module allows it and it does not wrap */
+		if (mod->direct_input_access &&
+		    bytes_to_process <= audio_stream_bytes_without_wrap(&src_c->stream,
+									src_c->stream.r_ptr)) {
+			mod->input_buffers[i].data =
+				(__sparse_force void __sparse_cache *)src_c->stream.r_ptr;
+			mod->direct_input_bytes += bytes_to_process;
+		} else {
+			ca_copy_from_source_to_module(&src_c->stream, mod->input_buffers[i].data,
+						      md->mpd.in_buff_size, bytes_to_process);
+		}
 		buffer_release(src_c);
 
 		i++;
@@ -880,9 +923,7 @@ int module_adapter_copy(struct comp_dev *dev)
 		comp_update_buffer_consume(src_c, mod->input_buffers[i].consumed);
 		buffer_release(src_c);
 
-		bzero((__sparse_force void *)mod->input_buffers[i].data, size);
-		mod->input_buffers[i].size = 0;
-		mod->input_buffers[i].consumed = 0;
+		module_input_buffer_release(mod, i, size);
 		i++;
 	}
 	module_adapter_process_output(dev);
@@ -893,11 +934,8 @@ out:
 	for (i = 0; i < mod->num_output_buffers; i++)
 		mod->output_buffers[i].size = 0;
 
-	for (i = 0; i < mod->num_input_buffers; i++) {
-		bzero((__sparse_force void *)mod->input_buffers[i].data, size);
-		mod->input_buffers[i].size = 0;
-		mod->input_buffers[i].consumed = 0;
-	}
+	for (i = 0; i < mod->num_input_buffers; i++)
+		module_input_buffer_release(mod, i, size);
 
 	return ret;
 }
@@ -1116,6 +1154,12 @@ int module_adapter_reset(struct comp_dev *dev)
 			rfree((__sparse_force void *)mod->input_buffers[i].data);
 
 	rfree(mod->input_buffers);
+	rfree(mod->input_buffers_local);
+	mod->input_buffers_local = NULL;
+
+	if (mod->direct_input_access)
+		comp_info(dev, "module_adapter_reset(): %u kB of input passed without copy",
+			  (uint32_t)(mod->direct_input_bytes >> 10));
 
 	mod->num_input_buffers = 0;
 	mod->num_output_buffers = 0;
@@ -69,6 +69,11 @@ static inline void multiband_drc_reset_state(struct multiband_drc_state *state)
 	/* Reset deemphasis eq-iir state */
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		multiband_drc_iir_reset_state_ch(&state->deemphasis[i]);
+
+	/* Free the block buffers */
+	rfree(state->block_buf[0]);
+	for (i = 0; i < SOF_MULTIBAND_DRC_MAX_BANDS; i++)
+		state->block_buf[i] = NULL;
 }
 
 static int multiband_drc_eq_init_coef_ch(struct sof_eq_iir_biquad *coef,
@@ -109,6 +114,7 @@ static int multiband_drc_init_coef(struct multiband_drc_comp_data *cd, int16_t n
 	struct sof_multiband_drc_config *config = cd->config;
 	struct multiband_drc_state *state = &cd->state;
 	uint32_t sample_bytes = get_sample_bytes(cd->source_format);
+	size_t samples;
 	int i, ch, ret, num_bands;
 
 	if (!config) {
@@ -201,6 +207,19 @@ static int multiband_drc_init_coef(struct multiband_drc_comp_data *cd, int16_t n
 		}
 	}
 
+	/* Allocate the block buffers of the bands for the channels */
+	samples = MULTIBAND_DRC_BLOCK_FRAMES * nch;
+	state->block_buf[0] = rballoc(0, SOF_MEM_CAPS_RAM, num_bands * samples * sizeof(int32_t));
+	if (!state->block_buf[0]) {
+		comp_cl_err(&comp_multiband_drc,
+			    "multiband_drc_init_coef(), could not allocate block buffers");
+		ret = -ENOMEM;
+		goto err;
+	}
+
+	for (i = 1; i < num_bands; i++)
+		state->block_buf[i] = state->block_buf[i - 1] + samples;
+
 	return 0;
 
 err:
@@ -262,7 +281,7 @@ static struct comp_dev *multiband_drc_new(const struct comp_driver *drv,
 
 	cd->process_enabled = false;
 	cd->multiband_drc_func = NULL;
-	cd->crossover_split = NULL;
+	cd->crossover_split_block = NULL;
 
 	/* Handler for configuration data */
 	cd->model_handler = comp_data_blob_handler_new(dev);
@@ -300,6 +319,8 @@ static void multiband_drc_free(struct comp_dev *dev)
 
 	comp_data_blob_handler_free(cd->model_handler);
 
+	multiband_drc_reset_state(&cd->state);
+
 	rfree(cd);
 	rfree(dev);
 }
@@ -554,8 +575,8 @@ static int multiband_drc_prepare(struct comp_dev *dev)
 			goto out_source;
 		}
 
-		cd->crossover_split = crossover_find_split_func(cd->config->num_bands);
-		if (!cd->crossover_split) {
+		cd->crossover_split_block = crossover_find_split_block_func(cd->config->num_bands);
+		if (!cd->crossover_split_block) {
 			comp_err(dev, "multiband_drc_prepare(), No crossover_split for band num %i",
 				 cd->config->num_bands);
 			ret = -EINVAL;
@@ -612,7 +633,7 @@ static int multiband_drc_reset(struct comp_dev *dev)
 
 	cd->source_format = 0;
 	cd->multiband_drc_func = NULL;
-	cd->crossover_split = NULL;
+	cd->crossover_split_block = NULL;
 
 	comp_set_state(dev, COMP_TRIGGER_RESET);
 	return 0;
@@ -18,178 +18,172 @@ static void multiband_drc_default_pass(const struct comp_dev *dev,
 	audio_stream_copy(source, 0, sink, 0, source->channels * frames);
 }
 
-static void multiband_drc_process_emp_crossover(struct multiband_drc_state *state,
-						crossover_split split_func,
-						int32_t *buf_src,
-						int32_t *buf_sink,
-						int enable_emp,
-						int nch,
-						int nband)
+static void multiband_drc_iir(struct iir_state_df2t iir[], int nch,
+			      int32_t *buf, int frames)
 {
-	struct iir_state_df2t *emp_s;
-	struct crossover_state *crossover_s;
-	int32_t *buf_sink_band;
-	int ch, band;
-	int32_t emp_out;
-	int32_t crossover_out[nband];
-
-	for (ch = 0; ch < nch; ch++) {
-		emp_s = &state->emphasis[ch];
-		crossover_s = &state->crossover[ch];
-
-		if (enable_emp)
-			emp_out = iir_df2t(emp_s, *buf_src);
-		else
-			emp_out = *buf_src;
-
-		split_func(emp_out, crossover_out, crossover_s);
-		buf_sink_band = buf_sink;
-		for (band = 0; band < nband; band++) {
-			*buf_sink_band = crossover_out[band];
-			buf_sink_band += PLATFORM_MAX_CHANNELS;
-		}
-
-		buf_src++;
-		buf_sink++;
-	}
-}
-
-#if CONFIG_FORMAT_S16LE
-static void multiband_drc_s16_process_drc(struct drc_state *state,
-					  const struct sof_drc_params *p,
-					  int32_t *buf_src,
-					  int32_t *buf_sink,
-					  int nch)
-{
-	int16_t *pd_write;
-	int16_t *pd_read;
+#if IIR_X86
+	struct iir_state_df2t *filter[PLATFORM_MAX_CHANNELS];
 	int ch;
-	int pd_write_index;
-	int pd_read_index;
-
-	if (p->enabled && !state->processed) {
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 2, nch);
-		state->processed = 1;
-	}
 
-	pd_write_index = state->pre_delay_write_index;
-	pd_read_index = state->pre_delay_read_index;
+	/* the channels are in SIMD lanes on x86 hosts */
+	for (ch = 0; ch < nch; ch++)
+		filter[ch] = &iir[ch];
 
-	for (ch = 0; ch < nch; ++ch) {
-		pd_write = (int16_t *)state->pre_delay_buffers[ch] + pd_write_index;
-		pd_read = (int16_t *)state->pre_delay_buffers[ch] + pd_read_index;
-		*pd_write = sat_int16(Q_SHIFT_RND(*buf_src, 31, 15));
-		*buf_sink = *pd_read << 16;
-
-		buf_src++;
-		buf_sink++;
-	}
-
-	pd_write_index = (pd_write_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	pd_read_index = (pd_read_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	state->pre_delay_write_index = pd_write_index;
-	state->pre_delay_read_index = pd_read_index;
-
-	/* Only perform delay frames by early return here if not enabled */
-	if (!p->enabled)
-		return;
+	iir_df2t_multich(filter, nch, buf, buf, frames);
+#else
+	int samples = frames * nch;
+	int ch, i;
 
-	/* Process the input division (32 frames). */
-	if (!(pd_write_index & DRC_DIVISION_FRAMES_MASK)) {
-		drc_update_detector_average(state, p, 2, nch);
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 2, nch);
-	}
+	for (ch = 0; ch < nch; ch++)
+		for (i = ch; i < samples; i += nch)
+			buf[i] = iir_df2t(&iir[ch], buf[i]);
+#endif
 }
-#endif /* CONFIG_FORMAT_S16LE */
 
-#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-static void multiband_drc_s32_process_drc(struct drc_state *state,
-					  const struct sof_drc_params *p,
-					  int32_t *buf_src,
-					  int32_t *buf_sink,
-					  int nch)
+/* Runs the DRC of a band for a block of frames in place. The frames go
+ * through the pre-delay buffers up to the end of the division and the
+ * division is processed, as when the frames are passed one at a time.
+ */
+static void multiband_drc_process_drc(struct drc_state *state,
+				      const struct sof_drc_params *p,
+				      int32_t *buf, int nbyte, int nch,
+				      int frames)
 {
-	int32_t *pd_write;
-	int32_t *pd_read;
-	int ch;
+	int16_t *pd_write16;
+	int16_t *pd_read16;
+	int32_t *pd_write32;
+	int32_t *pd_read32;
 	int pd_write_index;
 	int pd_read_index;
+	int ch, i, n;
 
 	if (p->enabled && !state->processed) {
 		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 4, nch);
+		drc_compress_output(state, p, nbyte, nch);
 		state->processed = 1;
 	}
 
-	pd_write_index = state->pre_delay_write_index;
-	pd_read_index = state->pre_delay_read_index;
-
-	for (ch = 0; ch < nch; ++ch) {
-		pd_write = (int32_t *)state->pre_delay_buffers[ch] + pd_write_index;
-		pd_read = (int32_t *)state->pre_delay_buffers[ch] + pd_read_index;
-		*pd_write = *buf_src;
-		*buf_sink = *pd_read;
+	while (frames) {
+		pd_write_index = state->pre_delay_write_index;
+		pd_read_index = state->pre_delay_read_index;
+
+		/* The pre-delay is a multiple of the division so neither index
+		 * wraps before the end of the division.
+		 */
+		n = MIN(frames, DRC_DIVISION_FRAMES - (pd_write_index & DRC_DIVISION_FRAMES_MASK));
+		for (ch = 0; ch < nch; ch++) {
+			if (nbyte == 2) {
+				pd_write16 = (int16_t *)state->pre_delay_buffers[ch] +
+					pd_write_index;
+				pd_read16 = (int16_t *)state->pre_delay_buffers[ch] +
+					pd_read_index;
+				for (i = 0; i < n; i++) {
+					pd_write16[i] = sat_int16(Q_SHIFT_RND(buf[i * nch + ch],
+									      31, 15));
+					buf[i * nch + ch] = pd_read16[i] << 16;
+				}
+			} else {
+				pd_write32 = (int32_t *)state->pre_delay_buffers[ch] +
+					pd_write_index;
+				pd_read32 = (int32_t *)state->pre_delay_buffers[ch] +
+					pd_read_index;
+				for (i = 0; i < n; i++) {
+					pd_write32[i] = buf[i * nch + ch];
+					buf[i * nch + ch] = pd_read32[i];
+				}
+			}
+		}
 
-		buf_src++;
-		buf_sink++;
+		pd_write_index = (pd_write_index + n) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
+		pd_read_index = (pd_read_index + n) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
+		state->pre_delay_write_index = pd_write_index;
+		state->pre_delay_read_index = pd_read_index;
+		buf += n * nch;
+		frames -= n;
+
+		/* Only perform delay frames if not enabled */
+		if (!p->enabled)
+			continue;
+
+		/* Process the input division (32 frames). */
+		if (!(pd_write_index & DRC_DIVISION_FRAMES_MASK)) {
+			drc_update_detector_average(state, p, nbyte, nch);
+			drc_update_envelope(state, p);
+			drc_compress_output(state, p, nbyte, nch);
+		}
 	}
+}
 
-	pd_write_index = (pd_write_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	pd_read_index = (pd_read_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	state->pre_delay_write_index = pd_write_index;
-	state->pre_delay_read_index = pd_read_index;
-
-	/* Only perform delay frames by early return here if not enabled */
-	if (!p->enabled)
-		return;
+static void multiband_drc_read(const struct audio_stream __sparse_cache *source,
+			       int idx, int32_t *buf, int samples)
+{
+	int16_t *x16;
+	int32_t *x32;
+	int i;
 
-	/* Process the input division (32 frames). */
-	if (!(pd_write_index & DRC_DIVISION_FRAMES_MASK)) {
-		drc_update_detector_average(state, p, 4, nch);
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 4, nch);
+	switch (source->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			x16 = audio_stream_read_frag_s16(source, idx + i);
+			buf[i] = *x16 << 16;
+		}
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32 << 8;
+		}
+		break;
+#endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			x32 = audio_stream_read_frag_s32(source, idx + i);
+			buf[i] = *x32;
+		}
+		break;
 	}
 }
-#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
-
-static void multiband_drc_process_deemp(struct multiband_drc_state *state,
-					int32_t *buf_src,
-					int32_t *buf_sink,
-					int enable_deemp,
-					int nch,
-					int nband)
-{
-	struct iir_state_df2t *deemp_s;
-	int32_t *buf_src_band;
-	int ch, band;
-	int32_t mix_out;
 
-	for (ch = 0; ch < nch; ch++) {
-		deemp_s = &state->deemphasis[ch];
+static void multiband_drc_write(struct audio_stream __sparse_cache *sink,
+				int idx, const int32_t *buf, int samples)
+{
+	int16_t *y16;
+	int32_t *y32;
+	int i;
 
-		buf_src_band = buf_src;
-		mix_out = 0;
-		for (band = 0; band < nband; band++) {
-			mix_out = sat_int32((int64_t)mix_out + *buf_src_band);
-			buf_src_band += PLATFORM_MAX_CHANNELS;
+	switch (sink->frame_fmt) {
+#if CONFIG_FORMAT_S16LE
+	case SOF_IPC_FRAME_S16_LE:
+		for (i = 0; i < samples; i++) {
+			y16 = audio_stream_write_frag_s16(sink, idx + i);
+			*y16 = sat_int16(Q_SHIFT_RND(buf[i], 31, 15));
 		}
-
-		if (enable_deemp)
-			*buf_sink = iir_df2t(deemp_s, mix_out);
-		else
-			*buf_sink = mix_out;
-
-		buf_src++;
-		buf_sink++;
+		break;
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	case SOF_IPC_FRAME_S24_4LE:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = sat_int24(Q_SHIFT_RND(buf[i], 31, 23));
+		}
+		break;
+#endif /* CONFIG_FORMAT_S24LE */
+	default:
+		for (i = 0; i < samples; i++) {
+			y32 = audio_stream_write_frag_s32(sink, idx + i);
+			*y32 = buf[i];
+		}
+		break;
 	}
 }
 
- /* This graph illustrates the buffers declared in the following default functions, as the example
-  * of a 3-band Multiband DRC:
+ /* This graph illustrates the buffers used in the processing function, as the
+  * example of a 3-band Multiband DRC:
   *
-  *            :buf_src[nch]                            :buf_drc_sink[nch*nband]
+  *            :block_buf[0]                            :block_buf[0..nband-1]
   *            :                                        :
   *            :                           o-[]-> DRC0 -[]--o
   *            :                           | :          :   |
@@ -199,221 +193,78 @@ static void multiband_drc_process_deemp(struct multiband_drc_state *state,
   *                                        | :          :   |               :
   *                                        o-[]-> DRC2 -[]--o               :
   *                                          :                              :
-  *                                          :buf_drc_src[nch*nband]        :buf_sink[nch]
+  *                                          :block_buf[0..nband-1]         :block_buf[0]
+  *
+  * The period is processed in blocks of up to MULTIBAND_DRC_BLOCK_FRAMES frames
+  * aligned to the DRC divisions. A block goes through all the stages while the
+  * band buffers are in cache. The stages keep their own states so the output
+  * is the same as when the frames are processed one at a time.
   */
-#if CONFIG_FORMAT_S16LE
-static void multiband_drc_s16_default(const struct comp_dev *dev,
-				      const struct audio_stream __sparse_cache *source,
-				      struct audio_stream __sparse_cache *sink,
-				      uint32_t frames)
+static void multiband_drc_default(const struct comp_dev *dev,
+				  const struct audio_stream __sparse_cache *source,
+				  struct audio_stream __sparse_cache *sink,
+				  uint32_t frames)
 {
 	struct multiband_drc_comp_data *cd = comp_get_drvdata(dev);
 	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
-	int16_t *x = source->r_ptr;
-	int16_t *y = sink->w_ptr;
-	int band;
-	int nbuf;
-	int npcm;
-	int ch;
-	int i;
+	int32_t **band_buf = state->block_buf;
+	int32_t *buf = state->block_buf[0];
+	int32_t mix_out;
+	int nbyte = source->frame_fmt == SOF_IPC_FRAME_S16_LE ? 2 : 4;
 	int nch = source->channels;
 	int nband = cd->config->num_bands;
 	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s16(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s16(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x << 16;
-				x++;
-			}
-
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s16_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
-
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
-
-			for (ch = 0; ch < nch; ch++) {
-				*y = sat_int16(Q_SHIFT_RND(buf_sink[ch], 31, 15));
-				y++;
-			}
-		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
-	}
-}
-#endif /* CONFIG_FORMAT_S16LE */
-
-#if CONFIG_FORMAT_S24LE
-static void multiband_drc_s24_default(const struct comp_dev *dev,
-				      const struct audio_stream __sparse_cache *source,
-				      struct audio_stream __sparse_cache *sink,
-				      uint32_t frames)
-{
-	struct multiband_drc_comp_data *cd = comp_get_drvdata(dev);
-	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
-	int32_t *x = source->r_ptr;
-	int32_t *y = sink->w_ptr;
+	int idx = 0;
+	int samples;
 	int band;
-	int nbuf;
-	int npcm;
-	int ch;
-	int i;
-	int nch = source->channels;
-	int nband = cd->config->num_bands;
-	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s24(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s24(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x << 8;
-				x++;
-			}
-
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s32_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
-
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
-
-			for (ch = 0; ch < nch; ch++) {
-				*y = sat_int24(Q_SHIFT_RND(buf_sink[ch], 31, 23));
-				y++;
-			}
+	int i, n;
+
+	while (frames) {
+		/* The blocks end at the division ends of the band DRCs, the
+		 * pre-delay write index is the same in all bands.
+		 */
+		n = MIN(frames, MULTIBAND_DRC_BLOCK_FRAMES -
+			(state->drc[0].pre_delay_write_index & DRC_DIVISION_FRAMES_MASK));
+		samples = n * nch;
+
+		multiband_drc_read(source, idx, buf, samples);
+		if (enable_emp_deemp)
+			multiband_drc_iir(state->emphasis, nch, buf, n);
+
+		cd->crossover_split_block(state->crossover, nch, buf, band_buf, n);
+
+		for (band = 0; band < nband; band++)
+			multiband_drc_process_drc(&state->drc[band], &cd->config->drc_coef[band],
+						  band_buf[band], nbyte, nch, n);
+
+		for (i = 0; i < samples; i++) {
+			mix_out = 0;
+			for (band = 0; band < nband; band++)
+				mix_out = sat_int32((int64_t)mix_out + band_buf[band][i]);
+			buf[i] = mix_out;
 		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
-	}
-}
-#endif /* CONFIG_FORMAT_S24LE */
 
-#if CONFIG_FORMAT_S32LE
-static void multiband_drc_s32_default(const struct comp_dev *dev,
-				      const struct audio_stream __sparse_cache *source,
-				      struct audio_stream __sparse_cache *sink,
-				      uint32_t frames)
-{
-	struct multiband_drc_comp_data *cd = comp_get_drvdata(dev);
-	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
-	int32_t *x = source->r_ptr;
-	int32_t *y = sink->w_ptr;
-	int band;
-	int nbuf;
-	int npcm;
-	int ch;
-	int i;
-	int nch = source->channels;
-	int nband = cd->config->num_bands;
-	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s32(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s32(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x;
-				x++;
-			}
+		if (enable_emp_deemp)
+			multiband_drc_iir(state->deemphasis, nch, buf, n);
 
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s32_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
-
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
-
-			for (ch = 0; ch < nch; ch++) {
-				*y = buf_sink[ch];
-				y++;
-			}
-		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
+		multiband_drc_write(sink, idx, buf, samples);
+		idx += samples;
+		frames -= n;
 	}
 }
-#endif /* CONFIG_FORMAT_S32LE */
 
 const struct multiband_drc_proc_fnmap multiband_drc_proc_fnmap[] = {
 /* { SOURCE_FORMAT , PROCESSING FUNCTION } */
 #if CONFIG_FORMAT_S16LE
-	{ SOF_IPC_FRAME_S16_LE, multiband_drc_s16_default },
+	{ SOF_IPC_FRAME_S16_LE, multiband_drc_default },
 #endif /* CONFIG_FORMAT_S16LE */
 
 #if CONFIG_FORMAT_S24LE
-	{ SOF_IPC_FRAME_S24_4LE, multiband_drc_s24_default },
+	{ SOF_IPC_FRAME_S24_4LE, multiband_drc_default },
 #endif /* CONFIG_FORMAT_S24LE */
 
 #if CONFIG_FORMAT_S32LE
-	{ SOF_IPC_FRAME_S32_LE, multiband_drc_s32_default },
+	{ SOF_IPC_FRAME_S32_LE, multiband_drc_default },
 #endif /* CONFIG_FORMAT_S32LE */
 };
 
@@ -29,217 +29,288 @@
 #define BYTES_TO_S16_SAMPLES	1
 #define BYTES_TO_S32_SAMPLES	2
 
-#if CONFIG_PCM_CONVERTER_FORMAT_S16LE && CONFIG_PCM_CONVERTER_FORMAT_S24LE
+/*
+ * The conversion kernels below run on linear memory regions between buffer
+ * wraps. On x86 hosts (library, testbench) the kernels process blocks of
+ * samples with SSE2 or AVX2, the remaining samples and other architectures
+ * use the scalar code. All versions give the same output.
+ */
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define PCM_CONVERTER_SSE2
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PCM_CONVERTER_AVX2
+#endif
 
-static int pcm_convert_s16_to_s24(const struct audio_stream __sparse_cache *source,
-				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-				  uint32_t ooffset, uint32_t samples)
+/* Run a linear converter on the wrap-free regions of source and sink,
+ * in_shift and out_shift are log2 of the sample size in bytes.
+ */
+static inline int pcm_convert_chunks(const struct audio_stream __sparse_cache *source,
+				     uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+				     uint32_t ooffset, uint32_t samples, int in_shift,
+				     int out_shift, pcm_converter_lin_func converter)
 {
-	int16_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	char *src = (char *)source->r_ptr + (ioffset << in_shift);
+	char *dst = (char *)sink->w_ptr + (ooffset << out_shift);
+	uint32_t processed;
+	uint32_t nmax, n;
 
-	src += ioffset;
-	dst += ooffset;
 	for (processed = 0; processed < samples; processed += n) {
 		src = audio_stream_wrap(source, src);
 		dst = audio_stream_wrap(sink, dst);
 		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S16_SAMPLES;
+		nmax = audio_stream_bytes_without_wrap(source, src) >> in_shift;
 		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
+		nmax = audio_stream_bytes_without_wrap(sink, dst) >> out_shift;
 		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src << 8;
-			src++;
-			dst++;
-		}
+		converter(src, dst, n);
+		src += n << in_shift;
+		dst += n << out_shift;
 	}
 
 	return samples;
 }
 
-static int pcm_convert_s24_to_s16(const struct audio_stream __sparse_cache *source,
-				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-				  uint32_t ooffset, uint32_t samples)
+#ifdef PCM_CONVERTER_SSE2
+/* load 8 s16 samples sign extended to two vectors of s32 */
+static inline void pcm_sse2_load_s16(const int16_t *src, __m128i *lo, __m128i *hi)
 {
-	int32_t *src = source->r_ptr;
-	int16_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	__m128i in = _mm_loadu_si128((const __m128i *)src);
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S16_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int16(Q_SHIFT_RND(sign_extend_s24(*src), 23, 15));
-			src++;
-			dst++;
-		}
+	*lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+	*hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+}
+
+/* store two vectors of s32 to 8 s16 samples with saturation */
+static inline void pcm_sse2_store_s16(int16_t *dst, __m128i lo, __m128i hi)
+{
+	_mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(lo, hi));
+}
+
+static inline __m128i pcm_sse2_load_s32(const int32_t *src)
+{
+	return _mm_loadu_si128((const __m128i *)src);
+}
+
+static inline void pcm_sse2_store_s32(int32_t *dst, __m128i x)
+{
+	_mm_storeu_si128((__m128i *)dst, x);
+}
+
+static inline __m128i pcm_sse2_sign_extend_s24(__m128i x)
+{
+	return _mm_srai_epi32(_mm_slli_epi32(x, 8), 8);
+}
+
+/* Q_SHIFT_RND() for src_q - dst_q = shift + 1 */
+static inline __m128i pcm_sse2_shift_rnd(__m128i x, int shift)
+{
+	return _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(x, shift), _mm_set1_epi32(1)), 1);
+}
+
+/* sat_int16() in s32 container */
+static inline __m128i pcm_sse2_sat_s16(__m128i x)
+{
+	__m128i p = _mm_packs_epi32(x, x);
+
+	return _mm_srai_epi32(_mm_unpacklo_epi16(p, p), 16);
+}
+
+/* sat_int24() for the rounded s32 to s24 result, only INT24_MAX + 1 is
+ * out of range there.
+ */
+static inline __m128i pcm_sse2_sat_rnd_s24(__m128i x)
+{
+	return _mm_add_epi32(x, _mm_cmpeq_epi32(x, _mm_set1_epi32(1 << 23)));
+}
+#endif /* PCM_CONVERTER_SSE2 */
+
+#if CONFIG_PCM_CONVERTER_FORMAT_S16LE && CONFIG_PCM_CONVERTER_FORMAT_S24LE
+
+static void pcm_convert_s16_to_s24_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int16_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		pcm_sse2_load_s16(src + i, &lo, &hi);
+		pcm_sse2_store_s32(dst + i, _mm_slli_epi32(lo, 8));
+		pcm_sse2_store_s32(dst + i + 4, _mm_slli_epi32(hi, 8));
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] << 8;
+}
 
-	return samples;
+static void pcm_convert_s24_to_s16_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int16_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		lo = pcm_sse2_sign_extend_s24(pcm_sse2_load_s32(src + i));
+		hi = pcm_sse2_sign_extend_s24(pcm_sse2_load_s32(src + i + 4));
+		pcm_sse2_store_s16(dst + i, pcm_sse2_shift_rnd(lo, 7), pcm_sse2_shift_rnd(hi, 7));
+	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int16(Q_SHIFT_RND(sign_extend_s24(src[i]), 23, 15));
+}
+
+static int pcm_convert_s16_to_s24(const struct audio_stream __sparse_cache *source,
+				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+				  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S16_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s16_to_s24_lin);
+}
+
+static int pcm_convert_s24_to_s16(const struct audio_stream __sparse_cache *source,
+				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+				  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S16_SAMPLES, pcm_convert_s24_to_s16_lin);
 }
 
 #endif /* CONFIG_PCM_CONVERTER_FORMAT_S16LE && CONFIG_PCM_CONVERTER_FORMAT_S24LE */
 
 #if CONFIG_PCM_CONVERTER_FORMAT_S16LE && CONFIG_PCM_CONVERTER_FORMAT_S32LE
 
-static int pcm_convert_s16_to_s32(const struct audio_stream __sparse_cache *source,
-				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-				  uint32_t ooffset, uint32_t samples)
+static void pcm_convert_s16_to_s32_lin(const void *psrc, void *pdst, uint32_t samples)
 {
-	int16_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	const int16_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i in;
+
+	for (; i + 8 <= samples; i += 8) {
+		in = _mm_loadu_si128((const __m128i *)(src + i));
+		pcm_sse2_store_s32(dst + i, _mm_unpacklo_epi16(_mm_setzero_si128(), in));
+		pcm_sse2_store_s32(dst + i + 4, _mm_unpackhi_epi16(_mm_setzero_si128(), in));
+	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] << 16;
+}
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S16_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src << 16;
-			src++;
-			dst++;
-		}
+static void pcm_convert_s32_to_s16_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int16_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		lo = pcm_sse2_shift_rnd(pcm_sse2_load_s32(src + i), 15);
+		hi = pcm_sse2_shift_rnd(pcm_sse2_load_s32(src + i + 4), 15);
+		pcm_sse2_store_s16(dst + i, lo, hi);
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int16(Q_SHIFT_RND(src[i], 31, 15));
+}
 
-	return samples;
+static int pcm_convert_s16_to_s32(const struct audio_stream __sparse_cache *source,
+				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+				  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S16_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s16_to_s32_lin);
 }
 
 static int pcm_convert_s32_to_s16(const struct audio_stream __sparse_cache *source,
 				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
 				  uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int16_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S16_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int16(Q_SHIFT_RND(*src, 31, 15));
-			src++;
-			dst++;
-		}
-	}
-
-	return samples;
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S16_SAMPLES, pcm_convert_s32_to_s16_lin);
 }
 
 #endif /* CONFIG_PCM_CONVERTER_FORMAT_S16LE && CONFIG_PCM_CONVERTER_FORMAT_S32LE */
 
 #if CONFIG_PCM_CONVERTER_FORMAT_S24LE && CONFIG_PCM_CONVERTER_FORMAT_S32LE
 
-static int pcm_convert_s24_to_s32(const struct audio_stream __sparse_cache *source,
-				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-				  uint32_t ooffset, uint32_t samples)
+static void pcm_convert_s24_to_s32_lin(const void *psrc, void *pdst, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src << 8;
-			src++;
-			dst++;
-		}
+#ifdef PCM_CONVERTER_SSE2
+	for (; i + 4 <= samples; i += 4)
+		pcm_sse2_store_s32(dst + i, _mm_slli_epi32(pcm_sse2_load_s32(src + i), 8));
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] << 8;
+}
+
+static void pcm_convert_s32_to_s24_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i x;
+
+	for (; i + 4 <= samples; i += 4) {
+		x = pcm_sse2_shift_rnd(pcm_sse2_load_s32(src + i), 7);
+		pcm_sse2_store_s32(dst + i, pcm_sse2_sat_rnd_s24(x));
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int24(Q_SHIFT_RND(src[i], 31, 23));
+}
 
-	return samples;
+static void pcm_convert_s32_to_s24_be_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i x;
+
+	for (; i + 4 <= samples; i += 4) {
+		x = pcm_sse2_shift_rnd(pcm_sse2_load_s32(src + i), 7);
+		pcm_sse2_store_s32(dst + i, _mm_slli_epi32(pcm_sse2_sat_rnd_s24(x), 8));
+	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int24(Q_SHIFT_RND(src[i], 31, 23)) << 8;
 }
 
-static int pcm_convert_s32_to_s24(const struct audio_stream __sparse_cache *source,
+static int pcm_convert_s24_to_s32(const struct audio_stream __sparse_cache *source,
 				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
 				  uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int24(Q_SHIFT_RND(*src, 31, 23));
-			src++;
-			dst++;
-		}
-	}
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s24_to_s32_lin);
+}
 
-	return samples;
+static int pcm_convert_s32_to_s24(const struct audio_stream __sparse_cache *source,
+				  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+				  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s32_to_s24_lin);
 }
 
 static int pcm_convert_s32_to_s24_be(const struct audio_stream __sparse_cache *source,
 				     uint32_t ioffset, struct audio_stream __sparse_cache *sink,
 				     uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_samples_without_wrap_s32(source, src);
-		n = MIN(n, nmax);
-		nmax = audio_stream_samples_without_wrap_s32(sink, dst);
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int24(Q_SHIFT_RND(*src, 31, 23)) << 8;
-			src++;
-			dst++;
-		}
-	}
-
-	return samples;
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s32_to_s24_be_lin);
 }
 
 #endif /* CONFIG_PCM_CONVERTER_FORMAT_S24LE && CONFIG_PCM_CONVERTER_FORMAT_S32LE */
@@ -349,6 +420,79 @@ static int32_t _pcm_convert_i_to_f(int32_t src, int32_t pow)
 	return dst;
 }
 
+#ifdef PCM_CONVERTER_SSE2
+/* (float)(src * 2**-pow) of 4 samples, exact for up to 24 significant bits */
+static inline void pcm_sse2_i_to_f(int32_t *dst, __m128i src, int pow)
+{
+	__m128 scale = _mm_castsi128_ps(_mm_set1_epi32((127 - pow) << 23));
+
+	_mm_storeu_ps((float *)dst, _mm_mul_ps(_mm_cvtepi32_ps(src), scale));
+}
+
+/* Truncate magnitude of s32 samples to 24 significant bits as
+ * _pcm_convert_i_to_f() does, the float conversion is then exact.
+ */
+static inline __m128i pcm_sse2_trunc_s32(__m128i src)
+{
+	__m128i sign = _mm_srai_epi32(src, 31);
+	__m128i abs = _mm_sub_epi32(_mm_xor_si128(src, sign), sign);
+	__m128i ones = abs;
+
+	/* set all bits below the most significant one */
+	ones = _mm_or_si128(ones, _mm_srli_epi32(ones, 1));
+	ones = _mm_or_si128(ones, _mm_srli_epi32(ones, 2));
+	ones = _mm_or_si128(ones, _mm_srli_epi32(ones, 4));
+	ones = _mm_or_si128(ones, _mm_srli_epi32(ones, 8));
+	ones = _mm_or_si128(ones, _mm_srli_epi32(ones, 16));
+	abs = _mm_andnot_si128(_mm_srli_epi32(ones, 24), abs);
+
+	return _mm_sub_epi32(_mm_xor_si128(abs, sign), sign);
+}
+#endif /* PCM_CONVERTER_SSE2 */
+
+#ifdef PCM_CONVERTER_AVX2
+/* _pcm_convert_f_to_i() of 8 samples, the shifts need AVX2 per lane counts */
+static inline __m256i pcm_avx2_f_to_i(__m256i src, int pow)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi32(1);
+	__m256i sign = _mm256_srai_epi32(src, 31);
+	__m256i exponent, mantissa, a, b, dst, rnd;
+
+	exponent = _mm256_and_si256(_mm256_srli_epi32(src, 23), _mm256_set1_epi32(0xFF));
+	exponent = _mm256_add_epi32(exponent, _mm256_set1_epi32(pow - 127));
+	mantissa = _mm256_or_si256(_mm256_and_si256(src, _mm256_set1_epi32(MASK(22, 0))),
+				   _mm256_set1_epi32(BIT(23)));
+
+	/* _pcm_shift(mantissa, a), result saturates for a >= 8 */
+	a = _mm256_sub_epi32(exponent, _mm256_set1_epi32(23));
+	dst = _mm256_blendv_epi8(_mm256_srlv_epi32(mantissa, _mm256_sub_epi32(zero, a)),
+				 _mm256_sllv_epi32(mantissa, a),
+				 _mm256_cmpgt_epi32(a, _mm256_set1_epi32(-1)));
+	dst = _mm256_blendv_epi8(dst, _mm256_set1_epi32(INT32_MAX),
+				 _mm256_cmpgt_epi32(a, _mm256_set1_epi32(7)));
+
+	/* rounding bit _pcm_shift(mantissa, b) & 1, only bit 0 is needed */
+	b = _mm256_add_epi32(a, one);
+	rnd = _mm256_blendv_epi8(_mm256_srlv_epi32(mantissa, _mm256_sub_epi32(zero, b)),
+				 _mm256_sllv_epi32(mantissa, b),
+				 _mm256_cmpgt_epi32(b, _mm256_set1_epi32(-1)));
+	rnd = _mm256_blendv_epi8(rnd, one, _mm256_cmpgt_epi32(b, _mm256_set1_epi32(7)));
+	rnd = _mm256_and_si256(rnd, one);
+	rnd = _mm256_and_si256(rnd, _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(9), b),
+						    sign));
+	dst = _mm256_add_epi32(dst, rnd);
+
+	/* copy sign to dst */
+	return _mm256_sub_epi32(_mm256_xor_si256(dst, sign), sign);
+}
+
+static inline __m256i pcm_avx2_load(const int32_t *src)
+{
+	return _mm256_loadu_si256((const __m256i *)src);
+}
+#endif /* PCM_CONVERTER_AVX2 */
+
 #endif /* CONFIG_PCM_CONVERTER_FORMAT_FLOAT && (CONFIG_PCM_CONVERTER_FORMAT_S16LE || CONFIG_PCM_CONVERTER_FORMAT_S24LE || CONFIG_PCM_CONVERTER_FORMAT_S32LE) */
 
 #if CONFIG_PCM_CONVERTER_FORMAT_FLOAT && CONFIG_PCM_CONVERTER_FORMAT_S16LE
@@ -357,11 +501,20 @@ static void pcm_convert_s16_to_f_lin(const void *psrc, void *pdst,
 {
 	const int16_t *src = psrc;
 	int32_t *dst = pdst; /* float */
-	int i;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		pcm_sse2_load_s16(src + i, &lo, &hi);
+		pcm_sse2_i_to_f(dst + i, lo, 15);
+		pcm_sse2_i_to_f(dst + i + 4, hi, 15);
+	}
+#endif
 
 	/* s16 is in format Q1.15 so during */
 	/* conversion subtract 15 from exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = _pcm_convert_i_to_f(src[i], 15);
 }
 
@@ -370,11 +523,20 @@ static void pcm_convert_f_to_s16_lin(const void *psrc, void *pdst,
 {
 	const int32_t *src = psrc; /* float */
 	int16_t *dst = pdst;
-	int i;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_AVX2
+	__m256i x;
+
+	for (; i + 8 <= samples; i += 8) {
+		x = pcm_avx2_f_to_i(pcm_avx2_load(src + i), 15);
+		pcm_sse2_store_s16(dst + i, _mm256_castsi256_si128(x),
+				   _mm256_extracti128_si256(x, 1));
+	}
+#endif
 
 	/* s16 is in format Q1.15 so during */
 	/* conversion add 15 from exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = sat_int16(_pcm_convert_f_to_i(src[i], 15));
 }
 
@@ -401,11 +563,16 @@ static void pcm_convert_s24_to_f_lin(const void *psrc, void *pdst,
 {
 	const int32_t *src = psrc;
 	int32_t *dst = pdst; /* float */
-	int i;
+	uint32_t i = 0;
+
+#ifdef PCM_CONVERTER_SSE2
+	for (; i + 4 <= samples; i += 4)
+		pcm_sse2_i_to_f(dst + i, pcm_sse2_sign_extend_s24(pcm_sse2_load_s32(src + i)), 23);
+#endif
 
 	/* s24 is in format Q1.23 so during */
 	/* conversion subtract 23 to exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = _pcm_convert_i_to_f(sign_extend_s24(src[i]), 23);
 }
 
@@ -414,11 +581,21 @@ static void pcm_convert_f_to_s24_lin(const void *psrc, void *pdst,
 {
 	const int32_t *src = psrc; /* float */
 	int32_t *dst = pdst;
-	int i;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_AVX2
+	__m256i x;
+
+	for (; i + 8 <= samples; i += 8) {
+		x = pcm_avx2_f_to_i(pcm_avx2_load(src + i), 23);
+		x = _mm256_min_epi32(x, _mm256_set1_epi32(INT24_MAXVALUE));
+		x = _mm256_max_epi32(x, _mm256_set1_epi32(INT24_MINVALUE));
+		_mm256_storeu_si256((__m256i *)(dst + i), x);
+	}
+#endif
 
 	/* s24 is in format Q1.23 so during */
 	/* conversion add 23 to exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = sat_int24(_pcm_convert_f_to_i(src[i], 23));
 }
 
@@ -445,11 +622,16 @@ static void pcm_convert_s32_to_f_lin(const void *psrc, void *pdst,
 {
 	const int32_t *src = psrc;
 	int32_t *dst = pdst; /* float */
-	int i;
+	uint32_t i = 0;
+
+#ifdef PCM_CONVERTER_SSE2
+	for (; i + 4 <= samples; i += 4)
+		pcm_sse2_i_to_f(dst + i, pcm_sse2_trunc_s32(pcm_sse2_load_s32(src + i)), 31);
+#endif
 
 	/* s32 is in format Q1.31 so during */
 	/* conversion subtract 31 to exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = _pcm_convert_i_to_f(src[i], 31);
 }
 
@@ -458,11 +640,17 @@ static void pcm_convert_f_to_s32_lin(const void *psrc, void *pdst,
 {
 	const int32_t *src = psrc; /* float */
 	int32_t *dst = pdst;
-	int i;
+	uint32_t i = 0;
+
+#ifdef PCM_CONVERTER_AVX2
+	for (; i + 8 <= samples; i += 8)
+		_mm256_storeu_si256((__m256i *)(dst + i),
+				    pcm_avx2_f_to_i(pcm_avx2_load(src + i), 31));
+#endif
 
 	/* s32 is in format Q1.31 so during */
 	/* conversion add 31 to exponent */
-	for (i = 0; i < samples; i++)
+	for (; i < samples; i++)
 		dst[i] = _pcm_convert_f_to_i(src[i], 31);
 }
 
@@ -528,180 +716,159 @@ const struct pcm_func_map pcm_func_map[] = {
 const size_t pcm_func_count = ARRAY_SIZE(pcm_func_map);
 
 #if CONFIG_PCM_CONVERTER_FORMAT_S16_C16_AND_S16_C32
-static int pcm_convert_s16_c16_to_s16_c32(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-					  uint32_t ooffset, uint32_t samples)
+static void pcm_convert_s16_c16_to_s16_c32_lin(const void *psrc, void *pdst, uint32_t samples)
 {
-	int16_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	const int16_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		pcm_sse2_load_s16(src + i, &lo, &hi);
+		pcm_sse2_store_s32(dst + i, lo);
+		pcm_sse2_store_s32(dst + i + 4, hi);
+	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i];
+}
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S16_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src;
-			src++;
-			dst++;
-		}
+static void pcm_convert_s16_c32_to_s16_c16_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int16_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i lo, hi;
+
+	for (; i + 8 <= samples; i += 8) {
+		/* sign extend the low 16 bits, the pack is then exact */
+		lo = _mm_srai_epi32(_mm_slli_epi32(pcm_sse2_load_s32(src + i), 16), 16);
+		hi = _mm_srai_epi32(_mm_slli_epi32(pcm_sse2_load_s32(src + i + 4), 16), 16);
+		pcm_sse2_store_s16(dst + i, lo, hi);
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] & 0xffff;
+}
 
-	return samples;
+static int pcm_convert_s16_c16_to_s16_c32(const struct audio_stream __sparse_cache *source,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
+					  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S16_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s16_c16_to_s16_c32_lin);
 }
 
 static int pcm_convert_s16_c32_to_s16_c16(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
 					  uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int16_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S16_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src & 0xffff;
-			src++;
-			dst++;
-		}
-	}
-
-	return samples;
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S16_SAMPLES, pcm_convert_s16_c32_to_s16_c16_lin);
 }
 #endif
 #if CONFIG_PCM_CONVERTER_FORMAT_S16_C32_AND_S32_C32
-static int pcm_convert_s16_c32_to_s32_c32(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-					  uint32_t ooffset, uint32_t samples)
+static void pcm_convert_s16_c32_to_s32_c32_lin(const void *psrc, void *pdst, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src << 16;
-			src++;
-			dst++;
-		}
+#ifdef PCM_CONVERTER_SSE2
+	for (; i + 4 <= samples; i += 4)
+		pcm_sse2_store_s32(dst + i, _mm_slli_epi32(pcm_sse2_load_s32(src + i), 16));
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] << 16;
+}
+
+static void pcm_convert_s32_c32_to_s16_c32_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i x;
+
+	for (; i + 4 <= samples; i += 4) {
+		x = pcm_sse2_shift_rnd(pcm_sse2_load_s32(src + i), 15);
+		pcm_sse2_store_s32(dst + i, pcm_sse2_sat_s16(x));
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int16(Q_SHIFT_RND(src[i], 31, 15));
+}
 
-	return samples;
+static int pcm_convert_s16_c32_to_s32_c32(const struct audio_stream __sparse_cache *source,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
+					  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s16_c32_to_s32_c32_lin);
 }
 
 static int pcm_convert_s32_c32_to_s16_c32(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
 					  uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int16(Q_SHIFT_RND(*src, 31, 15));
-			src++;
-			dst++;
-		}
-	}
-
-	return samples;
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s32_c32_to_s16_c32_lin);
 }
 #endif
 #if CONFIG_PCM_CONVERTER_FORMAT_S16_C32_AND_S24_C32
-static int pcm_convert_s16_c32_to_s24_c32(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
-					  uint32_t ooffset, uint32_t samples)
+static void pcm_convert_s16_c32_to_s24_c32_lin(const void *psrc, void *pdst, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
 
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = *src << 8;
-			src++;
-			dst++;
-		}
+#ifdef PCM_CONVERTER_SSE2
+	for (; i + 4 <= samples; i += 4)
+		pcm_sse2_store_s32(dst + i, _mm_slli_epi32(pcm_sse2_load_s32(src + i), 8));
+#endif
+	for (; i < samples; i++)
+		dst[i] = src[i] << 8;
+}
+
+static void pcm_convert_s24_c32_to_s16_c32_lin(const void *psrc, void *pdst, uint32_t samples)
+{
+	const int32_t *src = psrc;
+	int32_t *dst = pdst;
+	uint32_t i = 0;
+#ifdef PCM_CONVERTER_SSE2
+	__m128i x;
+
+	for (; i + 4 <= samples; i += 4) {
+		x = pcm_sse2_sign_extend_s24(pcm_sse2_load_s32(src + i));
+		pcm_sse2_store_s32(dst + i, pcm_sse2_sat_s16(pcm_sse2_shift_rnd(x, 7)));
 	}
+#endif
+	for (; i < samples; i++)
+		dst[i] = sat_int16(Q_SHIFT_RND(sign_extend_s24(src[i] & 0xffffff), 23, 15));
+}
 
-	return samples;
+static int pcm_convert_s16_c32_to_s24_c32(const struct audio_stream __sparse_cache *source,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
+					  uint32_t ooffset, uint32_t samples)
+{
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s16_c32_to_s24_c32_lin);
 }
 
 static int pcm_convert_s24_c32_to_s16_c32(const struct audio_stream __sparse_cache *source,
-					  uint32_t ioffset, struct audio_stream __sparse_cache *sink,
+					  uint32_t ioffset,
+					  struct audio_stream __sparse_cache *sink,
 					  uint32_t ooffset, uint32_t samples)
 {
-	int32_t *src = source->r_ptr;
-	int32_t *dst = sink->w_ptr;
-	int processed;
-	int nmax, i, n;
-
-	src += ioffset;
-	dst += ooffset;
-	for (processed = 0; processed < samples; processed += n) {
-		src = audio_stream_wrap(source, src);
-		dst = audio_stream_wrap(sink, dst);
-		n = samples - processed;
-		nmax = audio_stream_bytes_without_wrap(source, src) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		nmax = audio_stream_bytes_without_wrap(sink, dst) >> BYTES_TO_S32_SAMPLES;
-		n = MIN(n, nmax);
-		for (i = 0; i < n; i++) {
-			*dst = sat_int16(Q_SHIFT_RND(sign_extend_s24(*src & 0xffffff), 23, 15));
-			src++;
-			dst++;
-		}
-	}
-
-	return samples;
+	return pcm_convert_chunks(source, ioffset, sink, ooffset, samples, BYTES_TO_S32_SAMPLES,
+				  BYTES_TO_S32_SAMPLES, pcm_convert_s24_c32_to_s16_c32_lin);
 }
 #endif
 
@@ -11,6 +11,7 @@
 #include <sof/ipc/msg.h>
 #include <rtos/interrupt.h>
 #include <sof/lib/mm_heap.h>
+#include <sof/lib/slab.h>
 #include <sof/lib/uuid.h>
 #include <sof/compiler_attributes.h>
 #include <sof/list.h>
@@ -198,6 +199,7 @@ int pipeline_connect(struct comp_dev *comp, struct comp_buffer *buffer,
 	comp_list = comp_buffer_list(comp, dir);
 	buffer_attach(buffer, comp_list, dir);
 	buffer_set_comp(buffer, comp, dir);
+	pipeline_copy_list_invalidate(comp->pipeline);
 
 	irq_local_enable(flags);
 
@@ -219,6 +221,7 @@ void pipeline_disconnect(struct comp_dev *comp, struct comp_buffer *buffer, int
 	comp_list = comp_buffer_list(comp, dir);
 	buffer_detach(buffer, comp_list, dir);
 	buffer_set_comp(buffer, NULL, dir);
+	pipeline_copy_list_invalidate(comp->pipeline);
 
 	irq_local_enable(flags);
 }
@@ -236,13 +239,16 @@ int pipeline_free(struct pipeline *p)
 	/* remove from any scheduling */
 	if (p->pipe_task) {
 		schedule_task_free(p->pipe_task);
-		rfree(p->pipe_task);
+		slab_free(SOF_MEM_ZONE_RUNTIME, pipeline_task_get(p->pipe_task),
+			  sizeof(struct pipeline_task));
 	}
 
 	ipc_msg_free(p->msg);
 
 	pipeline_posn_offset_put(p->posn_offset);
 
+	rfree(p->copy_list);
+
 	/* now free the pipeline */
 	rfree(p);
 
@@ -359,6 +365,9 @@ static int pipeline_comp_reset(struct comp_dev *current,
 		}
 	}
 
+	/* the direction may change with the next params */
+	pipeline_copy_list_invalidate(p_current);
+
 	err = comp_reset(current);
 	if (err < 0 || err == PPL_STATUS_PATH_STOP)
 		return err;
@@ -321,6 +321,9 @@ static int pipeline_comp_prepare(struct comp_dev *current,
 	if (err < 0)
 		return err;
 
+	/* on failure pipeline_copy() keeps walking the graph */
+	pipeline_copy_list_build(current->pipeline);
+
 	err = comp_prepare(current);
 	if (err < 0 || err == PPL_STATUS_PATH_STOP)
 		return err;
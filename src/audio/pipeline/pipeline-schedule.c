@@ -10,6 +10,7 @@
 #include <sof/audio/pipeline.h>
 #include <rtos/interrupt.h>
 #include <sof/lib/agent.h>
+#include <sof/lib/slab.h>
 #include <sof/list.h>
 #include <sof/schedule/ll_schedule.h>
 #include <sof/schedule/schedule.h>
@@ -228,15 +229,14 @@ static struct task *pipeline_task_init(struct pipeline *p, uint32_t type)
 {
 	struct pipeline_task *task = NULL;
 
-	task = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
-		       sizeof(*task));
+	task = slab_alloc(SOF_MEM_ZONE_RUNTIME, sizeof(*task));
 	if (!task)
 		return NULL;
 
 	if (schedule_task_init_ll(&task->task, SOF_UUID(pipe_task_uuid), type,
 				  p->priority, pipeline_task,
 				  p, p->core, 0) < 0) {
-		rfree(task);
+		slab_free(SOF_MEM_ZONE_RUNTIME, task, sizeof(*task));
 		return NULL;
 	}
 
@@ -8,6 +8,8 @@
 #include <sof/audio/buffer.h>
 #include <sof/audio/component_ext.h>
 #include <sof/audio/pipeline.h>
+#include <rtos/alloc.h>
+#include <rtos/bit.h>
 #include <sof/lib/dai.h>
 #include <rtos/wait.h>
 #include <sof/list.h>
@@ -109,6 +111,174 @@ static int pipeline_comp_copy(struct comp_dev *current,
 	return err;
 }
 
+/* components the walk goes to from current, same as with skip_incomplete */
+static struct comp_dev *pipeline_copy_list_next(struct comp_dev *start,
+						struct list_item *clist, int dir)
+{
+	struct comp_buffer *buffer = buffer_from_list(clist, struct comp_buffer, dir);
+	struct comp_dev *next = buffer_get_comp(buffer, dir);
+
+	if (!next || !next->pipeline || !comp_is_single_pipeline(next, start))
+		return NULL;
+
+	return next;
+}
+
+static int pipeline_copy_list_index(struct pipeline *p, struct comp_dev *comp)
+{
+	int i;
+
+	for (i = 0; i < p->copy_count; i++)
+		if (p->copy_list[i].comp == comp)
+			return i;
+
+	return -1;
+}
+
+/* Add current after all components reached through it, depth first. The
+ * downstream walk visits the sinks in reverse, so that reversing the list
+ * gives the order of the walk for pipelines without merging paths.
+ */
+static int pipeline_copy_list_add(struct pipeline *p, struct comp_dev *start,
+				  struct comp_dev *current, int dir, int depth)
+{
+	struct comp_dev *next;
+	struct list_item *clist;
+	int ret;
+
+	/* a component reached over more than one path is added once */
+	if (pipeline_copy_list_index(p, current) >= 0)
+		return 0;
+
+	if (depth == PPL_COPY_LIST_SIZE)
+		return -ENOSPC;
+
+	if (dir == PPL_DIR_DOWNSTREAM) {
+		list_for_item_prev(clist, comp_buffer_list(current, dir)) {
+			next = pipeline_copy_list_next(start, clist, dir);
+			ret = next ? pipeline_copy_list_add(p, start, next, dir, depth + 1) : 0;
+			if (ret < 0)
+				return ret;
+		}
+	} else {
+		list_for_item(clist, comp_buffer_list(current, dir)) {
+			next = pipeline_copy_list_next(start, clist, dir);
+			ret = next ? pipeline_copy_list_add(p, start, next, dir, depth + 1) : 0;
+			if (ret < 0)
+				return ret;
+		}
+	}
+
+	if (p->copy_count == PPL_COPY_LIST_SIZE)
+		return -ENOSPC;
+
+	p->copy_list[p->copy_count++].comp = current;
+
+	return 0;
+}
+
+int pipeline_copy_list_build(struct pipeline *p)
+{
+	struct pipeline_copy_entry *entry;
+	struct pipeline_copy_entry tmp;
+	struct comp_dev *start;
+	struct comp_dev *prev;
+	struct list_item *clist;
+	int back_dir;
+	int dir;
+	int ret;
+	int i;
+
+	if (p->copy_list_valid)
+		return 0;
+
+	if (!p->source_comp || !p->sink_comp)
+		return -EINVAL;
+
+	if (!p->copy_list) {
+		p->copy_list = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+				       sizeof(*p->copy_list) * PPL_COPY_LIST_SIZE);
+		if (!p->copy_list)
+			return -ENOMEM;
+	}
+
+	if (p->source_comp->direction == SOF_IPC_STREAM_PLAYBACK) {
+		dir = PPL_DIR_UPSTREAM;
+		start = p->sink_comp;
+	} else {
+		dir = PPL_DIR_DOWNSTREAM;
+		start = p->source_comp;
+	}
+
+	p->copy_count = 0;
+	ret = pipeline_copy_list_add(p, start, start, dir, 0);
+	if (ret < 0) {
+		pipe_warn(p, "pipeline_copy_list_build(): ret = %d, graph walk is used",
+			  ret);
+		return ret;
+	}
+
+	/* the sources of a component come before it */
+	if (dir == PPL_DIR_DOWNSTREAM)
+		for (i = 0; i < p->copy_count / 2; i++) {
+			tmp = p->copy_list[i];
+			p->copy_list[i] = p->copy_list[p->copy_count - 1 - i];
+			p->copy_list[p->copy_count - 1 - i] = tmp;
+		}
+
+	/* the listed components the walk goes to the component from */
+	back_dir = dir == PPL_DIR_DOWNSTREAM ? PPL_DIR_UPSTREAM : PPL_DIR_DOWNSTREAM;
+	for (i = 0; i < p->copy_count; i++) {
+		entry = &p->copy_list[i];
+		entry->reached_from = 0;
+		if (entry->comp == start)
+			continue;
+
+		list_for_item(clist, comp_buffer_list(entry->comp, back_dir)) {
+			prev = pipeline_copy_list_next(start, clist, back_dir);
+			ret = prev ? pipeline_copy_list_index(p, prev) : -1;
+			if (ret >= 0)
+				entry->reached_from |= BIT(ret);
+		}
+	}
+
+	p->copy_list_valid = true;
+
+	return 0;
+}
+
+/* Copy components in the flat list order. As in the graph walk a component
+ * is copied if it is active and it is the start of the walk or the walk
+ * reaches it from a copied component.
+ */
+static int pipeline_copy_list_run(struct pipeline *p, int dir)
+{
+	struct pipeline_copy_entry *list = p->copy_list;
+	uint32_t run = 0;
+	int err = 0;
+	int i;
+	int n;
+
+	/* in the walk direction, the upstream walk goes against the list */
+	for (n = 0; n < p->copy_count; n++) {
+		i = dir == PPL_DIR_DOWNSTREAM ? n : p->copy_count - 1 - n;
+		if (comp_is_active(list[i].comp) &&
+		    (!list[i].reached_from || (run & list[i].reached_from)))
+			run |= BIT(i);
+	}
+
+	for (i = 0; i < p->copy_count; i++) {
+		if (!(run & BIT(i)))
+			continue;
+
+		err = comp_copy(list[i].comp);
+		if (err < 0 || err == PPL_STATUS_PATH_STOP)
+			break;
+	}
+
+	return err;
+}
+
 /* Copy data across all pipeline components.
  * For capture pipelines it always starts from source component
  * and continues downstream and for playback pipelines it first
@@ -137,7 +307,10 @@ int pipeline_copy(struct pipeline *p)
 	data.start = start;
 	data.p = p;
 
-	ret = walk_ctx.comp_func(start, NULL, &walk_ctx, dir);
+	if (p->copy_list_valid && !p->copy_walk)
+		ret = pipeline_copy_list_run(p, dir);
+	else
+		ret = walk_ctx.comp_func(start, NULL, &walk_ctx, dir);
 	if (ret < 0)
 		pipe_err(p, "pipeline_copy(): ret = %d, start->comp.id = %u, dir = %u",
 			 ret, dev_comp_id(start), dir);
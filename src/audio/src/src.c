@@ -210,7 +210,8 @@ static int src_buffer_lengths(struct comp_dev *dev, struct comp_data *cd,
 		a->sbuf_length += a->sbuf_length >> 3;
 	}
 
-	a->src_multich = a->fir_s1 + a->fir_s2 + a->out_s1 + a->out_s2;
+	a->src_multich = (a->fir_s1 + a->fir_s2) * SRC_FIR_DELAY_COPIES +
+		a->out_s1 + a->out_s2;
 	a->total = a->sbuf_length + a->src_multich;
 
 	return 0;
@@ -248,7 +249,7 @@ static int init_stages(struct src_stage *stage1, struct src_stage *stage2,
 	src->state1.out_delay_size = p->out_s1;
 	src->state1.fir_delay = delay_lines_start;
 	src->state1.out_delay =
-		src->state1.fir_delay + src->state1.fir_delay_size;
+		src->state1.fir_delay + src->state1.fir_delay_size * SRC_FIR_DELAY_COPIES;
 	/* Initialize to last ensures that circular wrap cannot happen
 	 * mid-frame. The size is multiple of channels count.
 	 */
@@ -260,7 +261,7 @@ static int init_stages(struct src_stage *stage1, struct src_stage *stage2,
 		src->state2.fir_delay =
 			src->state1.out_delay + src->state1.out_delay_size;
 		src->state2.out_delay =
-			src->state2.fir_delay + src->state2.fir_delay_size;
+			src->state2.fir_delay + src->state2.fir_delay_size * SRC_FIR_DELAY_COPIES;
 		/* Initialize to last ensures that circular wrap cannot happen
 		 * mid-frame. The size is multiple of channels count.
 		 */
@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* AVX2 optimized code parts for SRC in x86 host builds */
+
+#include <sof/audio/src/src_config.h>
+
+#if SRC_X86
+
+#include <sof/audio/format.h>
+#include <sof/audio/src/src.h>
+#include <sof/math/numbers.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The FIR delay line is followed by a copy of itself and every input sample
+ * is written to both. A subfilter reads its taps_x_nch words as one block
+ * starting from the last channel of the newest frame, and the block never
+ * wraps. Word w of the block is tap w / nch of channel nch - 1 - w % nch.
+ *
+ * The block is processed eight words at a time with the products summed
+ * exactly in 64 bit lanes. With 1, 2, 4 or 8 channels a lane always gets the
+ * same channel, so the coefficients only need to be repeated to the lanes
+ * and the lanes are added to channels in the end. Two output phases are
+ * computed per pass to keep more independent sums in flight. Other channel
+ * counts use a plain C loop over the same block.
+ */
+
+/* Number of output phases i.e. subfilters computed per pass */
+#define SRC_X86_PHASES	2
+
+#if SRC_SHORT /* 16 bit coefficients version */
+
+#define SRC_X86_QSHIFT	15 /* Q2.46 -> Q2.31 */
+
+#define src_coef_t	int16_t
+
+/* Coefficients for words w .. w + 3 of block as 32 bit lanes */
+static inline __m128i src_x86_coef(const int16_t *coef, int w, int nch)
+{
+	__m128i c;
+
+	switch (nch) {
+	case 1:
+		return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)&coef[w]));
+	case 2:
+		c = _mm_cvtepi16_epi32(_mm_cvtsi32_si128(*(const int32_t *)&coef[w >> 1]));
+		return _mm_unpacklo_epi32(c, c);
+	default:
+		return _mm_set1_epi32(coef[w / nch]);
+	}
+}
+
+static inline int32_t src_x86_coef_scalar(const int16_t *coef, int tap)
+{
+	return coef[tap];
+}
+
+#else /* 32bit coefficients version */
+
+#define SRC_X86_QSHIFT	23 /* Qx.54 -> Qx.31 */
+
+#define src_coef_t	int32_t
+
+/* Coefficients for words w .. w + 3 of block as 32 bit lanes, the Q1.31
+ * coefficients are shifted to Q1.23 as in the generic version.
+ */
+static inline __m128i src_x86_coef(const int32_t *coef, int w, int nch)
+{
+	__m128i c;
+
+	switch (nch) {
+	case 1:
+		c = _mm_loadu_si128((const __m128i *)&coef[w]);
+		break;
+	case 2:
+		c = _mm_loadl_epi64((const __m128i *)&coef[w >> 1]);
+		c = _mm_unpacklo_epi32(c, c);
+		break;
+	default:
+		c = _mm_set1_epi32(coef[w / nch]);
+		break;
+	}
+
+	return _mm_srai_epi32(c, 8);
+}
+
+static inline int32_t src_x86_coef_scalar(const int32_t *coef, int tap)
+{
+	return coef[tap] >> 8;
+}
+
+#endif /* 32bit coefficients version */
+
+static inline __m256i src_x86_mac(__m256i acc, const int32_t *data, __m128i coef)
+{
+	__m256i d = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)data));
+
+	return _mm256_add_epi64(acc, _mm256_mul_epi32(d, _mm256_cvtepi32_epi64(coef)));
+}
+
+/* Filters nph phases with 1, 2, 4 or 8 channels. The block data[p] and
+ * coefficients coef[p] produce the nch output samples to out[p].
+ */
+static inline void src_x86_fir(int32_t *const data[], const src_coef_t *const coef[],
+			       int32_t *const out[], const int nph,
+			       const int taps_x_nch, const int shift,
+			       const int nch)
+{
+	__m256i acc[SRC_X86_PHASES][2];
+	int64_t lanes[8];
+	int64_t y[8];
+	const int qshift = SRC_X86_QSHIFT + shift;
+	const int32_t rnd = 1 << (qshift - 1); /* Half LSB */
+	int p;
+	int w;
+	int j;
+
+	for (p = 0; p < nph; p++) {
+		acc[p][0] = _mm256_setzero_si256();
+		acc[p][1] = _mm256_setzero_si256();
+	}
+
+	for (w = 0; w + 8 <= taps_x_nch; w += 8) {
+		for (p = 0; p < nph; p++) {
+			acc[p][0] = src_x86_mac(acc[p][0], &data[p][w],
+						src_x86_coef(coef[p], w, nch));
+			acc[p][1] = src_x86_mac(acc[p][1], &data[p][w + 4],
+						src_x86_coef(coef[p], w + 4, nch));
+		}
+	}
+
+	/* subfilter length is a multiple of four */
+	if (w < taps_x_nch)
+		for (p = 0; p < nph; p++)
+			acc[p][0] = src_x86_mac(acc[p][0], &data[p][w],
+						src_x86_coef(coef[p], w, nch));
+
+	for (p = 0; p < nph; p++) {
+		_mm256_storeu_si256((__m256i *)&lanes[0], acc[p][0]);
+		_mm256_storeu_si256((__m256i *)&lanes[4], acc[p][1]);
+
+		for (j = 0; j < nch; j++)
+			y[j] = rnd;
+
+		for (w = 0; w < 8; w++)
+			y[nch - 1 - w % nch] += lanes[w];
+
+		for (j = 0; j < nch; j++)
+			out[p][j] = sat_int32(y[j] >> qshift);
+	}
+}
+
+/* Any number of channels, one phase */
+static void src_x86_fir_nch(const int32_t *data, const src_coef_t *coef, int32_t *out,
+			    const int taps_x_nch, const int shift, const int nch)
+{
+	const int qshift = SRC_X86_QSHIFT + shift;
+	const int32_t rnd = 1 << (qshift - 1); /* Half LSB */
+	const int32_t *d;
+	int64_t y;
+	int i;
+	int j;
+	int t;
+
+	for (j = 0; j < nch; j++) {
+		y = rnd;
+		d = &data[nch - 1 - j];
+		for (i = 0, t = 0; i < taps_x_nch; i += nch, t++)
+			y += (int64_t)src_x86_coef_scalar(coef, t) * d[i];
+
+		out[j] = sat_int32(y >> qshift);
+	}
+}
+
+/* Runs all subfilters of the stage for one block of input */
+static void src_x86_filter(struct src_state *fir, struct src_stage *cfg, const int nch)
+{
+	int32_t *data[SRC_X86_PHASES];
+	const src_coef_t *coef[SRC_X86_PHASES];
+	int32_t *out[SRC_X86_PHASES];
+	int32_t *fir_delay = fir->fir_delay;
+	int32_t *fir_end = &fir->fir_delay[fir->fir_delay_size];
+	int32_t *out_delay_end = &fir->out_delay[fir->out_delay_size];
+	const size_t out_size = fir->out_delay_size * sizeof(int32_t);
+	const size_t fir_size = fir->fir_delay_size * sizeof(int32_t);
+	const int rewind = nch * (cfg->blk_in + (cfg->num_of_subfilters - 1) * cfg->idm);
+	const int nch_x_idm = nch * cfg->idm;
+	const int nch_x_odm = cfg->odm * nch;
+	const int taps_x_nch = cfg->subfilter_length * nch;
+	const bool vector = nch == 1 || nch == 2 || nch == 4 || nch == 8;
+	const src_coef_t *cp = cfg->coefs;
+	int32_t *rp;
+	int32_t *wp;
+	int nph;
+	int i;
+	int p;
+
+	rp = fir->fir_wp + rewind;
+	src_inc_wrap(&rp, fir_end, fir_size);
+	wp = fir->out_rp;
+	for (i = 0; i < cfg->num_of_subfilters; i += nph) {
+		nph = MIN(cfg->num_of_subfilters - i, SRC_X86_PHASES);
+		for (p = 0; p < nph; p++) {
+			/* Block starts from the last channel of the frame */
+			data[p] = rp - (nch - 1);
+			coef[p] = cp;
+			out[p] = wp;
+			wp += nch_x_odm;
+			cp += cfg->subfilter_length;
+			src_inc_wrap(&wp, out_delay_end, out_size);
+			rp -= nch_x_idm; /* Next sub-filter start */
+			src_dec_wrap(&rp, fir_delay, fir_size);
+		}
+
+		if (!vector) {
+			for (p = 0; p < nph; p++)
+				src_x86_fir_nch(data[p], coef[p], out[p], taps_x_nch,
+						cfg->shift, nch);
+		} else if (nph == SRC_X86_PHASES) {
+			src_x86_fir(data, coef, out, SRC_X86_PHASES, taps_x_nch, cfg->shift, nch);
+		} else {
+			src_x86_fir(data, coef, out, 1, taps_x_nch, cfg->shift, nch);
+		}
+	}
+}
+
+#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
+void src_polyphase_stage_cir(struct src_stage_prm *s)
+{
+	int i;
+	int n;
+	int m;
+	int n_wrap_buf;
+	int n_wrap_fir;
+	int n_min;
+
+	struct src_state *fir = s->state;
+	struct src_stage *cfg = s->stage;
+	int32_t *fir_delay = fir->fir_delay;
+	int32_t *out_delay_end = &fir->out_delay[fir->out_delay_size];
+	const size_t out_size = fir->out_delay_size * sizeof(int32_t);
+	const int nch = s->nch;
+	const int blk_in_words = nch * cfg->blk_in;
+	const int blk_out_words = nch * cfg->num_of_subfilters;
+	const size_t fir_size = fir->fir_delay_size * sizeof(int32_t);
+	const int fir_copy = fir->fir_delay_size;
+	int32_t *x_rptr = (int32_t *)s->x_rptr;
+	int32_t *y_wptr = (int32_t *)s->y_wptr;
+	int32_t *x_end_addr = (int32_t *)s->x_end_addr;
+	int32_t *y_end_addr = (int32_t *)s->y_end_addr;
+
+	for (n = 0; n < s->times; n++) {
+		/* Input data to delay line and its copy, for s24 format
+		 * s->shift is 8.
+		 */
+		m = blk_in_words;
+		while (m > 0) {
+			/* Number of words without circular wrap */
+			n_wrap_buf = x_end_addr - x_rptr;
+			n_wrap_fir = fir->fir_wp - fir->fir_delay + 1;
+			n_min = (n_wrap_fir < n_wrap_buf)
+				? n_wrap_fir : n_wrap_buf;
+			n_min = (m < n_min) ? m : n_min;
+			m -= n_min;
+			for (i = 0; i < n_min; i++) {
+				*fir->fir_wp = *x_rptr << s->shift;
+				fir->fir_wp[fir_copy] = *fir->fir_wp;
+				fir->fir_wp--;
+				x_rptr++;
+			}
+			/* Check for wrap */
+			src_dec_wrap(&fir->fir_wp, fir_delay, fir_size);
+			src_inc_wrap(&x_rptr, x_end_addr, s->x_size);
+		}
+
+		/* Filter */
+		src_x86_filter(fir, cfg, nch);
+
+		/* Output, for s24 format s->shift is 8 */
+		m = blk_out_words;
+		while (m > 0) {
+			n_wrap_fir = out_delay_end - fir->out_rp;
+			n_wrap_buf = y_end_addr - y_wptr;
+			n_min = (n_wrap_fir < n_wrap_buf)
+				? n_wrap_fir : n_wrap_buf;
+			n_min = (m < n_min) ? m : n_min;
+			m -= n_min;
+			for (i = 0; i < n_min; i++) {
+				*y_wptr = *fir->out_rp >> s->shift;
+				y_wptr++;
+				fir->out_rp++;
+			}
+			/* Check wrap */
+			src_inc_wrap(&y_wptr, y_end_addr, s->y_size);
+			src_inc_wrap(&fir->out_rp, out_delay_end, out_size);
+		}
+	}
+	s->x_rptr = x_rptr;
+	s->y_wptr = y_wptr;
+}
+#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
+
+#if CONFIG_FORMAT_S16LE
+void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
+{
+	int i;
+	int n;
+	int m;
+	int n_wrap_buf;
+	int n_wrap_fir;
+	int n_min;
+
+	struct src_state *fir = s->state;
+	struct src_stage *cfg = s->stage;
+	int32_t *fir_delay = fir->fir_delay;
+	int32_t *out_delay_end = &fir->out_delay[fir->out_delay_size];
+	const size_t out_size = fir->out_delay_size * sizeof(int32_t);
+	const int nch = s->nch;
+	const int blk_in_words = nch * cfg->blk_in;
+	const int blk_out_words = nch * cfg->num_of_subfilters;
+	const size_t fir_size = fir->fir_delay_size * sizeof(int32_t);
+	const int fir_copy = fir->fir_delay_size;
+	int16_t *x_rptr = (int16_t *)s->x_rptr;
+	int16_t *y_wptr = (int16_t *)s->y_wptr;
+	int16_t *x_end_addr = (int16_t *)s->x_end_addr;
+	int16_t *y_end_addr = (int16_t *)s->y_end_addr;
+
+	for (n = 0; n < s->times; n++) {
+		/* Input data to delay line and its copy, used fixed shift
+		 * by 16.
+		 */
+		m = blk_in_words;
+		while (m > 0) {
+			/* Number of words without circular wrap */
+			n_wrap_buf = x_end_addr - x_rptr;
+			n_wrap_fir = fir->fir_wp - fir->fir_delay + 1;
+			n_min = (n_wrap_fir < n_wrap_buf)
+				? n_wrap_fir : n_wrap_buf;
+			n_min = (m < n_min) ? m : n_min;
+			m -= n_min;
+			for (i = 0; i < n_min; i++) {
+				*fir->fir_wp = Q_SHIFT_LEFT(*x_rptr, 15, 31);
+				fir->fir_wp[fir_copy] = *fir->fir_wp;
+				fir->fir_wp--;
+				x_rptr++;
+			}
+			/* Check for wrap */
+			src_dec_wrap(&fir->fir_wp, fir_delay, fir_size);
+			src_inc_wrap_s16(&x_rptr, x_end_addr, s->x_size);
+		}
+
+		/* Filter */
+		src_x86_filter(fir, cfg, nch);
+
+		/* Output, use fixed shift by 16 */
+		m = blk_out_words;
+		while (m > 0) {
+			n_wrap_fir = out_delay_end - fir->out_rp;
+			n_wrap_buf = y_end_addr - y_wptr;
+			n_min = (n_wrap_fir < n_wrap_buf)
+				? n_wrap_fir : n_wrap_buf;
+			n_min = (m < n_min) ? m : n_min;
+			m -= n_min;
+			for (i = 0; i < n_min; i++) {
+				*y_wptr = sat_int16(Q_SHIFT_RND(*fir->out_rp, 31, 15));
+				y_wptr++;
+				fir->out_rp++;
+			}
+			/* Check wrap */
+			src_inc_wrap_s16(&y_wptr, y_end_addr, s->y_size);
+			src_inc_wrap(&fir->out_rp, out_delay_end, out_size);
+		}
+	}
+	s->x_rptr = x_rptr;
+	s->y_wptr = y_wptr;
+}
+#endif /* CONFIG_FORMAT_S16LE */
+
+#endif /* SRC_X86 */
@@ -5,6 +5,7 @@
 // Author: Seppo Ingalsuo <seppo.ingalsuo@linux.intel.com>
 
 #include <sof/common.h>
+#include <rtos/string.h>
 #include <sof/audio/audio_stream.h>
 #include <sof/audio/tdfb/tdfb_comp.h>
 #include <user/fir.h>
@@ -14,46 +15,50 @@
 
 #include <sof/math/fir_generic.h>
 
-static inline void tdfb_core(struct tdfb_comp_data *cd, int in_nch, int out_nch)
+/* The filters process blocks of TDFB_BLOCK_FRAMES samples of their input
+ * channel. The input and output channels are in separate blocks, so every
+ * filter runs over a linear buffer and its output is mixed to the output
+ * channels with one pass per channel. The filter state continues as with
+ * processing sample by sample, so the output is the same.
+ */
+static void tdfb_core(struct tdfb_comp_data *cd, int out_nch, int frames)
 {
 	struct fir_state_32x16 *filter;
-	int32_t y0;
-	int32_t y1;
-	int is2;
-	int is;
+	int32_t *x = &cd->fir_in[SOF_FIR_MAX_LENGTH - 1];
+	int32_t *y = cd->fir_out;
+	int32_t *out;
+	size_t bytes = frames * sizeof(int32_t);
 	int om;
 	int i;
+	int j;
 	int k;
 	const int num_filters = cd->config->num_filters;
 
-	/* Clear output mix*/
-	memset(cd->out, 0,  2 * out_nch * sizeof(int32_t));
+	/* Clear output mix */
+	for (k = 0; k < out_nch; k++)
+		memset(cd->block_out[k], 0, bytes);
 
 	/* Run and mix all filters to their output channel */
 	for (i = 0; i < num_filters; i++) {
-		is = cd->input_channel_select[i];
-		is2 = is + in_nch;
-		om = cd->output_channel_mix[i];
 		filter = &cd->fir[i];
-		/* Process sample and successive sample. This follows
-		 * optimized FIR version implementation that processes
-		 * two samples per call. The output is stored as Q5.27
-		 * to fit max. 16 filters sum to a channel.
+		om = cd->output_channel_mix[i];
+		memcpy_s(x, bytes, cd->block_in[cd->input_channel_select[i]], bytes);
+		fir_32x16_block(filter, x, y, frames);
+
+		/* The output is stored as Q5.27 to fit max. 16 filters sum
+		 * to a channel.
 		 */
-		fir_32x16_2x(filter, cd->in[is], cd->in[is2], &y0, &y1);
-		y0 >>= 4;
-		y1 >>= 4;
 		for (k = 0; k < out_nch; k++) {
 			if (om & 1) {
-				cd->out[k] += y0;
-				cd->out[k + out_nch] += y1;
+				out = cd->block_out[k];
+				for (j = 0; j < frames; j++)
+					out[j] += y[j] >> 4;
 			}
 			om = om >> 1;
 		}
 	}
 }
 
-
 #if CONFIG_FORMAT_S16LE
 void tdfb_fir_s16(struct tdfb_comp_data *cd,
 		  const struct audio_stream __sparse_cache *source,
@@ -75,20 +80,24 @@ void tdfb_fir_s16(struct tdfb_comp_data *cd,
 		f = MIN(remaining_frames, fmax);
 		fmax = audio_stream_frames_without_wrap(sink, y);
 		f = MIN(f, fmax);
-		for (j = 0; j < f; j += 2) {
-			/* Read two frames from all input channels */
-			for (i = 0; i < 2 * in_nch; i++) {
-				cd->in[i] = *x << 16;
+		f = MIN(f, TDFB_BLOCK_FRAMES);
+
+		/* Read the frames to input channel blocks */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < in_nch; i++) {
+				cd->block_in[i][j] = *x << 16;
 				tdfb_direction_copy_emphasis(cd, in_nch, &emp_ch, *x << 16);
 				x++;
 			}
+		}
 
-			/* Process */
-			tdfb_core(cd, in_nch, out_nch);
+		/* Process */
+		tdfb_core(cd, out_nch, f);
 
-			/* Write two frames of output */
-			for (i = 0; i < 2 * out_nch; i++) {
-				*y = sat_int16(Q_SHIFT_RND(cd->out[i], 27, 15));
+		/* Write the output frames */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < out_nch; i++) {
+				*y = sat_int16(Q_SHIFT_RND(cd->block_out[i][j], 27, 15));
 				y++;
 			}
 		}
@@ -120,20 +129,24 @@ void tdfb_fir_s24(struct tdfb_comp_data *cd,
 		f = MIN(remaining_frames, fmax);
 		fmax = audio_stream_frames_without_wrap(sink, y);
 		f = MIN(f, fmax);
-		for (j = 0; j < f; j += 2) {
-			/* Read two frames from all input channels */
-			for (i = 0; i < 2 * in_nch; i++) {
-				cd->in[i] = *x << 8;
+		f = MIN(f, TDFB_BLOCK_FRAMES);
+
+		/* Read the frames to input channel blocks */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < in_nch; i++) {
+				cd->block_in[i][j] = *x << 8;
 				tdfb_direction_copy_emphasis(cd, in_nch, &emp_ch, *x << 8);
 				x++;
 			}
+		}
 
-			/* Process */
-			tdfb_core(cd, in_nch, out_nch);
+		/* Process */
+		tdfb_core(cd, out_nch, f);
 
-			/* Write two frames of output */
-			for (i = 0; i < 2 * out_nch; i++) {
-				*y = sat_int24(Q_SHIFT_RND(cd->out[i], 27, 23));
+		/* Write the output frames */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < out_nch; i++) {
+				*y = sat_int24(Q_SHIFT_RND(cd->block_out[i][j], 27, 23));
 				y++;
 			}
 		}
@@ -164,25 +177,26 @@ void tdfb_fir_s32(struct tdfb_comp_data *cd, const struct audio_stream __sparse_
 		f = MIN(remaining_frames, fmax);
 		fmax = audio_stream_frames_without_wrap(sink, y);
 		f = MIN(f, fmax);
-		for (j = 0; j < f; j += 2) {
-			/* Clear output mix*/
-			memset(cd->out, 0, 2 * out_nch * sizeof(int32_t));
+		f = MIN(f, TDFB_BLOCK_FRAMES);
 
-			/* Read two frames from all input channels */
-			for (i = 0; i < 2 * in_nch; i++) {
-				cd->in[i] = *x;
+		/* Read the frames to input channel blocks */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < in_nch; i++) {
+				cd->block_in[i][j] = *x;
 				tdfb_direction_copy_emphasis(cd, in_nch, &emp_ch, *x);
 				x++;
 			}
+		}
 
-			/* Process */
-			tdfb_core(cd, in_nch, out_nch);
+		/* Process */
+		tdfb_core(cd, out_nch, f);
 
-			/* Write two frames of output. In Q5.27 to Q1.31 conversion
-			 * rounding is not applicable so just shift left by 4.
-			 */
-			for (i = 0; i < 2 * out_nch; i++) {
-				*y = sat_int32((int64_t)cd->out[i] << 4);
+		/* Write the output frames. In Q5.27 to Q1.31 conversion
+		 * rounding is not applicable so just shift left by 4.
+		 */
+		for (j = 0; j < f; j++) {
+			for (i = 0; i < out_nch; i++) {
+				*y = sat_int32((int64_t)cd->block_out[i][j] << 4);
 				y++;
 			}
 		}
@@ -194,4 +208,3 @@ void tdfb_fir_s32(struct tdfb_comp_data *cd, const struct audio_stream __sparse_
 #endif
 
 #endif /* TDFB_GENERIC */
-
@@ -292,6 +292,14 @@ enum ipc4_basefw_params {
 
 	/* Use LARGE_CONFIG_SET to change SDW ownership */
 	IPC4_SDW_OWNERSHIP = 31,
+
+	/* SOF extension. Use LARGE_CONFIG_GET to read the LL scheduler
+	 * statistics: a IPC4_LL_CORE_STATS tuple for each core followed
+	 * by IPC4_LL_TASK_STATS tuples of the tasks of the core. Replies
+	 * longer than one block are read with subsequent blocks, the reply
+	 * ends with the first block shorter than SOF_IPC_MSG_MAX_SIZE.
+	 */
+	IPC4_LL_SCHEDULER_STATS = 32,
 };
 
 enum ipc4_fw_config_params {
@@ -672,3 +680,47 @@ enum ipc4_power_state_type {
 	IPC4_ACTIVE_CORES_MASK = 0,
 	IPC4_CORE_KCPS = 1,
 };
+
+enum ipc4_ll_stats_type {
+	IPC4_LL_CORE_STATS = 0,
+	IPC4_LL_TASK_STATS = 1,
+	/* Empty tuple ending a reply which would be a multiple of the
+	 * block size, so that its last block is shorter than a block
+	 */
+	IPC4_LL_STATS_PAD = 2,
+};
+
+#define IPC4_LL_STATS_HIST_BINS		16
+
+struct ipc4_ll_core_stats {
+	uint32_t core_id;
+	/* Number of LL ticks run on the core */
+	uint32_t ticks;
+	/* Number of ticks longer than the tick budget */
+	uint32_t overruns;
+	/* Tick budget in cycles */
+	uint32_t budget;
+	/* Cycles of the last statistics window and cycles spent running
+	 * LL ticks in it, the core is idle for the rest of the window
+	 */
+	uint32_t window_cycles;
+	uint32_t window_busy;
+	/* Number of LL tasks on the core, task tuples may be fewer */
+	uint32_t task_count;
+};
+
+struct ipc4_ll_task_stats {
+	/* Task UUID and a tag telling tasks with the same UUID apart */
+	uint32_t uuid[4];
+	uint32_t id;
+	uint32_t priority;
+	uint32_t runs;
+	/* Number of runs longer than the tick budget */
+	uint32_t overruns;
+	uint32_t cycles_max;
+	/* Bin i counts runs of 2^(i + hist_shift) to 2^(i + hist_shift + 1)
+	 * cycles, the first and last bins also count shorter and longer runs
+	 */
+	uint32_t hist_shift;
+	uint32_t hist[IPC4_LL_STATS_HIST_BINS];
+};
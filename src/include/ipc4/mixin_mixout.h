@@ -41,6 +41,12 @@
 #define MIXIN_MIXOUT_HIFI3
 #endif
 
+#elif defined(__AVX2__)
+
+/* x86 host builds */
+#undef MIXIN_MIXOUT_GENERIC
+#define MIXIN_MIXOUT_X86
+
 #endif
 
 enum ipc4_mixin_config_param {
@@ -127,6 +133,17 @@ typedef void (*normal_mix_func)(struct audio_stream __sparse_cache *sink, int32_
 typedef void (*mute_func) (struct audio_stream __sparse_cache *stream, int32_t channel_index,
 			     int32_t start_frame, int32_t mixed_frames, int32_t frame_count);
 
+/**
+ * \brief remap mode processing function interface for all sink channels at once
+ *
+ * Each 4 bit nibble of channel_map selects the source channel of a sink channel,
+ * 0xf mutes the channel. Replaces remap_mix_func and mute_func when available.
+ */
+typedef void (*remap_frames_func)(struct audio_stream __sparse_cache *sink, int32_t start_frame,
+				  int32_t mixed_frames,
+				  const struct audio_stream __sparse_cache *source,
+				  int32_t frame_count, uint32_t channel_map, uint16_t gain);
+
 /**
  * @brief mixin_mixout processing functions map.
  */
@@ -135,6 +152,7 @@ struct mix_func_map {
 	normal_mix_func normal_func;	/* normal mode mixin_mixout processing function */
 	remap_mix_func remap_func;	/* remap mode mixin_mixout processing function */
 	mute_func mute_func;			/* mute processing function */
+	remap_frames_func remap_frames;	/* optional remap mode function for all channels */
 };
 
 extern const struct mix_func_map mix_func_map[];
@@ -190,4 +208,20 @@ static inline mute_func mute_mix_get_processing_function(int fmt)
 	return NULL;
 }
 
+/**
+ * \brief Retrievies remap mode processing function for all channels, if any.
+ * \param[in] fmt  stream PCM frame format
+ */
+static inline remap_frames_func remap_frames_get_processing_function(int fmt)
+{
+	int i;
+
+	for (i = 0; i < mix_count; i++) {
+		if (fmt == mix_func_map[i].frame_fmt)
+			return mix_func_map[i].remap_frames;
+	}
+
+	return NULL;
+}
+
 #endif	/* __SOF_IPC4_MIXIN_MIXOUT_H__ */
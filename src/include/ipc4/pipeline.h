@@ -112,6 +112,50 @@ struct ipc4_pipeline_create {
 	} extension;
 } __attribute__((packed, aligned(4)));
 
+/*!
+ * SW Driver sends this IPC message to run a batch of CREATE_PIPELINE,
+ * MOD_INIT_INSTANCE and MOD_BIND messages with a single reply.
+ *
+ * The mailbox holds the messages one after another, each as its primary and
+ * extension words followed by its mailbox payload. Only MOD_INIT_INSTANCE has
+ * a payload, param_block_size words. All the messages are for the core that
+ * handles the batch.
+ *
+ * The messages are run in order until the first failure, the reply status is
+ * the status of the failed message. The reply mailbox has the status of each
+ * message, IPC4_UNAVAILABLE for the ones that were not run.
+ */
+struct ipc4_batch {
+
+	union {
+		uint32_t dat;
+
+		struct {
+			/**< number of messages in the batch */
+			uint32_t num_msgs       : 8;
+			uint32_t rsvd0          : 16;
+			/**< Global::BATCH */
+			uint32_t type           : 5;
+			/**< Msg::MSG_REQUEST */
+			uint32_t rsp            : 1;
+			/**< Msg::FW_GEN_MSG */
+			uint32_t msg_tgt        : 1;
+			uint32_t _reserved_0    : 1;
+		} r;
+	} primary;
+
+	union {
+		uint32_t dat;
+
+		struct {
+			/**< size of the messages in the mailbox in bytes */
+			uint32_t data_size      : 16;
+			uint32_t rsvd1          : 14;
+			uint32_t _reserved_2    : 2;
+		} r;
+	} extension;
+} __packed __aligned(4);
+
 /*!
  * SW Driver sends this IPC message to delete a pipeline from ADSP memory.
  *
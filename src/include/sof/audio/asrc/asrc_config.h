@@ -20,20 +20,29 @@
 /* Version for HiFi3 */
 #define ASRC_HIFI3	1
 #define ASRC_GENERIC	0
+#define ASRC_X86	0
 #else
 /* Version for e.g. HiFi2EP */
 #define ASRC_HIFI3	0
 #define ASRC_GENERIC	1
+#define ASRC_X86	0
 #endif
 #else
-/* For GCC */
+/* For GCC, x86 hosts with AVX2 have own version */
+#if defined(__AVX2__)
+#define ASRC_GENERIC	0
+#define ASRC_X86	1
+#else
 #define ASRC_GENERIC	1
+#define ASRC_X86	0
+#endif
 #define ASRC_HIFI3	0
 #endif /* XCC */
 #else
 /* Applied when ASRC_AUTOARCH is set to zero */
 #define ASRC_GENERIC	1 /* Enable generic */
 #define ASRC_HIFI3	0 /* Disable HiFi3  */
+#define ASRC_X86	0 /* Disable x86 */
 #endif /* Autoarch */
 
 #endif /* __SOF_AUDIO_ASRC_ASRC_CONFIG_H__ */
@@ -44,6 +44,17 @@
  * audio_stream_consume()/audio_stream_produce() (just a single call following
  * series of reads/writes).
  */
+/**
+ * Read and write positions of a lock free stream with one producer and one
+ * consumer. Each position is written only by its owner and sits in its own
+ * cache line. Positions count from 0 to 2 * size - 1 so that a full stream
+ * is told apart from an empty one.
+ */
+struct audio_stream_spsc {
+	__aligned(DCACHE_LINE_SIZE) uint32_t w_pos;	/**< Written by producer */
+	__aligned(DCACHE_LINE_SIZE) uint32_t r_pos;	/**< Written by consumer */
+};
+
 struct audio_stream {
 	/* runtime data */
 	uint32_t size;	/**< Runtime buffer size in bytes (period multiple) */
@@ -54,6 +65,12 @@ struct audio_stream {
 	void *addr;	/**< Buffer base address */
 	void *end_addr;	/**< Buffer end address */
 
+	/**
+	 * Lock free positions, NULL if the stream is protected by a lock. When
+	 * set avail and free are not maintained, use the accessors instead.
+	 */
+	struct audio_stream_spsc *spsc;
+
 	/* runtime stream params */
 	enum sof_ipc_frame frame_fmt;	/**< Sample data format */
 	enum sof_ipc_frame valid_sample_fmt;
@@ -307,6 +324,50 @@ static inline void *audio_stream_rewind_wrap(const struct audio_stream __sparse_
 	return ptr;
 }
 
+/*
+ * Loads a position written by the other side. Data written before the
+ * position was stored is visible after this returns.
+ */
+static inline uint32_t audio_stream_spsc_load(const uint32_t *pos)
+{
+#ifdef __ATOMIC_ACQUIRE
+	return __atomic_load_n(pos, __ATOMIC_ACQUIRE);
+#else
+	uint32_t value = *pos;
+
+	__sync_synchronize();
+	return value;
+#endif
+}
+
+/* Publishes own position after the data it covers has been accessed. */
+static inline void audio_stream_spsc_store(uint32_t *pos, uint32_t value)
+{
+#ifdef __ATOMIC_RELEASE
+	__atomic_store_n(pos, value, __ATOMIC_RELEASE);
+#else
+	__sync_synchronize();
+	*pos = value;
+#endif
+}
+
+/**
+ * Calculates available bytes of a lock free stream from its positions.
+ * @param stream Lock free stream
+ * @return amount of data in the stream in bytes
+ */
+static inline uint32_t
+audio_stream_spsc_avail(const struct audio_stream __sparse_cache *stream)
+{
+	uint32_t w_pos = audio_stream_spsc_load(&stream->spsc->w_pos);
+	uint32_t r_pos = audio_stream_spsc_load(&stream->spsc->r_pos);
+
+	if (w_pos >= r_pos)
+		return w_pos - r_pos;
+
+	return w_pos + 2 * stream->size - r_pos;
+}
+
 /**
  * Calculates available data in bytes, handling underrun_permitted behaviour
  * @param stream Stream pointer
@@ -315,6 +376,8 @@ static inline void *audio_stream_rewind_wrap(const struct audio_stream __sparse_
 static inline uint32_t
 audio_stream_get_avail_bytes(const struct audio_stream __sparse_cache *stream)
 {
+	uint32_t avail = stream->spsc ? audio_stream_spsc_avail(stream) : stream->avail;
+
 	/*
 	 * In case of underrun-permitted stream, report buffer full instead of
 	 * empty. This way, any data present in such stream is processed at
@@ -322,9 +385,9 @@ audio_stream_get_avail_bytes(const struct audio_stream __sparse_cache *stream)
 	 * clients, and in turn will not cause underrun/XRUN.
 	 */
 	if (stream->underrun_permitted)
-		return stream->avail != 0 ? stream->avail : stream->size;
+		return avail != 0 ? avail : stream->size;
 
-	return stream->avail;
+	return avail;
 }
 
 /**
@@ -359,6 +422,9 @@ audio_stream_get_avail_frames(const struct audio_stream __sparse_cache *stream)
 static inline uint32_t
 audio_stream_get_free_bytes(const struct audio_stream __sparse_cache *stream)
 {
+	uint32_t free = stream->spsc ? stream->size - audio_stream_spsc_avail(stream) :
+		stream->free;
+
 	/*
 	 * In case of overrun-permitted stream, report buffer empty instead of
 	 * full. This way, if there's any actual free space for data it is
@@ -366,9 +432,9 @@ audio_stream_get_free_bytes(const struct audio_stream __sparse_cache *stream)
 	 * completely full by clients, and in turn will not cause overrun/XRUN.
 	 */
 	if (stream->overrun_permitted)
-		return stream->free != 0 ? stream->free : stream->size;
+		return free != 0 ? free : stream->size;
 
-	return stream->free;
+	return free;
 }
 
 /**
@@ -480,6 +546,21 @@ audio_stream_avail_frames_aligned(const struct audio_stream __sparse_cache *sour
 	return MIN(src_frames, sink_frames);
 }
 
+/*
+ * Moves a lock free stream position forward. The producer can't move the
+ * read position, so the stream must not be written over its free space.
+ */
+static inline uint32_t
+audio_stream_spsc_advance(const struct audio_stream __sparse_cache *buffer, uint32_t pos,
+			  uint32_t bytes)
+{
+	pos += bytes;
+	if (pos >= 2 * buffer->size)
+		pos -= 2 * buffer->size;
+
+	return pos;
+}
+
 /**
  * Updates the buffer state after writing to the buffer.
  * @param buffer Buffer to update.
@@ -491,6 +572,14 @@ static inline void audio_stream_produce(struct audio_stream __sparse_cache *buff
 	buffer->w_ptr = audio_stream_wrap(buffer,
 					  (char *)buffer->w_ptr + bytes);
 
+	/* lock free stream, only the write position is owned by producer */
+	if (buffer->spsc) {
+		audio_stream_spsc_store(&buffer->spsc->w_pos,
+					audio_stream_spsc_advance(buffer, buffer->spsc->w_pos,
+								  bytes));
+		return;
+	}
+
 	/* "overwrite" old data in circular wrap case */
 	if (bytes > audio_stream_get_free_bytes(buffer))
 		buffer->r_ptr = buffer->w_ptr;
@@ -519,6 +608,14 @@ static inline void audio_stream_consume(struct audio_stream __sparse_cache *buff
 	buffer->r_ptr = audio_stream_wrap(buffer,
 					  (char *)buffer->r_ptr + bytes);
 
+	/* lock free stream, only the read position is owned by consumer */
+	if (buffer->spsc) {
+		audio_stream_spsc_store(&buffer->spsc->r_pos,
+					audio_stream_spsc_advance(buffer, buffer->spsc->r_pos,
+								  bytes));
+		return;
+	}
+
 	/* calculate available bytes */
 	if (buffer->r_ptr < buffer->w_ptr)
 		buffer->avail = (char *)buffer->w_ptr - (char *)buffer->r_ptr;
@@ -547,6 +644,11 @@ static inline void audio_stream_reset(struct audio_stream __sparse_cache *buffer
 
 	/* there are no avail samples at reset */
 	buffer->avail = 0;
+
+	if (buffer->spsc) {
+		audio_stream_spsc_store(&buffer->spsc->w_pos, 0);
+		audio_stream_spsc_store(&buffer->spsc->r_pos, 0);
+	}
 }
 
 /**
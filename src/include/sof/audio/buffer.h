@@ -193,6 +193,15 @@ struct comp_buffer *buffer_alloc(uint32_t size, uint32_t caps, uint32_t align);
 struct comp_buffer *buffer_new(const struct sof_ipc_buffer *desc);
 int buffer_set_size(struct comp_buffer __sparse_cache *buffer, uint32_t size);
 void buffer_free(struct comp_buffer *buffer);
+
+/*
+ * Switch a buffer with one producer core and one consumer core to lock free
+ * mode. buffer_acquire() no longer takes the lock, the stream position is
+ * shared through separate read and write positions. Buffer parameters must
+ * only be changed while the buffer is not running. Only for cache coherent
+ * builds, the descriptor is used uncached by both cores.
+ */
+int buffer_set_spsc(struct comp_buffer *buffer);
 void buffer_zero(struct comp_buffer __sparse_cache *buffer);
 
 /* called by a component after producing data into this buffer */
@@ -228,13 +237,22 @@ static inline void buffer_stream_writeback(struct comp_buffer __sparse_cache *bu
 __must_check static inline struct comp_buffer __sparse_cache *buffer_acquire(
 	struct comp_buffer *buffer)
 {
-	struct coherent __sparse_cache *c = coherent_acquire_thread(&buffer->c, sizeof(*buffer));
+	struct coherent __sparse_cache *c;
+
+	/* both cores see the same descriptor, each only moves its own pointer */
+	if (buffer->stream.spsc)
+		return (__sparse_force struct comp_buffer __sparse_cache *)buffer;
+
+	c = coherent_acquire_thread(&buffer->c, sizeof(*buffer));
 
 	return attr_container_of(c, struct comp_buffer __sparse_cache, c, __sparse_cache);
 }
 
 static inline void buffer_release(struct comp_buffer __sparse_cache *buffer)
 {
+	if (buffer->stream.spsc)
+		return;
+
 	coherent_release_thread(&buffer->c, sizeof(*buffer));
 }
 
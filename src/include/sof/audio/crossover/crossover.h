@@ -75,6 +75,18 @@ typedef void (*crossover_process)(const struct comp_dev *dev,
 typedef void (*crossover_split)(int32_t in, int32_t out[],
 				struct crossover_state *state);
 
+/* Frames per block in the block processing. The block buffers of all bands
+ * are small enough to stay in the data cache, they are allocated in setup
+ * for the number of channels and sinks.
+ */
+#define CROSSOVER_BLOCK_FRAMES 64
+
+/* Splits interleaved Q1.31 block of nch channels to interleaved blocks
+ * out[] of the bands. The first band buffer can be the input buffer.
+ */
+typedef void (*crossover_split_block)(struct crossover_state state[], int nch,
+				      int32_t *in, int32_t *out[], int frames);
+
 /* Crossover component private data */
 struct comp_data {
 	/**< filter state */
@@ -83,7 +95,8 @@ struct comp_data {
 	struct sof_crossover_config *config;      /**< pointer to setup blob */
 	enum sof_ipc_frame source_format;         /**< source frame format */
 	crossover_process crossover_process;      /**< processing function */
-	crossover_split crossover_split;          /**< split function */
+	crossover_split_block crossover_split_block; /**< block split function */
+	int32_t *block_buf[CROSSOVER_4WAY_NUM_SINKS]; /**< block buffers of the bands */
 };
 
 struct crossover_proc_fnmap {
@@ -127,19 +140,18 @@ static inline crossover_process
 	return NULL;
 }
 
-extern const crossover_split crossover_split_fnmap[];
-extern const size_t crossover_split_fncount;
+extern const crossover_split_block crossover_split_block_fnmap[];
 
 /**
- * \brief Returns Crossover split function.
+ * \brief Returns Crossover block split function.
  */
-static inline crossover_split crossover_find_split_func(int32_t num_sinks)
+static inline crossover_split_block crossover_find_split_block_func(int32_t num_sinks)
 {
-	if (num_sinks < CROSSOVER_2WAY_NUM_SINKS &&
+	if (num_sinks < CROSSOVER_2WAY_NUM_SINKS ||
 	    num_sinks > CROSSOVER_4WAY_NUM_SINKS)
 		return NULL;
-	// The functions in the map are offset by 2 indices.
-	return crossover_split_fnmap[num_sinks - CROSSOVER_2WAY_NUM_SINKS];
+
+	return crossover_split_block_fnmap[num_sinks - CROSSOVER_2WAY_NUM_SINKS];
 }
 
 /*
@@ -63,11 +63,11 @@ struct mfcc_pre_emph {
 
 struct mfcc_fft {
 #if MFCC_FFT_BITS == 16
-	struct icomplex16 *fft_buf; /**< fft_padded_size */
-	struct icomplex16 *fft_out; /**< fft_padded_size */
+	int16_t *fft_buf; /**< fft_padded_size real input */
+	struct icomplex16 *fft_out; /**< half_fft_size used */
 #elif MFCC_FFT_BITS == 32
-	struct icomplex32 *fft_buf; /**< fft_padded_size */
-	struct icomplex32 *fft_out; /**< fft_padded_size */
+	int32_t *fft_buf; /**< fft_padded_size real input */
+	struct icomplex32 *fft_out; /**< half_fft_size used */
 #else
 #error "MFCC_FFT_BITS needs to be 16 or 32"
 #endif
@@ -88,7 +88,7 @@ struct mfcc_cepstral_lifter {
 };
 
 struct mfcc_state {
-	struct mfcc_buffer buf; /**< Circular buffer for input data */
+	struct mfcc_buffer buf; /**< Circular buffer for input data and frame overlap */
 	struct mfcc_pre_emph emph; /**< Pre-emphasis filter */
 	struct mfcc_fft fft; /**< FFT related */
 	struct dct_plan_16 dct; /**< DCT related */
@@ -99,7 +99,6 @@ struct mfcc_state {
 	int32_t *power_spectra; /**< Pointer to scratch */
 	int16_t buf_avail;
 	int16_t *buffers;
-	int16_t *prev_data; /**< prev_data_size */
 	int16_t *window; /**< fft_size */
 	int16_t *triangles;
 	int source_channel;
@@ -109,7 +108,6 @@ struct mfcc_state {
 	int high_freq;
 	int sample_rate;
 	int waiting_fill:1; /**< booleans */
-	int prev_samples_valid:1;
 	size_t sample_buffers_size; /**< bytes */
 };
 
@@ -207,6 +207,19 @@ struct processing_module {
 	 */
 	bool skip_src_buffer_invalidate;
 
+	/*
+	 * flag set by a module that only reads the input buffer data within the given size. When
+	 * the readable region of a source buffer does not wrap, the input buffer then points
+	 * directly to the source buffer instead of to a local copy of the data.
+	 */
+	bool direct_input_access;
+
+	/* local input buffers used when the source data must be copied */
+	void __sparse_cache **input_buffers_local;
+
+	/* number of input bytes passed to the module without a copy since prepare */
+	uint64_t direct_input_bytes;
+
 	/* table containing the list of connected sources */
 	struct module_source_info *source_info;
 };
@@ -16,6 +16,11 @@
 #include <sof/math/iir_df2t.h>
 #include <user/multiband_drc.h>
 
+/* Frames per block in the processing. A block is one division of the band
+ * DRCs, each block is processed through all stages while it is in cache.
+ */
+#define MULTIBAND_DRC_BLOCK_FRAMES DRC_DIVISION_FRAMES
+
 /**
  * Stores the state of the sub-components in Multiband DRC
  */
@@ -24,6 +29,7 @@ struct multiband_drc_state {
 	struct crossover_state crossover[PLATFORM_MAX_CHANNELS];
 	struct drc_state drc[SOF_MULTIBAND_DRC_MAX_BANDS];
 	struct iir_state_df2t deemphasis[PLATFORM_MAX_CHANNELS];
+	int32_t *block_buf[SOF_MULTIBAND_DRC_MAX_BANDS]; /* block buffers of the bands */
 };
 
 typedef void (*multiband_drc_func)(const struct comp_dev *dev,
@@ -40,7 +46,7 @@ struct multiband_drc_comp_data {
 	enum sof_ipc_frame source_format;        /**< source frame format */
 	bool process_enabled;                    /**< true if component is enabled */
 	multiband_drc_func multiband_drc_func;   /**< processing function */
-	crossover_split crossover_split;         /**< crossover n-way split func */
+	crossover_split_block crossover_split_block; /**< crossover block split func */
 };
 
 struct multiband_drc_proc_fnmap {
@@ -49,6 +49,18 @@ struct ipc_msg;
 #define PPL_DIR_DOWNSTREAM	0
 #define PPL_DIR_UPSTREAM	1
 
+/* max components in the flat copy list, one bit each in the run mask */
+#define PPL_COPY_LIST_SIZE	32
+
+/*
+ * Entry of the flat copy list. Entries are in topological order, every
+ * component comes after the components of the pipeline feeding it.
+ */
+struct pipeline_copy_entry {
+	struct comp_dev *comp;
+	uint32_t reached_from;	/* entries the walk goes to the component from */
+};
+
 /*
  * Audio pipeline.
  */
@@ -74,6 +86,12 @@ struct pipeline {
 	struct pipeline *sched_next;	/* pipeline scheduled after this */
 	struct pipeline *sched_prev;	/* pipeline scheduled before this */
 
+	/* flat copy list, built on prepare, see pipeline_copy_list_build() */
+	struct pipeline_copy_entry *copy_list;
+	uint32_t copy_count;
+	bool copy_list_valid;
+	bool copy_walk;		/* always walk the graph in pipeline_copy() */
+
 	/* component that drives scheduling in this pipe */
 	struct comp_dev *sched_comp;
 	/* source component for this pipe */
@@ -291,6 +309,25 @@ int pipeline_trigger_run(struct pipeline *p, struct comp_dev *host, int cmd);
  */
 int pipeline_copy(struct pipeline *p);
 
+/**
+ * \brief Builds the flat copy list used by pipeline_copy() in place of
+ *	  the graph walk, does nothing if the list is valid.
+ * \param[in] p pipeline.
+ * \return 0 on success.
+ */
+int pipeline_copy_list_build(struct pipeline *p);
+
+/**
+ * \brief Invalidates the flat copy list after a graph change, the graph is
+ *	  walked in pipeline_copy() until the list is built again.
+ * \param[in] p pipeline, can be NULL.
+ */
+static inline void pipeline_copy_list_invalidate(struct pipeline *p)
+{
+	if (p)
+		p->copy_list_valid = false;
+}
+
 /**
  * \brief Get time pipeline timestamps from host to dai.
  * \param[in] p pipeline.
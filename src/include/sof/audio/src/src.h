@@ -8,9 +8,19 @@
 #ifndef __SOF_AUDIO_SRC_SRC_H__
 #define __SOF_AUDIO_SRC_SRC_H__
 
+#include <sof/audio/src/src_config.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/* The x86 version keeps a copy of the FIR delay line right after it so
+ * that the filter never needs to wrap the reads.
+ */
+#if SRC_X86
+#define SRC_FIR_DELAY_COPIES	2
+#else
+#define SRC_FIR_DELAY_COPIES	1
+#endif
+
 struct src_param {
 	int fir_s1;
 	int fir_s2;
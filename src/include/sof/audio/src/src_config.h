@@ -22,6 +22,7 @@
 #define SRC_GENERIC	1
 #define SRC_HIFIEP	0
 #define SRC_HIFI3	0
+#define SRC_X86		0
 #endif
 
 /* Select optimized code variant when xt-xcc compiler is used */
@@ -29,6 +30,7 @@
 #if defined __XCC__
 #include <xtensa/config/core-isa.h>
 #define SRC_GENERIC	0
+#define SRC_X86		0
 #if XCHAL_HAVE_HIFI4 == 1
 #define SRC_HIFI4	1
 #define SRC_HIFI3	0
@@ -45,8 +47,14 @@
 #endif
 #endif
 #else
-/* GCC */
+/* GCC, x86 hosts with AVX2 have own version */
+#if defined(__AVX2__)
+#define SRC_GENERIC	0
+#define SRC_X86		1
+#else
 #define SRC_GENERIC	1
+#define SRC_X86		0
+#endif
 #define SRC_HIFIEP	0
 #define SRC_HIFI3	0
 #if CONFIG_LIBRARY
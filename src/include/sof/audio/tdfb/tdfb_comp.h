@@ -40,6 +40,9 @@
 #define TDFB_IN_BUF_LENGTH (2 * PLATFORM_MAX_CHANNELS)
 #define TDFB_OUT_BUF_LENGTH (2 * PLATFORM_MAX_CHANNELS)
 
+/* Frames per channel block in the generic version, an even number */
+#define TDFB_BLOCK_FRAMES 64
+
 /* When set to one only one IPC is sent to host. There is not other requests
  * triggered. If set to zero the IPC sent will be empty and the driver will
  * issue an actual control get. In simple  case with known # of control channels
@@ -91,6 +94,12 @@ struct tdfb_comp_data {
 	struct tdfb_direction_data direction;
 	int32_t in[TDFB_IN_BUF_LENGTH];	    /**< input samples buffer */
 	int32_t out[TDFB_IN_BUF_LENGTH];    /**< output samples mix buffer */
+#if TDFB_GENERIC
+	int32_t block_in[PLATFORM_MAX_CHANNELS][TDFB_BLOCK_FRAMES];  /**< input channels */
+	int32_t block_out[PLATFORM_MAX_CHANNELS][TDFB_BLOCK_FRAMES]; /**< output channels mix */
+	int32_t fir_in[SOF_FIR_MAX_LENGTH - 1 + TDFB_BLOCK_FRAMES]; /**< history and input */
+	int32_t fir_out[TDFB_BLOCK_FRAMES]; /**< output of one filter */
+#endif
 	int32_t *fir_delay;		    /**< pointer to allocated RAM */
 	int16_t *input_channel_select;	    /**< For each FIR define in ch */
 	int16_t *output_channel_mix;	    /**< For each FIR define out ch */
@@ -43,6 +43,12 @@ struct sof_ipc_ctrl_value_chan;
 #undef CONFIG_GENERIC
 #endif
 
+#elif defined(__AVX2__)
+
+/* x86 host builds */
+#undef CONFIG_GENERIC
+#define VOLUME_X86
+
 #endif
 
 /**
@@ -16,6 +16,7 @@
 #include <sof/list.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/cpu.h>
+#include <sof/lib/slab.h>
 
 #define __coherent __attribute__((packed, aligned(DCACHE_LINE_SIZE)))
 
@@ -156,7 +157,7 @@ static inline void coherent_release(struct coherent __sparse_cache *c,
 
 static inline void *__coherent_init(size_t offset, const size_t size)
 {
-	void *object = rzalloc(SOF_MEM_ZONE_RUNTIME_SHARED, 0, SOF_MEM_CAPS_RAM, size);
+	void *object = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED, size);
 	struct coherent *c;
 
 	if (!object)
@@ -245,7 +246,7 @@ static inline void coherent_release_thread(struct coherent __sparse_cache *c,
 
 static inline void *__coherent_init_thread(size_t offset, const size_t size)
 {
-	void *object = rzalloc(SOF_MEM_ZONE_RUNTIME_SHARED, 0, SOF_MEM_CAPS_RAM, size);
+	void *object = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED, size);
 	struct coherent *c;
 
 	if (!object)
@@ -293,7 +294,7 @@ static inline void __coherent_shared_thread(struct coherent *c, const size_t siz
 		/* wtb and inv local data to coherent object */			\
 		dcache_writeback_invalidate_region(uncache_to_cache(object),	\
 						   sizeof(*object));		\
-		rfree(object);							\
+		slab_free(SOF_MEM_ZONE_RUNTIME_SHARED, object, sizeof(*object)); \
 	} while (0)
 
 #else /* CONFIG_INCOHERENT */
@@ -331,7 +332,8 @@ static inline void coherent_release(struct coherent __sparse_cache *c,
 
 static inline void *__coherent_init(size_t offset, const size_t size)
 {
-	void *object = rzalloc(SOF_MEM_ZONE_RUNTIME_SHARED, 0, SOF_MEM_CAPS_RAM, size);
+	void *object = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED,
+				  ALIGN_UP(size, PLATFORM_DCACHE_ALIGN));
 	struct coherent *c;
 
 	if (!object)
@@ -351,7 +353,9 @@ static inline void *__coherent_init(size_t offset, const size_t size)
 #define coherent_init(type, member) __coherent_init(offsetof(type, member), \
 						    sizeof(type))
 
-#define coherent_free(object, member) rfree(object)
+#define coherent_free(object, member)					\
+	slab_free(SOF_MEM_ZONE_RUNTIME_SHARED, object,			\
+		  ALIGN_UP(sizeof(*object), PLATFORM_DCACHE_ALIGN))
 
 static inline void __coherent_shared(struct coherent *c, const size_t size)
 {
@@ -399,8 +403,8 @@ static inline void *__coherent_init_thread(size_t offset, const size_t size)
 	 * line boundary to avoid sharing a cache line with the adjacent
 	 * allocation
 	 */
-	void *object = rzalloc(SOF_MEM_ZONE_RUNTIME_SHARED, 0, SOF_MEM_CAPS_RAM,
-			       ALIGN_UP(size, PLATFORM_DCACHE_ALIGN));
+	void *object = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED,
+				  ALIGN_UP(size, PLATFORM_DCACHE_ALIGN));
 	struct coherent *c;
 
 	if (!object)
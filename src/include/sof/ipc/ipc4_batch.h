@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+/*
+ * Parsing of the IPC4 batch message, see struct ipc4_batch. The mailbox
+ * content is controlled by the host, so every message is checked to fit
+ * in the batch before it is used.
+ */
+
+#ifndef __SOF_IPC_IPC4_BATCH_H__
+#define __SOF_IPC_IPC4_BATCH_H__
+
+#include <sof/common.h>
+#include <ipc4/error_status.h>
+#include <ipc4/header.h>
+#include <ipc4/module.h>
+#include <ipc4/pipeline.h>
+#include <stdint.h>
+
+/* number of words of a batched message header */
+#define IPC4_BATCH_HDR_WORDS	2
+
+/**
+ * \brief Checks the header of a batch.
+ * \param[in] batch Header of the batch message.
+ * \param[in] max_size Size of the mailbox holding the messages.
+ * \param[in] reply_size Maximum reply size, the reply has one status word
+ *		    per message.
+ * \return 0 if valid, IPC4 error otherwise.
+ */
+static inline int ipc4_batch_check(const struct ipc4_batch *batch, uint32_t max_size,
+				   uint32_t reply_size)
+{
+	if (batch->primary.r.num_msgs > reply_size / sizeof(uint32_t))
+		return IPC4_ERROR_INVALID_PARAM;
+
+	if (batch->extension.r.data_size > max_size ||
+	    batch->extension.r.data_size % sizeof(uint32_t))
+		return IPC4_ERROR_INVALID_PARAM;
+
+	return 0;
+}
+
+/* number of mailbox payload words after the header of a batched message */
+static inline uint32_t ipc4_batch_payload_words(const struct ipc4_message_request *msg)
+{
+	const struct ipc4_module_init_instance *init;
+
+	if (msg->primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_MODULE_MSG &&
+	    msg->primary.r.type == SOF_IPC4_MOD_INIT_INSTANCE) {
+		init = (const struct ipc4_module_init_instance *)msg;
+		return init->extension.r.param_block_size;
+	}
+
+	return 0;
+}
+
+/**
+ * \brief Gets the next message of a batch.
+ * \param[in] msgs Messages of the batch.
+ * \param[in] words Size of the messages in words.
+ * \param[in,out] pos Position of the next message, moved past it.
+ * \param[out] msg The message header.
+ * \param[out] payload Number of payload words following the header.
+ * \return 0 if the message fits in the batch, IPC4 error otherwise.
+ */
+static inline int ipc4_batch_next(uint32_t *msgs, uint32_t words, uint32_t *pos,
+				  struct ipc4_message_request **msg, uint32_t *payload)
+{
+	if (*pos + IPC4_BATCH_HDR_WORDS > words)
+		return IPC4_ERROR_INVALID_PARAM;
+
+	*msg = (struct ipc4_message_request *)&msgs[*pos];
+	*payload = ipc4_batch_payload_words(*msg);
+
+	if (*pos + IPC4_BATCH_HDR_WORDS + *payload > words)
+		return IPC4_ERROR_INVALID_PARAM;
+
+	*pos += IPC4_BATCH_HDR_WORDS + *payload;
+
+	return 0;
+}
+
+#endif /* __SOF_IPC_IPC4_BATCH_H__ */
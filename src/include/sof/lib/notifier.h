@@ -37,8 +37,18 @@ enum notify_id {
 	NOTIFIER_ID_COUNT
 };
 
+/* Callbacks registered with a caller filter are kept in lists indexed by a
+ * hash of the caller, so an event walks only the callbacks that can match
+ * it, e.g. the probes of one buffer instead of the probes of all buffers.
+ * The hash lists of a type are allocated on the first such registration.
+ */
+#define NOTIFIER_CALLER_HASH_BITS	3
+#define NOTIFIER_CALLER_HASH_SIZE	(1 << NOTIFIER_CALLER_HASH_BITS)
+
 struct notify {
-	struct list_item list[NOTIFIER_ID_COUNT]; /* list of callback handles */
+	struct list_item list[NOTIFIER_ID_COUNT]; /* callbacks without caller filter */
+	struct list_item *caller_list[NOTIFIER_ID_COUNT]; /* callbacks by caller hash */
+	uint16_t num_handles[NOTIFIER_ID_COUNT]; /* callbacks of each type */
 	struct k_spinlock lock;	/* list lock */
 };
 
@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_LIB_SLAB_H__
+#define __SOF_LIB_SLAB_H__
+
+#include <rtos/alloc.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Per core caches of fixed size objects. Objects are rounded up to a power
+ * of two size class and taken from a free list in O(1). When the free list
+ * is empty a new chunk of objects is allocated from the heap, the chunks are
+ * kept by the cache and never returned to the heap.
+ *
+ * SOF_MEM_ZONE_RUNTIME_SHARED objects can be freed on any core, the object
+ * is then added to the cache of the freeing core. SOF_MEM_ZONE_RUNTIME
+ * objects must be freed on the allocating core. Objects larger than the
+ * biggest size class and other zones use rzalloc() and rfree() directly.
+ */
+
+/** \brief Smallest size class as power of two, 64 bytes. */
+#define SLAB_CLASS_MIN_SHIFT	6
+
+/** \brief Number of size classes, 64 to 1024 bytes. */
+#define SLAB_CLASS_COUNT	5
+
+/** \brief Biggest object served from the caches. */
+#define SLAB_OBJECT_MAX_SIZE	(1 << (SLAB_CLASS_MIN_SHIFT + SLAB_CLASS_COUNT - 1))
+
+/** \brief Heap allocation size for a chunk of new objects. */
+#define SLAB_CHUNK_SIZE		1024
+
+/** \brief Size class cache statistics. */
+struct slab_stats {
+	int32_t in_use;		/**< allocated minus freed objects on this core */
+	int32_t high_water;	/**< max in_use since boot */
+	uint32_t misses;	/**< allocations that needed a new chunk */
+	uint32_t free;		/**< objects in the free list */
+};
+
+/**
+ * \brief Allocates zeroed object from the size class cache of current core.
+ * \param[in] zone SOF_MEM_ZONE_RUNTIME or SOF_MEM_ZONE_RUNTIME_SHARED.
+ * \param[in] bytes Object size.
+ * \return Pointer to the object or NULL if failed.
+ */
+void *slab_alloc(enum mem_zone zone, size_t bytes);
+
+/**
+ * \brief Returns object to the size class cache of current core.
+ * \param[in] zone Memory zone used in slab_alloc().
+ * \param[in] ptr Object pointer, can be NULL.
+ * \param[in] bytes Size used in slab_alloc().
+ */
+void slab_free(enum mem_zone zone, void *ptr, size_t bytes);
+
+/**
+ * \brief Gets statistics of a size class cache.
+ * \param[in] core ID of the core.
+ * \param[in] zone SOF_MEM_ZONE_RUNTIME or SOF_MEM_ZONE_RUNTIME_SHARED.
+ * \param[in] bytes Object size for the size class.
+ * \param[out] stats Statistics.
+ * \return 0 on success, -EINVAL if there is no cache for the arguments.
+ */
+int slab_get_stats(int core, enum mem_zone zone, size_t bytes, struct slab_stats *stats);
+
+#endif /* __SOF_LIB_SLAB_H__ */
@@ -23,6 +23,8 @@ enum dct_type {
 
 struct dct_plan_16 {
 	struct mat_matrix_16b *matrix;
+	int16_t *cos_table; /**< Scaled cos() for 4 x num_in angles, Q1.15 */
+	int16_t dc_coef; /**< Coefficient for first output, Q1.15 */
 	int num_in;
 	int num_out;
 	enum dct_type type;
@@ -31,4 +33,8 @@ struct dct_plan_16 {
 
 int dct_initialize_16(struct dct_plan_16 *dct);
 
+int dct_initialize_table_16(struct dct_plan_16 *dct);
+
+void dct_execute_16(const struct dct_plan_16 *dct, const int16_t *in, int16_t *out);
+
 #endif /* __SOF_MATH_DCT_H__ */
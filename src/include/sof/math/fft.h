@@ -49,12 +49,35 @@ struct fft_plan {
 	struct icomplex32 *outb32;	/* pointer to output integer complex buffer */
 	struct icomplex16 *inb16;	/* pointer to input integer complex buffer */
 	struct icomplex16 *outb16;	/* pointer to output integer complex buffer */
+	int32_t *real32;	/* pointer to real buffer of real FFT */
+	int16_t *real16;	/* pointer to real buffer of real FFT */
+	struct icomplex32 *twiddle32;	/* cached real FFT split twiddle factors */
+	struct icomplex16 *twiddle16;	/* cached real FFT split twiddle factors */
+	struct fft_plan *half;	/* N/2 size complex plan for real FFT */
 };
 
+/* twiddle factor tables, defined in twiddle_16.h and twiddle_32.h */
+extern const int16_t twiddle_real_16[];
+extern const int16_t twiddle_imag_16[];
+extern const int32_t twiddle_real_32[];
+extern const int32_t twiddle_imag_32[];
+
 /* interfaces of the library */
 struct fft_plan *fft_plan_new(void *inb, void *outb, uint32_t size, int bits);
 void fft_execute_16(struct fft_plan *plan, bool ifft);
 void fft_execute_32(struct fft_plan *plan, bool ifft);
 void fft_plan_free(struct fft_plan *plan16);
 
+/*
+ * Real FFT of size N is computed with N/2 size complex FFT. The forward
+ * transform reads N real samples from real_buf and writes the N/2 + 1 bins
+ * from DC to Nyquist frequency to complex_buf. The inverse transform reads
+ * the N/2 + 1 bins from complex_buf, overwrites it as scratch, and writes
+ * N real samples to real_buf. The scaling is the same as for the complex
+ * fft_execute_16() and fft_execute_32().
+ */
+struct fft_plan *fft_plan_new_real(void *real_buf, void *complex_buf, uint32_t size, int bits);
+void fft_execute_real_16(struct fft_plan *plan, bool ifft);
+void fft_execute_real_32(struct fft_plan *plan, bool ifft);
+
 #endif /* __SOF_FFT_H__ */
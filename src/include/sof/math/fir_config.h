@@ -34,6 +34,7 @@
 #define FIR_GENERIC	0
 #define FIR_HIFIEP	0
 #define FIR_HIFI3	1
+#define FIR_X86		0
 #endif
 
 /* Select optimized code variant when xt-xcc compiler is used */
@@ -50,11 +51,20 @@
 #else
 #error "No HIFIEP or HIFI3 found. Cannot build FIR module."
 #endif
+#define FIR_X86		0
 #else
 /* GCC */
 #define FIR_GENERIC	1
 #define FIR_HIFIEP	0
 #define FIR_HIFI3	0
+/* The generic state is used also with x86 host SIMD, only the filter
+ * kernels are replaced by the SSE4.1 or AVX2 versions in fir_x86.c.
+ */
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#define FIR_X86		1
+#else
+#define FIR_X86		0
+#endif
 #endif
 #endif
 
@@ -44,5 +44,16 @@ int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x);
 
 void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *y0, int32_t *y1);
 
+/* Filters n samples from x to y. The taps - 1 words before x are used for
+ * the filter history, so the caller must reserve them in the buffer. The
+ * state continues as if the samples were filtered one by one.
+ */
+void fir_32x16_block(struct fir_state_32x16 *fir, int32_t *x, int32_t *y, int n);
+
+/* Filters n samples from x to y without the delay line. The taps - 1
+ * words before x must contain the previous input samples.
+ */
+void fir_32x16_linear(struct fir_state_32x16 *fir, const int32_t *x, int32_t *y, int n);
+
 #endif
 #endif /* __SOF_MATH_FIR_GENERIC_H__ */
@@ -22,10 +22,17 @@
 #define IIR_DF1_GENERIC	1
 #define IIR_DF1_HIFI3	0
 #endif /* XCHAL_HAVE_HIFI3 */
+#define IIR_DF1_X86	0
 #else
 /* GCC */
 #define IIR_DF1_GENERIC	1
 #define IIR_DF1_HIFI3	0
+/* The multichannel version in iir_df1_x86.c needs 64 bit lane compares */
+#if defined(__SSE4_2__) || defined(__AVX2__)
+#define IIR_DF1_X86	1
+#else
+#define IIR_DF1_X86	0
+#endif
 #endif
 
 struct iir_state_df1 {
@@ -50,6 +57,16 @@ void iir_reset_df1(struct iir_state_df1 *iir);
 
 int32_t iir_df1(struct iir_state_df1 *iir, int32_t x);
 
+#if IIR_DF1_X86
+/*
+ * Filter frames of interleaved Q1.31 samples with one filter per channel,
+ * bit-exact with iir_df1(). Channels with the same number of sections are
+ * filtered in SIMD lanes. x and y can point to the same buffer.
+ */
+void iir_df1_multich(struct iir_state_df1 *iir[], int nch, const int32_t *x,
+		     int32_t *y, int frames);
+#endif
+
 /* Inline functions */
 #if IIR_DF1_HIFI3
 #include "iir_df1_hifi3.h"
@@ -27,6 +27,7 @@
 #if IIR_AUTOARCH == 0
 #define IIR_GENERIC	1
 #define IIR_HIFI3	0
+#define IIR_X86		0
 #endif
 
 /* Select optimized code variant when xt-xcc compiler is used */
@@ -40,10 +41,17 @@
 #define IIR_GENERIC	1
 #define IIR_HIFI3	0
 #endif /* XCHAL_HAVE_HIFI3 */
+#define IIR_X86		0
 #else
 /* GCC */
 #define IIR_GENERIC	1
 #define IIR_HIFI3	0
+/* The multichannel version in iir_df2t_x86.c needs 64 bit lane compares */
+#if defined(__SSE4_2__) || defined(__AVX2__)
+#define IIR_X86		1
+#else
+#define IIR_X86		0
+#endif
 #endif /* __XCC__ */
 #endif /* IIR_AUTOARCH */
 
@@ -75,6 +83,16 @@ void iir_reset_df2t(struct iir_state_df2t *iir);
 
 int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x);
 
+#if IIR_X86
+/*
+ * Filter frames of interleaved Q1.31 samples with one filter per channel,
+ * bit-exact with iir_df2t(). Channels with the same number of sections are
+ * filtered in SIMD lanes. x and y can point to the same buffer.
+ */
+void iir_df2t_multich(struct iir_state_df2t *iir[], int nch, const int32_t *x,
+		      int32_t *y, int frames);
+#endif
+
 /* Inline functions with or without HiFi3 intrinsics */
 #if IIR_HIFI3
 #include "iir_df2t_hifi3.h"
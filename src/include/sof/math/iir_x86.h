@@ -0,0 +1,185 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_MATH_IIR_X86_H__
+#define __SOF_MATH_IIR_X86_H__
+
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * Vector helpers for the x86 multichannel biquads. Each 64 bit lane holds
+ * one channel. Samples and coefficients are kept sign extended to 64 bits
+ * so that the 32x32 bit multiply of the low halves gives the exact product
+ * and the 64 bit adds wrap the same way as the generic C code.
+ */
+
+#if defined(__AVX2__)
+
+#define IIR_X86_LANES	4
+
+#define iir_vec		__m256i
+
+static inline iir_vec iir_vec_set1(int64_t x)
+{
+	return _mm256_set1_epi64x(x);
+}
+
+static inline iir_vec iir_vec_load64(const int64_t *p)
+{
+	return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline void iir_vec_store64(int64_t *p, iir_vec v)
+{
+	_mm256_storeu_si256((__m256i *)p, v);
+}
+
+/* load four consecutive int32 samples, i.e. four channels of a frame */
+static inline iir_vec iir_vec_load32(const int32_t *p)
+{
+	return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)p));
+}
+
+static inline void iir_vec_store32(int32_t *p, iir_vec v)
+{
+	const __m256i even = _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0);
+
+	v = _mm256_permutevar8x32_epi32(v, even);
+	_mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+}
+
+static inline iir_vec iir_vec_add(iir_vec a, iir_vec b)
+{
+	return _mm256_add_epi64(a, b);
+}
+
+static inline iir_vec iir_vec_mul(iir_vec a, iir_vec b)
+{
+	return _mm256_mul_epi32(a, b);
+}
+
+static inline iir_vec iir_vec_min(iir_vec a, iir_vec b)
+{
+	return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+}
+
+static inline iir_vec iir_vec_max(iir_vec a, iir_vec b)
+{
+	return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+}
+
+/* arithmetic right shift of each lane by the count in the same lane */
+static inline iir_vec iir_vec_srav(iir_vec a, iir_vec count)
+{
+	__m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+	__m256i fill = _mm256_sub_epi64(_mm256_set1_epi64x(64), count);
+
+	return _mm256_or_si256(_mm256_srlv_epi64(a, count), _mm256_sllv_epi64(sign, fill));
+}
+
+static inline iir_vec iir_vec_srai(iir_vec a, int count)
+{
+	__m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+
+	return _mm256_or_si256(_mm256_srl_epi64(a, _mm_cvtsi32_si128(count)),
+			       _mm256_sll_epi64(sign, _mm_cvtsi32_si128(64 - count)));
+}
+
+#else /* SSE4.2 */
+
+#define IIR_X86_LANES	2
+
+#define iir_vec		__m128i
+
+static inline iir_vec iir_vec_set1(int64_t x)
+{
+	return _mm_set1_epi64x(x);
+}
+
+static inline iir_vec iir_vec_load64(const int64_t *p)
+{
+	return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void iir_vec_store64(int64_t *p, iir_vec v)
+{
+	_mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline iir_vec iir_vec_load32(const int32_t *p)
+{
+	return _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)p));
+}
+
+static inline void iir_vec_store32(int32_t *p, iir_vec v)
+{
+	_mm_storel_epi64((__m128i *)p, _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline iir_vec iir_vec_add(iir_vec a, iir_vec b)
+{
+	return _mm_add_epi64(a, b);
+}
+
+static inline iir_vec iir_vec_mul(iir_vec a, iir_vec b)
+{
+	return _mm_mul_epi32(a, b);
+}
+
+static inline iir_vec iir_vec_min(iir_vec a, iir_vec b)
+{
+	return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b));
+}
+
+static inline iir_vec iir_vec_max(iir_vec a, iir_vec b)
+{
+	return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(b, a));
+}
+
+static inline iir_vec iir_vec_srai(iir_vec a, int count)
+{
+	__m128i sign = _mm_cmpgt_epi64(_mm_setzero_si128(), a);
+
+	return _mm_or_si128(_mm_srl_epi64(a, _mm_cvtsi32_si128(count)),
+			    _mm_sll_epi64(sign, _mm_cvtsi32_si128(64 - count)));
+}
+
+/* SSE has no per lane shift count, shift with both counts and blend */
+static inline iir_vec iir_vec_srav(iir_vec a, iir_vec count)
+{
+	__m128i sign = _mm_cmpgt_epi64(_mm_setzero_si128(), a);
+	__m128i fill = _mm_sub_epi64(_mm_set1_epi64x(64), count);
+	__m128i count_hi = _mm_unpackhi_epi64(count, count);
+	__m128i fill_hi = _mm_unpackhi_epi64(fill, fill);
+	__m128i lo = _mm_or_si128(_mm_srl_epi64(a, count), _mm_sll_epi64(sign, fill));
+	__m128i hi = _mm_or_si128(_mm_srl_epi64(a, count_hi), _mm_sll_epi64(sign, fill_hi));
+
+	return _mm_blend_epi16(lo, hi, 0xf0);
+}
+
+#endif /* __AVX2__ */
+
+static inline iir_vec iir_vec_sat32(iir_vec a)
+{
+	a = iir_vec_min(a, iir_vec_set1(INT32_MAX));
+	return iir_vec_max(a, iir_vec_set1(INT32_MIN));
+}
+
+/* sat_int32(Q_SHIFT_RND(a, n + 1, 0)) with constant shift n */
+static inline iir_vec iir_vec_rnd_sat32(iir_vec a, int n)
+{
+	a = iir_vec_add(iir_vec_srai(a, n), iir_vec_set1(1));
+	return iir_vec_sat32(iir_vec_srai(a, 1));
+}
+
+/* sat_int32(Q_SHIFT_RND(a, n + 1, 0)) with shift n per lane */
+static inline iir_vec iir_vec_rnd_sat32_v(iir_vec a, iir_vec n)
+{
+	a = iir_vec_add(iir_vec_srav(a, n), iir_vec_set1(1));
+	return iir_vec_sat32(iir_vec_srai(a, 1));
+}
+
+#endif /* __SOF_MATH_IIR_X86_H__ */
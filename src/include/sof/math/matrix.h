@@ -15,6 +15,21 @@
 #include <stdint.h>
 #include <string.h>
 
+/* The x86 host builds use the SSE4.1 or AVX2 versions of the multiply
+ * functions from matrix_x86.c instead of the generic versions in matrix.c.
+ */
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#define MATRIX_X86	1
+#else
+#define MATRIX_X86	0
+#endif
+
+/* Number of columns of b and c processed in one strip by the blocked
+ * multiply. The strip of b is reused from cache for all rows of a and
+ * the 32 bit sums of one row of the strip are kept in a stack array.
+ */
+#define MAT_BLOCK_COLUMNS	64
+
 struct mat_matrix_16b {
 	int16_t rows;
 	int16_t columns;
@@ -75,9 +90,59 @@ static inline int16_t *mat_get_row_vector_16b(struct mat_matrix_16b *mat, int ro
 	return mat->data + row * mat->columns;
 }
 
+/* Round a 32 bit sum of products to the output Q format, the shift is
+ * a->fractions + b->fractions - c->fractions - 1 and -1 for Q0 data.
+ */
+static inline int16_t mat_round_acc32(int32_t s, int shift_minus_one)
+{
+	if (shift_minus_one == -1)
+		return (int16_t)s;
+
+	return (int16_t)((((int64_t)s >> shift_minus_one) + 1) >> 1);
+}
+
 int mat_multiply(struct mat_matrix_16b *a, struct mat_matrix_16b *b, struct mat_matrix_16b *c);
 
 int mat_multiply_elementwise(struct mat_matrix_16b *a, struct mat_matrix_16b *b,
 			     struct mat_matrix_16b *c);
 
+/**
+ * \brief Transpose a matrix.
+ * \param[in] a Input matrix.
+ * \param[out] at Output matrix, a->columns rows and a->rows columns.
+ * \return Zero on success, -EINVAL if the dimensions do not match.
+ */
+int mat_transpose_16b(const struct mat_matrix_16b *a, struct mat_matrix_16b *at);
+
+/**
+ * \brief Cache blocked matrix multiply c = a * b with 32 bit accumulation.
+ *
+ * The products are summed to 32 bits without saturation, so the caller
+ * must ensure the sums fit, e.g. Q1.15 data needs log2(a->columns) bits of
+ * headroom. The result is then the same as from mat_multiply().
+ * \param[in] a Input matrix a.
+ * \param[in] b Input matrix b, a->columns rows.
+ * \param[out] c Output matrix, a->rows rows and b->columns columns.
+ * \return Zero on success, -EINVAL if the dimensions do not match.
+ */
+int mat_multiply_acc32(const struct mat_matrix_16b *a, const struct mat_matrix_16b *b,
+		       struct mat_matrix_16b *c);
+
+/**
+ * \brief Matrix multiply c = a * bt' with pre-transposed b and 32 bit
+ *	   accumulation.
+ *
+ * Each output is a dot product of two contiguous rows, this is the fastest
+ * form when b is constant and can be transposed once, e.g. a matrix-vector
+ * product with a single row a. The accumulation is as in
+ * mat_multiply_acc32().
+ * \param[in] a Input matrix a.
+ * \param[in] bt Transposed input matrix b, a->columns columns.
+ * \param[out] c Output matrix, a->rows rows and bt->rows columns.
+ * \return Zero on success, -EINVAL if the dimensions do not match.
+ */
+int mat_multiply_transposed_acc32(const struct mat_matrix_16b *a,
+				  const struct mat_matrix_16b *bt,
+				  struct mat_matrix_16b *c);
+
 #endif /* __SOF_MATH_MATRIX_H__ */
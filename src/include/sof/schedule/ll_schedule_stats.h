@@ -0,0 +1,123 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+/*
+ * Low latency scheduler statistics. Every LL task keeps a log2 histogram
+ * of its execution time and a count of runs that exceeded the scheduler
+ * tick, every core keeps the time spent running LL ticks. The per core
+ * data is published to shared memory once per window, so that the IPC
+ * core can read it without stopping the schedulers.
+ */
+
+#ifndef __SOF_SCHEDULE_LL_SCHEDULE_STATS_H__
+#define __SOF_SCHEDULE_LL_SCHEDULE_STATS_H__
+
+#include <sof/lib/uuid.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct task;
+
+/* histogram bin i counts runs of [2^(i + SHIFT), 2^(i + SHIFT + 1)) cycles,
+ * the first and last bins also count everything below and above
+ */
+#define LL_STATS_HIST_BINS	16
+#define LL_STATS_HIST_SHIFT	6
+
+/* published window size 2^x ticks */
+#define LL_STATS_WINDOW_SIZE	10
+
+/* maximum number of tasks published per core */
+#define LL_STATS_MAX_TASKS	8
+
+/* per task statistics, counters are cumulative and wrap */
+struct ll_task_stats {
+	uint32_t hist[LL_STATS_HIST_BINS];	/* log2 histogram of run cycles */
+	uint32_t runs;				/* number of runs */
+	uint32_t overruns;			/* runs longer than the tick budget */
+	uint32_t cycles_max;			/* longest run */
+};
+
+/* per scheduler (core) statistics */
+struct ll_sched_stats {
+	uint64_t window_start;	/* cycles at the start of the current window */
+	uint64_t window_busy;	/* cycles spent in ticks of the current window */
+	uint32_t ticks;		/* number of ticks */
+	uint32_t overruns;	/* ticks longer than the tick budget */
+	uint32_t budget;	/* tick budget in cycles */
+	uint16_t window_ticks;	/* ticks in the current window */
+	uint16_t core;		/* core ID of the scheduler */
+};
+
+/* task snapshot as published */
+struct ll_task_stats_info {
+	struct sof_uuid uuid;		/* task UUID */
+	uint32_t id;			/* tag telling tasks with the same UUID apart */
+	uint32_t priority;
+	struct ll_task_stats stats;
+};
+
+/* core snapshot as published */
+struct ll_core_stats_info {
+	uint32_t ticks;
+	uint32_t overruns;
+	uint32_t budget;
+	uint32_t window_cycles;		/* length of the last window */
+	uint32_t window_busy;		/* cycles spent in ticks in the last window */
+	uint32_t task_count;		/* number of tasks in the scheduler */
+	uint32_t task_info_count;	/* number of valid entries in tasks */
+	struct ll_task_stats_info tasks[LL_STATS_MAX_TASKS];
+};
+
+/**
+ * \brief Initializes statistics of a scheduler.
+ * \param[in,out] stats Scheduler statistics.
+ * \param[in] core ID of the scheduler core.
+ */
+void ll_stats_init(struct ll_sched_stats *stats, int core);
+
+/**
+ * \brief Accounts one run of a task.
+ * \param[in,out] stats Scheduler statistics.
+ * \param[in,out] task The task which has run.
+ * \param[in] cycles Number of cycles spent in the run.
+ */
+void ll_stats_task_run(struct ll_sched_stats *stats, struct task *task, uint32_t cycles);
+
+/**
+ * \brief Accounts one scheduler tick. At the end of a window it starts
+ *	  publishing the statistics, the caller must then pass all its tasks
+ *	  to ll_stats_publish_task() and finish with ll_stats_publish().
+ * \param[in,out] stats Scheduler statistics.
+ * \param[in] start Cycles at the start of the tick.
+ * \param[in] end Cycles at the end of the tick.
+ * \return True at the end of a window.
+ */
+bool ll_stats_tick(struct ll_sched_stats *stats, uint64_t start, uint64_t end);
+
+/**
+ * \brief Publishes statistics of a task. Must be called with the task list
+ *	  locked.
+ * \param[in] stats Scheduler statistics.
+ * \param[in] task A task of the scheduler.
+ */
+void ll_stats_publish_task(struct ll_sched_stats *stats, struct task *task);
+
+/**
+ * \brief Finishes publishing the statistics of a window.
+ * \param[in] stats Scheduler statistics.
+ */
+void ll_stats_publish(struct ll_sched_stats *stats);
+
+/**
+ * \brief Reads the last published statistics of a core.
+ * \param[in] core ID of the core.
+ * \param[out] info Copy of the statistics.
+ * \return 0 if succeeded, -ENODATA if nothing was published yet, -EAGAIN if
+ *	   the core is publishing.
+ */
+int ll_stats_get(int core, struct ll_core_stats_info *info);
+
+#endif /* __SOF_SCHEDULE_LL_SCHEDULE_STATS_H__ */
@@ -0,0 +1,195 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+/*
+ * LL task queue indexed by priority. Tasks are kept in one FIFO list per
+ * priority and a bitmap tells which lists are not empty, so adding and
+ * removing tasks doesn't scan the queue and walking it only visits
+ * non-empty lists. The order of the walk is the order of a single list
+ * sorted by priority with first-come-first-serve among equal priorities.
+ *
+ * A task added next to a reference task goes to the list of the reference
+ * whatever its priority, which makes the list mixed. While any mixed list
+ * is queued, adding a task walks the queue and inserts the task before the
+ * first task of a lower priority, as the single sorted list did.
+ */
+
+#ifndef __SOF_SCHEDULE_LL_TASK_QUEUE_H__
+#define __SOF_SCHEDULE_LL_TASK_QUEUE_H__
+
+#include <sof/common.h>
+#include <sof/list.h>
+#include <sof/math/numbers.h>
+#include <sof/schedule/task.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* number of priority lists, higher priorities share the last list,
+ * which is kept sorted
+ */
+#define LL_TASK_QUEUE_LISTS	32
+
+struct ll_task_queue {
+	uint32_t mask;					/* non-empty lists */
+	uint32_t mixed;					/* lists with other priorities */
+	struct list_item lists[LL_TASK_QUEUE_LISTS];	/* per priority FIFOs */
+};
+
+static inline void ll_task_queue_init(struct ll_task_queue *queue)
+{
+	int i;
+
+	queue->mask = 0;
+	queue->mixed = 0;
+
+	for (i = 0; i < LL_TASK_QUEUE_LISTS; i++)
+		list_init(&queue->lists[i]);
+}
+
+static inline bool ll_task_queue_is_empty(const struct ll_task_queue *queue)
+{
+	return !queue->mask;
+}
+
+/* index of the first non-empty list after index, -1 for the first one */
+static inline int ll_task_queue_next_list(const struct ll_task_queue *queue, int index)
+{
+	uint32_t mask = index + 1 < LL_TASK_QUEUE_LISTS ?
+		queue->mask & ~((1u << (index + 1)) - 1) : 0;
+
+	return mask ? ffs(mask) - 1 : LL_TASK_QUEUE_LISTS;
+}
+
+/* Position of a task in a queue with mixed lists, before the first task of
+ * a lower priority or at the end of the queue. The end of the own list of
+ * the task is used when it is the same position. Sets index to the list.
+ */
+static inline struct list_item *ll_task_queue_find(struct ll_task_queue *queue,
+						   struct task *task, int *index)
+{
+	struct list_item *item;
+	struct task *task_iter;
+	int own = *index;
+	int i;
+
+	for (i = ll_task_queue_next_list(queue, -1); i < LL_TASK_QUEUE_LISTS;
+	     i = ll_task_queue_next_list(queue, i)) {
+		*index = i;
+
+		/* other lists only hold the priority of the list */
+		if (i < LL_TASK_QUEUE_LISTS - 1 && !(queue->mixed & (1u << i))) {
+			if (task->priority < i)
+				break;
+			continue;
+		}
+
+		list_for_item(item, &queue->lists[i]) {
+			task_iter = container_of(item, struct task, list);
+			if (task->priority < task_iter->priority)
+				return item;
+		}
+	}
+
+	/* end of the queue */
+	if (i == LL_TASK_QUEUE_LISTS) {
+		*index = MAX(*index, own);
+		return &queue->lists[*index];
+	}
+
+	/* first task of a list after the own one, nothing queued in between */
+	if (!(queue->mask & ((1u << i) - (2u << own)))) {
+		*index = own;
+		return &queue->lists[own];
+	}
+
+	return queue->lists[i].next;
+}
+
+/**
+ * \brief Adds a task after all tasks of the same or higher priority.
+ * \param[in,out] queue Task queue.
+ * \param[in,out] task The task to add.
+ * \return Index of the list the task was added to.
+ */
+static inline int ll_task_queue_add(struct ll_task_queue *queue, struct task *task)
+{
+	int index = MIN(task->priority, LL_TASK_QUEUE_LISTS - 1);
+	struct list_item *list = &queue->lists[index];
+	struct list_item *item;
+	struct task *task_iter;
+
+	if (queue->mask & queue->mixed) {
+		item = ll_task_queue_find(queue, task, &index);
+		list_item_append(&task->list, item);
+		if (index != MIN(task->priority, LL_TASK_QUEUE_LISTS - 1))
+			queue->mixed |= 1u << index;
+		queue->mask |= 1u << index;
+		return index;
+	}
+
+	queue->mask |= 1u << index;
+
+	if (index < LL_TASK_QUEUE_LISTS - 1) {
+		list_item_append(&task->list, list);
+		return index;
+	}
+
+	/* the last list holds different priorities, keep it sorted */
+	list_for_item(item, list) {
+		task_iter = container_of(item, struct task, list);
+		if (task->priority < task_iter->priority)
+			break;
+	}
+
+	list_item_append(&task->list, item);
+	return index;
+}
+
+/**
+ * \brief Adds a task just before or after a queued task, the list is
+ *	  mixed if the priorities differ.
+ * \param[in,out] queue Task queue.
+ * \param[in,out] task The task to add.
+ * \param[in,out] reference Queued task.
+ * \param[in] index The list holding the reference task.
+ * \param[in] before Adds the task before the reference if true.
+ */
+static inline void ll_task_queue_add_next_to(struct ll_task_queue *queue, struct task *task,
+					     struct task *reference, int index, bool before)
+{
+	if (before)
+		list_item_append(&task->list, &reference->list);
+	else
+		list_item_prepend(&task->list, &reference->list);
+
+	if (index != MIN(task->priority, LL_TASK_QUEUE_LISTS - 1))
+		queue->mixed |= 1u << index;
+	queue->mask |= 1u << index;
+}
+
+/**
+ * \brief Removes a task from the queue.
+ * \param[in,out] queue Task queue.
+ * \param[in,out] task The task to remove.
+ * \param[in] index The list holding the task.
+ */
+static inline void ll_task_queue_del(struct ll_task_queue *queue, struct task *task, int index)
+{
+	list_item_del(&task->list);
+
+	if (list_is_empty(&queue->lists[index])) {
+		queue->mask &= ~(1u << index);
+		queue->mixed &= ~(1u << index);
+	}
+}
+
+/* walks all queued tasks, the task must not be removed in the loop */
+#define ll_task_queue_for_each(queue, index, item)				\
+	for (index = ll_task_queue_next_list(queue, -1);			\
+	     index < LL_TASK_QUEUE_LISTS;					\
+	     index = ll_task_queue_next_list(queue, index))			\
+		list_for_item(item, &(queue)->lists[index])
+
+#endif /* __SOF_SCHEDULE_LL_TASK_QUEUE_H__ */
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include <rtos/kernel.h>
 #include <sof/lib/perf_cnt.h>
+#include <sof/schedule/ll_schedule_stats.h>
 
 
 struct comp_dev;
@@ -77,6 +78,9 @@ struct task {
 #if CONFIG_PERFORMANCE_COUNTERS
 	struct perf_cnt_data pcd;
 #endif
+#if CONFIG_SCHEDULE_LL_STATS
+	struct ll_task_stats ll_stats;	/**< LL scheduler statistics */
+#endif
 };
 
 static inline bool task_is_active(struct task *task)
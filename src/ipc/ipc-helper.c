@@ -182,6 +182,14 @@ int comp_buffer_connect(struct comp_dev *comp, uint32_t comp_core,
 		/* set the buffer as a coherent object */
 		coherent_shared_thread(buffer, c);
 
+		/* one producer and one consumer core, no lock needed */
+		if (IS_ENABLED(CONFIG_BUFFER_SPSC)) {
+			int ret = buffer_set_spsc(buffer);
+
+			if (ret < 0)
+				return ret;
+		}
+
 		if (!comp->is_shared)
 			comp_make_shared(comp);
 	}
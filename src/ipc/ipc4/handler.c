@@ -19,6 +19,7 @@
 #include <sof/ipc/common.h>
 #include <sof/ipc/msg.h>
 #include <sof/ipc/driver.h>
+#include <sof/ipc/ipc4_batch.h>
 #include <sof/lib/mailbox.h>
 #include <sof/lib/pm_runtime.h>
 #include <sof/math/numbers.h>
@@ -511,6 +512,8 @@ static int ipc4_process_chain_dma(struct ipc4_message_request *ipc4)
 #endif
 }
 
+static int ipc4_process_batch(struct ipc4_message_request *ipc4);
+
 static int ipc4_process_glb_message(struct ipc4_message_request *ipc4)
 {
 	uint32_t type;
@@ -543,6 +546,9 @@ static int ipc4_process_glb_message(struct ipc4_message_request *ipc4)
 	case SOF_IPC4_GLB_SET_PIPELINE_STATE:
 		ret = ipc4_set_pipeline_state(ipc4);
 		break;
+	case SOF_IPC4_GLB_BATCH:
+		ret = ipc4_process_batch(ipc4);
+		break;
 
 	case SOF_IPC4_GLB_GET_PIPELINE_STATE:
 	case SOF_IPC4_GLB_GET_PIPELINE_CONTEXT_SIZE:
@@ -976,6 +982,143 @@ static int ipc4_process_module_message(struct ipc4_message_request *ipc4)
 	return ret;
 }
 
+/*
+ * Batched pipeline construction, see struct ipc4_batch. The messages are run
+ * with the same handlers as when they are sent one by one.
+ */
+
+static int ipc4_process_batch_msg(struct ipc4_message_request *msg,
+				  const uint32_t *payload, uint32_t words)
+{
+	struct ipc4_module_init_instance *init;
+	struct ipc4_module_bind_unbind *bu;
+	struct ipc4_pipeline_create *ppl;
+	struct comp_dev *src;
+	struct comp_dev *sink;
+	int ret;
+
+	/* The messages can not be passed to other cores since only the
+	 * message in the mailbox is forwarded to them.
+	 */
+	if (msg->primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG) {
+		if (msg->primary.r.type != SOF_IPC4_GLB_CREATE_PIPELINE)
+			return IPC4_INVALID_REQUEST;
+
+		ppl = (struct ipc4_pipeline_create *)msg;
+		if (!cpu_is_me(ppl->extension.r.core_id))
+			return IPC4_INVALID_CORE_ID;
+
+		return ipc4_new_pipeline(msg);
+	}
+
+	switch (msg->primary.r.type) {
+	case SOF_IPC4_MOD_INIT_INSTANCE:
+		init = (struct ipc4_module_init_instance *)msg;
+		if (!cpu_is_me(init->extension.r.core_id))
+			return IPC4_INVALID_CORE_ID;
+
+		/* module init reads the parameters from the mailbox */
+		if (words) {
+			ret = memcpy_s((void *)MAILBOX_HOSTBOX_BASE, MAILBOX_HOSTBOX_SIZE,
+				       payload, words * sizeof(uint32_t));
+			if (ret < 0)
+				return IPC4_ERROR_INVALID_PARAM;
+
+			dcache_writeback_region((__sparse_force void __sparse_cache *)
+						MAILBOX_HOSTBOX_BASE, words * sizeof(uint32_t));
+		}
+
+		return ipc4_init_module_instance(msg);
+	case SOF_IPC4_MOD_BIND:
+		bu = (struct ipc4_module_bind_unbind *)msg;
+		src = ipc4_get_comp_dev(IPC4_COMP_ID(bu->primary.r.module_id,
+						     bu->primary.r.instance_id));
+		sink = ipc4_get_comp_dev(IPC4_COMP_ID(bu->extension.r.dst_module_id,
+						      bu->extension.r.dst_instance_id));
+		if ((src && !cpu_is_me(src->ipc_config.core)) ||
+		    (sink && !cpu_is_me(sink->ipc_config.core)))
+			return IPC4_INVALID_CORE_ID;
+
+		return ipc4_bind_module_instance(msg);
+	default:
+		return IPC4_INVALID_REQUEST;
+	}
+}
+
+static int ipc4_process_batch(struct ipc4_message_request *ipc4)
+{
+	struct ipc4_message_request *msg;
+	struct ipc4_batch batch;
+	uint32_t *status;
+	uint32_t *msgs;
+	uint32_t status_size;
+	uint32_t payload;
+	uint32_t words;
+	uint32_t pos = 0;
+	int ret = memcpy_s(&batch, sizeof(batch), ipc4, sizeof(*ipc4));
+	int i;
+
+	if (ret < 0)
+		return IPC4_FAILURE;
+
+	tr_dbg(&ipc_tr, "ipc4_process_batch %u messages %u bytes",
+	       (uint32_t)batch.primary.r.num_msgs, (uint32_t)batch.extension.r.data_size);
+
+	ret = ipc4_batch_check(&batch, MAILBOX_HOSTBOX_SIZE, SOF_IPC_MSG_MAX_SIZE);
+	if (ret)
+		return ret;
+
+	/* the messages are copied out since module init uses the mailbox */
+	words = batch.extension.r.data_size / sizeof(uint32_t);
+	msgs = rballoc(0, SOF_MEM_CAPS_RAM, batch.extension.r.data_size);
+	if (!msgs)
+		return IPC4_OUT_OF_MEMORY;
+
+	/* the status of each message goes to the reply mailbox */
+	status_size = batch.primary.r.num_msgs * sizeof(uint32_t);
+	status = status_size ? rballoc(0, SOF_MEM_CAPS_RAM, status_size) : NULL;
+	if (status_size && !status) {
+		tr_err(&ipc_tr, "error: failed to allocate tx_data");
+		rfree(msgs);
+		return IPC4_OUT_OF_MEMORY;
+	}
+
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)MAILBOX_HOSTBOX_BASE,
+				 batch.extension.r.data_size);
+	ret = memcpy_s(msgs, batch.extension.r.data_size, (const void *)MAILBOX_HOSTBOX_BASE,
+		       batch.extension.r.data_size);
+	if (ret < 0) {
+		rfree(status);
+		rfree(msgs);
+		return IPC4_FAILURE;
+	}
+
+	for (i = 0; i < batch.primary.r.num_msgs; i++)
+		status[i] = IPC4_UNAVAILABLE;
+
+	for (i = 0; i < batch.primary.r.num_msgs; i++) {
+		ret = ipc4_batch_next(msgs, words, &pos, &msg, &payload);
+		if (!ret)
+			ret = ipc4_process_batch_msg(msg, (uint32_t *)msg + IPC4_BATCH_HDR_WORDS,
+						     payload);
+
+		status[i] = ret;
+		if (ret) {
+			tr_err(&ipc_tr, "ipc4_process_batch: message %d failed %d", i, ret);
+			break;
+		}
+	}
+
+	rfree(msgs);
+
+	if (status_size) {
+		msg_reply.tx_data = status;
+		msg_reply.tx_size = status_size;
+	}
+
+	return ret;
+}
+
 struct ipc_cmd_hdr *mailbox_validate(void)
 {
 	struct ipc_cmd_hdr *hdr = ipc_get()->comp_data;
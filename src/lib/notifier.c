@@ -37,12 +37,42 @@ struct callback_handle {
 	uint32_t num_registrations;
 };
 
+/* hash list of the caller, the low bits of the caller pointers are mostly
+ * zero so the high bits of a multiplicative hash are used
+ */
+static struct list_item *notifier_caller_list(struct notify *notify, const void *caller,
+					      enum notify_id type)
+{
+	uint32_t hash = (uint32_t)(uintptr_t)caller * 0x9e3779b1;
+
+	return &notify->caller_list[type][hash >> (32 - NOTIFIER_CALLER_HASH_BITS)];
+}
+
+static int notifier_caller_list_alloc(struct notify *notify, enum notify_id type)
+{
+	struct list_item *caller_list;
+	int i;
+
+	caller_list = rzalloc(SOF_MEM_ZONE_SYS_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+			      sizeof(*caller_list) * NOTIFIER_CALLER_HASH_SIZE);
+	if (!caller_list)
+		return -ENOMEM;
+
+	for (i = 0; i < NOTIFIER_CALLER_HASH_SIZE; i++)
+		list_init(&caller_list[i]);
+
+	notify->caller_list[type] = caller_list;
+	return 0;
+}
+
 int notifier_register(void *receiver, void *caller, enum notify_id type,
 		      void (*cb)(void *arg, enum notify_id type, void *data),
 		      uint32_t flags)
 {
 	struct notify *notify = *arch_notify_get();
 	struct callback_handle *handle;
+	struct list_item *list;
+	struct list_item *wlist;
 	k_spinlock_key_t key;
 	int ret = 0;
 
@@ -50,14 +80,25 @@ int notifier_register(void *receiver, void *caller, enum notify_id type,
 
 	key = k_spin_lock(&notify->lock);
 
-	/* Find already registered event of this type */
-	if (flags & NOTIFIER_FLAG_AGGREGATE &&
-	    !list_is_empty(&notify->list[type])) {
-		handle = container_of((&notify->list[type])->next,
-				      struct callback_handle, list);
-		handle->num_registrations++;
+	if (caller && !notify->caller_list[type]) {
+		ret = notifier_caller_list_alloc(notify, type);
+		if (ret < 0) {
+			tr_err(&nt_tr, "notifier_register(): caller list allocation failed.");
+			goto out;
+		}
+	}
 
-		goto out;
+	list = caller ? notifier_caller_list(notify, caller, type) : &notify->list[type];
+
+	/* Find already registered event of this type from the same caller */
+	if (flags & NOTIFIER_FLAG_AGGREGATE) {
+		list_for_item(wlist, list) {
+			handle = container_of(wlist, struct callback_handle, list);
+			if (handle->caller == caller) {
+				handle->num_registrations++;
+				goto out;
+			}
+		}
 	}
 
 	handle = rzalloc(SOF_MEM_ZONE_SYS_RUNTIME, 0, SOF_MEM_CAPS_RAM,
@@ -74,20 +115,39 @@ int notifier_register(void *receiver, void *caller, enum notify_id type,
 	handle->cb = cb;
 	handle->num_registrations = 1;
 
-	list_item_prepend(&handle->list, &notify->list[type]);
+	list_item_prepend(&handle->list, list);
+	notify->num_handles[type]++;
 
 out:
 	k_spin_unlock(&notify->lock, key);
 	return ret;
 }
 
-void notifier_unregister(void *receiver, void *caller, enum notify_id type)
+static void notifier_unregister_list(struct notify *notify, struct list_item *list,
+				     void *receiver, void *caller, enum notify_id type)
 {
-	struct notify *notify = *arch_notify_get();
 	struct list_item *wlist;
 	struct list_item *tlist;
 	struct callback_handle *handle;
+
+	list_for_item_safe(wlist, tlist, list) {
+		handle = container_of(wlist, struct callback_handle, list);
+		if ((!receiver || handle->receiver == receiver) &&
+		    (!caller || handle->caller == caller)) {
+			if (!--handle->num_registrations) {
+				list_item_del(&handle->list);
+				rfree(handle);
+				notify->num_handles[type]--;
+			}
+		}
+	}
+}
+
+void notifier_unregister(void *receiver, void *caller, enum notify_id type)
+{
+	struct notify *notify = *arch_notify_get();
 	k_spinlock_key_t key;
+	int i;
 
 	assert(type >= NOTIFIER_ID_CPU_FREQ && type < NOTIFIER_ID_COUNT);
 
@@ -103,14 +163,17 @@ void notifier_unregister(void *receiver, void *caller, enum notify_id type)
 	 * Event consumer might unregister from all callers by passing caller
 	 * NULL
 	 */
-	list_for_item_safe(wlist, tlist, &notify->list[type]) {
-		handle = container_of(wlist, struct callback_handle, list);
-		if ((!receiver || handle->receiver == receiver) &&
-		    (!caller || handle->caller == caller)) {
-			if (!--handle->num_registrations) {
-				list_item_del(&handle->list);
-				rfree(handle);
-			}
+	if (!caller)
+		notifier_unregister_list(notify, &notify->list[type], receiver, NULL, type);
+
+	if (notify->caller_list[type]) {
+		if (caller) {
+			notifier_unregister_list(notify, notifier_caller_list(notify, caller, type),
+						 receiver, caller, type);
+		} else {
+			for (i = 0; i < NOTIFIER_CALLER_HASH_SIZE; i++)
+				notifier_unregister_list(notify, &notify->caller_list[type][i],
+							 receiver, NULL, type);
 		}
 	}
 
@@ -125,29 +188,52 @@ void notifier_unregister_all(void *receiver, void *caller)
 		notifier_unregister(receiver, caller, i);
 }
 
-static void notifier_notify(const void *caller, enum notify_id type, void *data)
+static void notifier_notify_list(struct list_item *list, const void *caller,
+				 enum notify_id type, void *data)
 {
-	struct notify *notify = *arch_notify_get();
 	struct list_item *wlist;
 	struct list_item *tlist;
 	struct callback_handle *handle;
 
-	/* iterate through notifiers and send event to
-	 * interested clients
-	 */
-	list_for_item_safe(wlist, tlist, &notify->list[type]) {
+	list_for_item_safe(wlist, tlist, list) {
 		handle = container_of(wlist, struct callback_handle, list);
-		if (!caller || !handle->caller || handle->caller == caller)
+		if (!caller || handle->caller == caller)
 			handle->cb(handle->receiver, type, data);
 	}
 }
 
+static void notifier_notify(const void *caller, enum notify_id type, void *data)
+{
+	struct notify *notify = *arch_notify_get();
+	int i;
+
+	if (!notify->num_handles[type])
+		return;
+
+	/* iterate through notifiers and send event to
+	 * interested clients, the callbacks without caller filter
+	 * get all events and events without caller go to all callbacks
+	 */
+	notifier_notify_list(&notify->list[type], NULL, type, data);
+
+	if (!notify->caller_list[type])
+		return;
+
+	if (caller) {
+		notifier_notify_list(notifier_caller_list(notify, caller, type), caller, type,
+				     data);
+	} else {
+		for (i = 0; i < NOTIFIER_CALLER_HASH_SIZE; i++)
+			notifier_notify_list(&notify->caller_list[type][i], NULL, type, data);
+	}
+}
+
 void notifier_notify_remote(void)
 {
 	struct notify *notify = *arch_notify_get();
 	struct notify_data *notify_data = notify_data_get() + cpu_get_id();
 
-	if (!list_is_empty(&notify->list[notify_data->type])) {
+	if (notify->num_handles[notify_data->type]) {
 		dcache_invalidate_region((__sparse_force void __sparse_cache *)notify_data->data,
 					 notify_data->data_size);
 		notifier_notify(notify_data->caller, notify_data->type,
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/common.h>
+#include <rtos/alloc.h>
+#include <rtos/spinlock.h>
+#include <rtos/string.h>
+#include <sof/lib/cpu.h>
+#include <sof/lib/memory.h>
+#include <sof/lib/slab.h>
+#include <sof/lib/uuid.h>
+#include <sof/math/numbers.h>
+#include <sof/trace/trace.h>
+#include <ipc/topology.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_REGISTER(slab, CONFIG_SOF_LOG_LEVEL);
+
+/* 7e3d5f8a-3c1b-4d52-9a6e-0f2b8c4d1e73 */
+DECLARE_SOF_UUID("slab", slab_uuid, 0x7e3d5f8a, 0x3c1b, 0x4d52,
+		 0x9a, 0x6e, 0x0f, 0x2b, 0x8c, 0x4d, 0x1e, 0x73);
+
+DECLARE_TR_CTX(slab_tr, SOF_UUID(slab_uuid), LOG_LEVEL_INFO);
+
+/* caches for SOF_MEM_ZONE_RUNTIME and SOF_MEM_ZONE_RUNTIME_SHARED */
+#define SLAB_ZONE_COUNT		2
+
+/* free object, the list link is stored in the object itself */
+struct slab_object {
+	struct slab_object *next;
+};
+
+struct slab_cache {
+	struct slab_object *free_list;
+	struct slab_stats stats;
+};
+
+struct slab_core {
+	struct k_spinlock lock;
+	struct slab_cache cache[SLAB_ZONE_COUNT][SLAB_CLASS_COUNT];
+};
+
+static SHARED_DATA struct slab_core slab_core_data[CONFIG_CORE_COUNT];
+
+static int slab_zone_index(enum mem_zone zone)
+{
+	switch (zone) {
+	case SOF_MEM_ZONE_RUNTIME:
+		return 0;
+	case SOF_MEM_ZONE_RUNTIME_SHARED:
+		return 1;
+	default:
+		return -EINVAL;
+	}
+}
+
+static int slab_class_index(size_t bytes)
+{
+	int class = 0;
+
+	if (!bytes || bytes > SLAB_OBJECT_MAX_SIZE)
+		return -EINVAL;
+
+	while (bytes > (1 << (SLAB_CLASS_MIN_SHIFT + class)))
+		class++;
+
+	return class;
+}
+
+static struct slab_core *slab_core_get(int core)
+{
+	return platform_shared_get(&slab_core_data[core], sizeof(slab_core_data[core]));
+}
+
+/* add a chunk of new objects to an empty free list */
+static int slab_cache_grow(struct slab_cache *cache, enum mem_zone zone, int class)
+{
+	size_t size = 1 << (SLAB_CLASS_MIN_SHIFT + class);
+	int count = MAX(SLAB_CHUNK_SIZE / size, 1);
+	struct slab_object *obj;
+	uint8_t *chunk;
+	int i;
+
+	chunk = rmalloc(zone, 0, SOF_MEM_CAPS_RAM, count * size);
+	if (!chunk)
+		return -ENOMEM;
+
+	for (i = count - 1; i >= 0; i--) {
+		obj = (struct slab_object *)(chunk + i * size);
+		obj->next = cache->free_list;
+		cache->free_list = obj;
+	}
+
+	cache->stats.free += count;
+	cache->stats.misses++;
+	return 0;
+}
+
+void *slab_alloc(enum mem_zone zone, size_t bytes)
+{
+	int zone_idx = slab_zone_index(zone);
+	int class = slab_class_index(bytes);
+	struct slab_object *obj = NULL;
+	struct slab_cache *cache;
+	struct slab_core *sc;
+	k_spinlock_key_t key;
+
+	if (zone_idx < 0 || class < 0)
+		return rzalloc(zone, 0, SOF_MEM_CAPS_RAM, bytes);
+
+	sc = slab_core_get(cpu_get_id());
+	cache = &sc->cache[zone_idx][class];
+
+	key = k_spin_lock(&sc->lock);
+
+	if (!cache->free_list && slab_cache_grow(cache, zone, class) < 0)
+		goto out;
+
+	obj = cache->free_list;
+	cache->free_list = obj->next;
+	cache->stats.free--;
+	cache->stats.in_use++;
+	if (cache->stats.in_use > cache->stats.high_water)
+		cache->stats.high_water = cache->stats.in_use;
+
+out:
+	k_spin_unlock(&sc->lock, key);
+
+	if (!obj) {
+		tr_err(&slab_tr, "slab_alloc(): no memory for %u bytes zone %d",
+		       (uint32_t)bytes, zone);
+		return NULL;
+	}
+
+	bzero(obj, bytes);
+	return obj;
+}
+
+void slab_free(enum mem_zone zone, void *ptr, size_t bytes)
+{
+	int zone_idx = slab_zone_index(zone);
+	int class = slab_class_index(bytes);
+	struct slab_object *obj = ptr;
+	struct slab_cache *cache;
+	struct slab_core *sc;
+	k_spinlock_key_t key;
+
+	if (!ptr)
+		return;
+
+	if (zone_idx < 0 || class < 0) {
+		rfree(ptr);
+		return;
+	}
+
+	sc = slab_core_get(cpu_get_id());
+	cache = &sc->cache[zone_idx][class];
+
+	key = k_spin_lock(&sc->lock);
+
+	obj->next = cache->free_list;
+	cache->free_list = obj;
+	cache->stats.free++;
+	cache->stats.in_use--;
+
+	k_spin_unlock(&sc->lock, key);
+}
+
+int slab_get_stats(int core, enum mem_zone zone, size_t bytes, struct slab_stats *stats)
+{
+	int zone_idx = slab_zone_index(zone);
+	int class = slab_class_index(bytes);
+	struct slab_core *sc;
+	k_spinlock_key_t key;
+
+	if (core < 0 || core >= CONFIG_CORE_COUNT || zone_idx < 0 || class < 0 || !stats)
+		return -EINVAL;
+
+	sc = slab_core_get(core);
+
+	key = k_spin_lock(&sc->lock);
+	*stats = sc->cache[zone_idx][class].stats;
+	k_spin_unlock(&sc->lock, key);
+
+	return 0;
+}
@@ -34,16 +34,14 @@ void psy_apply_mel_filterbank_16(struct psy_mel_filterbank *fb, struct icomplex1
 	for (i = 0; i < fb->half_fft_bins; i++) {
 		p = (int32_t)fft_out[i].real * fft_out[i].real +
 			(int32_t)fft_out[i].imag * fft_out[i].imag;
+		power_spectra[i] = p;
 		pmax = MAX(pmax, p);
 	}
 
-	/* Power spectra is Q2.30 */
+	/* Power spectra is Q2.30. The normalize shift is applied to the Mel band
+	 * energies, it is the same as shifting the power spectra.
+	 */
 	lshift = norm_int32(pmax);
-	for (i = 0; i < fb->half_fft_bins; i++) {
-		p = (int32_t)fft_out[i].real * fft_out[i].real +
-			(int32_t)fft_out[i].imag * fft_out[i].imag;
-		power_spectra[i] = p << lshift;
-	}
 
 	for (i = 0; i < fb->mel_bins; i++) {
 		/* Integrate power spectrum with Mel filter bank triangle weights */
@@ -60,6 +58,8 @@ void psy_apply_mel_filterbank_16(struct psy_mel_filterbank *fb, struct icomplex1
 		for (j = 0; j < num_bins; j++)
 			pp += (int64_t)power_spectra[start_bin + j] * fb->data[coef_idx + j];
 
+		pp <<= lshift;
+
 		/* Convert Mel band energy from Q19.45 to Q7.25 that has sufficient headroom
 		 * for worst-case all ones FFT output. Log2() function input is unsigned Q32.0,
 		 * output is signed Q16.16. The Q7.25 scale log2(2^25) need to be subtracted
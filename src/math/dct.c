@@ -77,3 +77,97 @@ int dct_initialize_16(struct dct_plan_16 *dct)
 
 	return 0;
 }
+
+/**
+ * \brief Initialize a 16 bit DCT-II without the matrix. The coefficient of
+ * input n for output k is cos(pi * (2n + 1) * k / (2 * num_in)) that repeats
+ * with period 4 x num_in, so only a table of the scaled cos() values for the
+ * 4 x num_in angles is stored.
+ * \param[in,out]  dct  In input provide DCT type and size, in output the table
+ */
+int dct_initialize_table_16(struct dct_plan_16 *dct)
+{
+	int32_t arg;
+	int32_t cos;
+	int32_t c1;
+	int16_t c2;
+	int m;
+
+	if (dct->type != DCT_II || dct->ortho != true)
+		return -EINVAL;
+
+	if (dct->num_in < 1 || dct->num_out < 1)
+		return -EINVAL;
+
+	if (dct->num_in > DCT_MATRIX_SIZE_MAX || dct->num_out > DCT_MATRIX_SIZE_MAX)
+		return -EINVAL;
+
+	dct->cos_table = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+				 sizeof(int16_t) * 4 * dct->num_in);
+	if (!dct->cos_table)
+		return -ENOMEM;
+
+	c1 = PI_Q29 / dct->num_in;
+	arg = Q_SHIFT_RND(TWO_Q29 / dct->num_in, 29, 12);
+	c2 = sqrt_int16(arg); /* Q4.12 */
+	for (m = 0; m < 4 * dct->num_in; m++) {
+		/* The angle pi * m / (2 * num_in) is less than 2 * pi */
+		arg = Q_MULTSR_32X32((int64_t)c1, m, 29, 1, 24); /* Q8.24 */
+		cos = cos_fixed_32b(Q_SHIFT_LEFT(arg, 24, 28)); /* Q1.31 */
+		dct->cos_table[m] = sat_int16(Q_MULTSR_32X32((int64_t)cos, c2, 31, 12, 15));
+	}
+
+	dct->dc_coef = Q_MULTSR_32X32((int64_t)dct->cos_table[0], ONE_OVER_SQRT_TWO, 15, 31, 15);
+	return 0;
+}
+
+/**
+ * \brief Compute the DCT-II with the table from dct_initialize_table_16().
+ * The inputs n and num_in - 1 - n share the coefficient with the sign of
+ * (-1)^k, so they are summed before multiply.
+ * \param[in]  dct  DCT plan
+ * \param[in]  in   Input vector of num_in values
+ * \param[out] out  Output vector of num_out values in the Q format of input
+ */
+void dct_execute_16(const struct dct_plan_16 *dct, const int16_t *in, int16_t *out)
+{
+	const int16_t *c = dct->cos_table;
+	const int num_in = dct->num_in;
+	const int num_table = 4 * num_in;
+	const int half = num_in >> 1;
+	int64_t s;
+	int32_t x;
+	int sign;
+	int step;
+	int m;
+	int n;
+	int k;
+
+	/* The coefficient is the same for all inputs */
+	s = 0;
+	for (n = 0; n < num_in; n++)
+		s += in[n];
+
+	s *= dct->dc_coef;
+	out[0] = (int16_t)(((s >> 14) + 1) >> 1); /* Q1.15 x Qx.y -> Qx.y */
+
+	for (k = 1; k < dct->num_out; k++) {
+		sign = (k & 1) ? -1 : 1;
+		step = (2 * k) % num_table;
+		m = k % num_table;
+		s = 0;
+		for (n = 0; n < half; n++) {
+			x = (int32_t)in[n] + sign * in[num_in - 1 - n];
+			s += (int64_t)x * c[m];
+			m += step;
+			if (m >= num_table)
+				m -= num_table;
+		}
+
+		/* The middle input of odd size */
+		if (num_in & 1)
+			s += (int32_t)in[half] * c[m];
+
+		out[k] = (int16_t)(((s >> 14) + 1) >> 1);
+	}
+}
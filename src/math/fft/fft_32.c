@@ -60,6 +60,20 @@ static inline void icomplex32_shift(const struct icomplex32 *input, int32_t n,
 	}
 }
 
+/* radix-2 butterfly: top = top + twiddle * bottom, bottom = top - twiddle * bottom */
+static inline void fft_butterfly_32(struct icomplex32 *top, struct icomplex32 *bottom, int index)
+{
+	struct icomplex32 tmp1;
+	struct icomplex32 tmp2;
+
+	tmp1.real = twiddle_real_32[index];
+	tmp1.imag = twiddle_imag_32[index];
+	icomplex32_mul(&tmp1, bottom, &tmp2);
+	tmp1 = *top;
+	icomplex32_add(&tmp1, &tmp2, top);
+	icomplex32_sub(&tmp1, &tmp2, bottom);
+}
+
 /**
  * \brief Execute the 32-bits Fast Fourier Transform (FFT) or Inverse FFT (IFFT)
  *	  For the configured fft_pan.
@@ -68,13 +82,14 @@ static inline void icomplex32_shift(const struct icomplex32 *input, int32_t n,
  */
 void fft_execute_32(struct fft_plan *plan, bool ifft)
 {
-	struct icomplex32 tmp1;
-	struct icomplex32 tmp2;
+	struct icomplex32 x0;
+	struct icomplex32 x1;
+	struct icomplex32 x2;
+	struct icomplex32 x3;
 	struct icomplex32 *inb;
 	struct icomplex32 *outb;
 	int depth;
 	int top;
-	int bottom;
 	int index;
 	int i;
 	int j;
@@ -97,31 +112,47 @@ void fft_execute_32(struct fft_plan *plan, bool ifft)
 	}
 
 	/* step 1: re-arrange input in bit reverse order, and shrink the level to avoid overflow */
-	for (i = 1; i < plan->size; ++i)
+	for (i = 0; i < plan->size; ++i)
 		icomplex32_shift(&inb[i], -(plan->len), &outb[plan->bit_reverse_idx[i]]);
 
-	/* step 2: loop to do FFT transform in smaller size */
-	for (depth = 1; depth <= plan->len; ++depth) {
-		m = 1 << depth;
-		n = m >> 1;
+	/* step 2: with odd number of stages do first the size 2 transforms with radix-2 */
+	depth = 1;
+	if (plan->len & 1) {
+		for (k = 0; k < plan->size; k += 2)
+			fft_butterfly_32(&outb[k], &outb[k + 1], 0);
+
+		depth = 2;
+	}
+
+	/* step 3: loop to do FFT transform in smaller size with radix-4, each round
+	 * does the size m / 2 and size m radix-2 stages for four points at a time
+	 */
+	for (; depth < plan->len; depth += 2) {
+		m = 1 << (depth + 1);
+		n = m >> 2;
 		i = FFT_SIZE_MAX >> depth;
 
 		/* doing FFT transforms in size m */
 		for (k = 0; k < plan->size; k += m) {
-			/* doing one FFT transform for size m */
 			for (j = 0; j < n; ++j) {
-				index = i * j;
 				top = k + j;
-				bottom = top + n;
-				tmp1.real = twiddle_real_32[index];
-				tmp1.imag = twiddle_imag_32[index];
-				/* calculate the accumulator: twiddle * bottom */
-				icomplex32_mul(&tmp1, &outb[bottom], &tmp2);
-				tmp1 = outb[top];
-				/* calculate the top output: top = top + accumulate */
-				icomplex32_add(&tmp1, &tmp2, &outb[top]);
-				/* calculate the bottom output: bottom = top - accumulate */
-				icomplex32_sub(&tmp1, &tmp2, &outb[bottom]);
+				x0 = outb[top];
+				x1 = outb[top + n];
+				x2 = outb[top + 2 * n];
+				x3 = outb[top + 3 * n];
+				/* two size m / 2 transforms */
+				index = i * j;
+				fft_butterfly_32(&x0, &x1, index);
+				fft_butterfly_32(&x2, &x3, index);
+				/* one size m transform */
+				index = (i >> 1) * j;
+				fft_butterfly_32(&x0, &x2, index);
+				index = (i >> 1) * (j + n);
+				fft_butterfly_32(&x1, &x3, index);
+				outb[top] = x0;
+				outb[top + n] = x1;
+				outb[top + 2 * n] = x2;
+				outb[top + 3 * n] = x3;
 			}
 		}
 	}
@@ -63,11 +63,82 @@ struct fft_plan *fft_plan_new(void *inb, void *outb, uint32_t size, int bits)
 	return plan;
 }
 
+struct fft_plan *fft_plan_new_real(void *real_buf, void *complex_buf, uint32_t size, int bits)
+{
+	struct fft_plan *plan;
+	int quarter = size >> 2;
+	int step;
+	int k;
+
+	/* the size must be power of two for the real and imaginary sample pairs */
+	if (!real_buf || !complex_buf || size < 4 || size > FFT_SIZE_MAX || (size & (size - 1)))
+		return NULL;
+
+	plan = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, sizeof(struct fft_plan));
+	if (!plan)
+		return NULL;
+
+	plan->half = fft_plan_new(real_buf, complex_buf, size >> 1, bits);
+	if (!plan->half)
+		goto err;
+
+	plan->size = size;
+	plan->len = plan->half->len + 1;
+
+	/* Cache the twiddle factors exp(-j * 2 * pi * k / N) for k = 0 .. N/4 used in
+	 * the split of the N/2 complex FFT output. The other half is derived from these.
+	 */
+	step = FFT_SIZE_MAX / size;
+	switch (bits) {
+#if CONFIG_MATH_16BIT_FFT
+	case 16:
+		plan->real16 = real_buf;
+		plan->outb16 = complex_buf;
+		plan->twiddle16 = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+					  (quarter + 1) * sizeof(struct icomplex16));
+		if (!plan->twiddle16)
+			goto err;
+
+		for (k = 0; k <= quarter; k++) {
+			plan->twiddle16[k].real = twiddle_real_16[k * step];
+			plan->twiddle16[k].imag = twiddle_imag_16[k * step];
+		}
+		break;
+#endif
+#if CONFIG_MATH_32BIT_FFT
+	case 32:
+		plan->real32 = real_buf;
+		plan->outb32 = complex_buf;
+		plan->twiddle32 = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+					  (quarter + 1) * sizeof(struct icomplex32));
+		if (!plan->twiddle32)
+			goto err;
+
+		for (k = 0; k <= quarter; k++) {
+			plan->twiddle32[k].real = twiddle_real_32[k * step];
+			plan->twiddle32[k].imag = twiddle_imag_32[k * step];
+		}
+		break;
+#endif
+	default:
+		goto err;
+	}
+
+	return plan;
+
+err:
+	fft_plan_free(plan);
+	return NULL;
+}
+
 void fft_plan_free(struct fft_plan *plan)
 {
 	if (!plan)
 		return;
 
+	fft_plan_free(plan->half);
+	rfree(plan->twiddle16);
+	rfree(plan->twiddle32);
 	rfree(plan->bit_reverse_idx);
 	rfree(plan);
 }
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <sof/math/fft.h>
+
+/*
+ * 16 bit version of the real FFT, see fft_real_32.c for the algorithm
+ * description.
+ */
+
+/* Get twiddle factor W^k for k = 0 .. N/2 - 1 from the cached 0 .. N/4 */
+static inline void fft_real_twiddle_16(const struct fft_plan *plan, int k,
+				       struct icomplex16 *w)
+{
+	int quarter = plan->size >> 2;
+
+	if (k <= quarter) {
+		*w = plan->twiddle16[k];
+	} else {
+		/* W^(N/2 - k) = -conj(W^k) */
+		w->real = -plan->twiddle16[(quarter << 1) - k].real;
+		w->imag = plan->twiddle16[(quarter << 1) - k].imag;
+	}
+}
+
+/*
+ * Forward split for bin k, a = Z[k], b = Z[N/2 - k]:
+ * X[k] = ((Z[k] + Z*[N/2 - k]) - j * W^k * (Z[k] - Z*[N/2 - k])) / 4
+ */
+static inline void fft_real_split_16(const struct icomplex16 *a, const struct icomplex16 *b,
+				     const struct icomplex16 *w, struct icomplex16 *out)
+{
+	int32_t er = ((int32_t)a->real + b->real) >> 1;
+	int32_t ei = ((int32_t)a->imag - b->imag) >> 1;
+	int32_t dr = ((int32_t)a->real - b->real) >> 1;
+	int32_t di = ((int32_t)a->imag + b->imag) >> 1;
+	int32_t pr = Q_SHIFT_RND(w->real * dr - w->imag * di, 30, 15);
+	int32_t pi = Q_SHIFT_RND(w->real * di + w->imag * dr, 30, 15);
+
+	out->real = (er + pi) >> 1;
+	out->imag = (ei - pr) >> 1;
+}
+
+/*
+ * Inverse split for bin k, a = X[k], b = X[N/2 - k]:
+ * Z[k] = ((X[k] + X*[N/2 - k]) + j * conj(W^k) * (X[k] - X*[N/2 - k])) / 2
+ */
+static inline void fft_real_merge_16(const struct icomplex16 *a, const struct icomplex16 *b,
+				     const struct icomplex16 *w, struct icomplex16 *out)
+{
+	int32_t er = ((int32_t)a->real + b->real) >> 1;
+	int32_t ei = ((int32_t)a->imag - b->imag) >> 1;
+	int32_t dr = ((int32_t)a->real - b->real) >> 1;
+	int32_t di = ((int32_t)a->imag + b->imag) >> 1;
+	int32_t pr = Q_SHIFT_RND(w->real * dr + w->imag * di, 30, 15);
+	int32_t pi = Q_SHIFT_RND(w->real * di - w->imag * dr, 30, 15);
+
+	out->real = sat_int16(er - pi);
+	out->imag = sat_int16(ei + pr);
+}
+
+static void fft_real_forward_16(struct fft_plan *plan)
+{
+	struct icomplex16 *z = plan->outb16;
+	struct icomplex16 w1;
+	struct icomplex16 w2;
+	struct icomplex16 a;
+	struct icomplex16 b;
+	int half_size = plan->half->size;
+	int k;
+
+	plan->half->inb16 = (struct icomplex16 *)plan->real16;
+	plan->half->outb16 = z;
+	fft_execute_16(plan->half, false);
+
+	/* DC and Nyquist bins are real */
+	a = z[0];
+	z[0].real = ((int32_t)a.real + a.imag) >> 1;
+	z[0].imag = 0;
+	z[half_size].real = ((int32_t)a.real - a.imag) >> 1;
+	z[half_size].imag = 0;
+
+	/* bins k and N/2 - k are computed from the same pair of inputs */
+	for (k = 1; k <= half_size >> 1; k++) {
+		a = z[k];
+		b = z[half_size - k];
+		fft_real_twiddle_16(plan, k, &w1);
+		fft_real_twiddle_16(plan, half_size - k, &w2);
+		fft_real_split_16(&a, &b, &w1, &z[k]);
+		fft_real_split_16(&b, &a, &w2, &z[half_size - k]);
+	}
+}
+
+static void fft_real_inverse_16(struct fft_plan *plan)
+{
+	struct icomplex16 *z = plan->outb16;
+	struct icomplex16 *out = (struct icomplex16 *)plan->real16;
+	struct icomplex16 w1;
+	struct icomplex16 w2;
+	struct icomplex16 a;
+	struct icomplex16 b;
+	int half_size = plan->half->size;
+	int k;
+
+	a = z[0];
+	b = z[half_size];
+	fft_real_merge_16(&a, &b, &plan->twiddle16[0], &z[0]);
+	for (k = 1; k <= half_size >> 1; k++) {
+		a = z[k];
+		b = z[half_size - k];
+		fft_real_twiddle_16(plan, k, &w1);
+		fft_real_twiddle_16(plan, half_size - k, &w2);
+		fft_real_merge_16(&a, &b, &w1, &z[k]);
+		fft_real_merge_16(&b, &a, &w2, &z[half_size - k]);
+	}
+
+	plan->half->inb16 = z;
+	plan->half->outb16 = out;
+	fft_execute_16(plan->half, true);
+
+	/* the IFFT output is conjugate of z[n] / 2 */
+	for (k = 0; k < half_size; k++) {
+		out[k].real = sat_int16((int32_t)out[k].real << 1);
+		out[k].imag = sat_int16(-((int32_t)out[k].imag << 1));
+	}
+}
+
+/**
+ * \brief Execute the 16-bits real input FFT or real output IFFT
+ *	  for the configured real fft_plan.
+ * \param[in] plan - pointer to fft_plan from fft_plan_new_real().
+ * \param[in] ifft - set to 1 for IFFT and 0 for FFT.
+ */
+void fft_execute_real_16(struct fft_plan *plan, bool ifft)
+{
+	if (!plan || !plan->half || !plan->twiddle16 || !plan->real16 || !plan->outb16)
+		return;
+
+	if (ifft)
+		fft_real_inverse_16(plan);
+	else
+		fft_real_forward_16(plan);
+}
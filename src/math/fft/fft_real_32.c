@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <sof/math/fft.h>
+
+/*
+ * The N real samples x[n] are processed as N/2 complex samples
+ * z[n] = x[2n] + j * x[2n + 1] with the complex FFT. The spectrum Z[k]
+ * is then split into spectra of even and odd samples and combined with
+ * twiddle factors W^k = exp(-j * 2 * pi * k / N) to X[k], k = 0 .. N/2.
+ * The inverse transform does the steps in reverse order.
+ */
+
+/* Get twiddle factor W^k for k = 0 .. N/2 - 1 from the cached 0 .. N/4 */
+static inline void fft_real_twiddle_32(const struct fft_plan *plan, int k,
+				       struct icomplex32 *w)
+{
+	int quarter = plan->size >> 2;
+
+	if (k <= quarter) {
+		*w = plan->twiddle32[k];
+	} else {
+		/* W^(N/2 - k) = -conj(W^k) */
+		w->real = -plan->twiddle32[(quarter << 1) - k].real;
+		w->imag = plan->twiddle32[(quarter << 1) - k].imag;
+	}
+}
+
+/*
+ * Forward split for bin k, a = Z[k], b = Z[N/2 - k]:
+ * X[k] = ((Z[k] + Z*[N/2 - k]) - j * W^k * (Z[k] - Z*[N/2 - k])) / 4
+ * The extra 1/2 scale keeps the output scaled by 1/N as with complex FFT.
+ */
+static inline void fft_real_split_32(const struct icomplex32 *a, const struct icomplex32 *b,
+				     const struct icomplex32 *w, struct icomplex32 *out)
+{
+	int32_t er = ((int64_t)a->real + b->real) >> 1;
+	int32_t ei = ((int64_t)a->imag - b->imag) >> 1;
+	int32_t dr = ((int64_t)a->real - b->real) >> 1;
+	int32_t di = ((int64_t)a->imag + b->imag) >> 1;
+	int32_t pr = ((int64_t)w->real * dr - (int64_t)w->imag * di) >> 31;
+	int32_t pi = ((int64_t)w->real * di + (int64_t)w->imag * dr) >> 31;
+
+	out->real = ((int64_t)er + pi) >> 1;
+	out->imag = ((int64_t)ei - pr) >> 1;
+}
+
+/*
+ * Inverse split for bin k, a = X[k], b = X[N/2 - k]:
+ * Z[k] = ((X[k] + X*[N/2 - k]) + j * conj(W^k) * (X[k] - X*[N/2 - k])) / 2
+ * The result is half of the N/2 size spectrum of z[n] to avoid overflow.
+ */
+static inline void fft_real_merge_32(const struct icomplex32 *a, const struct icomplex32 *b,
+				     const struct icomplex32 *w, struct icomplex32 *out)
+{
+	int32_t er = ((int64_t)a->real + b->real) >> 1;
+	int32_t ei = ((int64_t)a->imag - b->imag) >> 1;
+	int32_t dr = ((int64_t)a->real - b->real) >> 1;
+	int32_t di = ((int64_t)a->imag + b->imag) >> 1;
+	int32_t pr = ((int64_t)w->real * dr + (int64_t)w->imag * di) >> 31;
+	int32_t pi = ((int64_t)w->real * di - (int64_t)w->imag * dr) >> 31;
+
+	out->real = SATP_INT32(SATM_INT32((int64_t)er - pi));
+	out->imag = SATP_INT32(SATM_INT32((int64_t)ei + pr));
+}
+
+static void fft_real_forward_32(struct fft_plan *plan)
+{
+	struct icomplex32 *z = plan->outb32;
+	struct icomplex32 w1;
+	struct icomplex32 w2;
+	struct icomplex32 a;
+	struct icomplex32 b;
+	int half_size = plan->half->size;
+	int k;
+
+	plan->half->inb32 = (struct icomplex32 *)plan->real32;
+	plan->half->outb32 = z;
+	fft_execute_32(plan->half, false);
+
+	/* DC and Nyquist bins are real */
+	a = z[0];
+	z[0].real = ((int64_t)a.real + a.imag) >> 1;
+	z[0].imag = 0;
+	z[half_size].real = ((int64_t)a.real - a.imag) >> 1;
+	z[half_size].imag = 0;
+
+	/* bins k and N/2 - k are computed from the same pair of inputs */
+	for (k = 1; k <= half_size >> 1; k++) {
+		a = z[k];
+		b = z[half_size - k];
+		fft_real_twiddle_32(plan, k, &w1);
+		fft_real_twiddle_32(plan, half_size - k, &w2);
+		fft_real_split_32(&a, &b, &w1, &z[k]);
+		fft_real_split_32(&b, &a, &w2, &z[half_size - k]);
+	}
+}
+
+static void fft_real_inverse_32(struct fft_plan *plan)
+{
+	struct icomplex32 *z = plan->outb32;
+	struct icomplex32 *out = (struct icomplex32 *)plan->real32;
+	struct icomplex32 w1;
+	struct icomplex32 w2;
+	struct icomplex32 a;
+	struct icomplex32 b;
+	int half_size = plan->half->size;
+	int k;
+
+	a = z[0];
+	b = z[half_size];
+	fft_real_merge_32(&a, &b, &plan->twiddle32[0], &z[0]);
+	for (k = 1; k <= half_size >> 1; k++) {
+		a = z[k];
+		b = z[half_size - k];
+		fft_real_twiddle_32(plan, k, &w1);
+		fft_real_twiddle_32(plan, half_size - k, &w2);
+		fft_real_merge_32(&a, &b, &w1, &z[k]);
+		fft_real_merge_32(&b, &a, &w2, &z[half_size - k]);
+	}
+
+	plan->half->inb32 = z;
+	plan->half->outb32 = out;
+	fft_execute_32(plan->half, true);
+
+	/* the IFFT output is conjugate of z[n] / 2 */
+	for (k = 0; k < half_size; k++) {
+		out[k].real = SATP_INT32(SATM_INT32((int64_t)out[k].real << 1));
+		out[k].imag = SATP_INT32(SATM_INT32(-((int64_t)out[k].imag << 1)));
+	}
+}
+
+/**
+ * \brief Execute the 32-bits real input FFT or real output IFFT
+ *	  for the configured real fft_plan.
+ * \param[in] plan - pointer to fft_plan from fft_plan_new_real().
+ * \param[in] ifft - set to 1 for IFFT and 0 for FFT.
+ */
+void fft_execute_real_32(struct fft_plan *plan, bool ifft)
+{
+	if (!plan || !plan->half || !plan->twiddle32 || !plan->real32 || !plan->outb32)
+		return;
+
+	if (ifft)
+		fft_real_inverse_32(plan);
+	else
+		fft_real_forward_32(plan);
+}
@@ -67,6 +67,49 @@ void fir_init_delay(struct fir_state_32x16 *fir, int32_t **data)
 	*data += fir->length; /* Point to next delay line start */
 }
 
+void fir_32x16_block(struct fir_state_32x16 *fir, int32_t *x, int32_t *y, int n)
+{
+	const int length = fir->length;
+	int first;
+	int pos;
+	int i;
+
+	/* Bypass is set with length set to zero. */
+	if (!length) {
+		for (i = 0; i < n; i++)
+			y[i] = x[i];
+
+		return;
+	}
+
+	/* Copy the history from the circular delay line in front of the
+	 * input samples. The latest sample is before the write index.
+	 */
+	pos = fir->rwi;
+	for (i = 1; i < fir->taps; i++) {
+		if (--pos < 0)
+			pos = length - 1;
+
+		x[-i] = fir->delay[pos];
+	}
+
+	fir_32x16_linear(fir, x, y, n);
+
+	/* Store the input samples that remain in the delay line */
+	first = MAX(n - length, 0);
+	pos = (fir->rwi + first) % length;
+	for (i = first; i < n; i++) {
+		fir->delay[pos] = x[i];
+		if (++pos == length)
+			pos = 0;
+	}
+
+	fir->rwi = pos;
+}
+
+/* The x86 SSE4.1 and AVX2 builds use the kernels from fir_x86.c */
+#if !FIR_X86
+
 int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
 {
 	int64_t y = 0;
@@ -180,4 +223,27 @@ void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *
 	*y1 = sat_int32(a1 >> shift);
 }
 
+void fir_32x16_linear(struct fir_state_32x16 *fir, const int32_t *x, int32_t *y, int n)
+{
+	const int16_t *coef = fir->coef;
+	const int32_t *data;
+	const int taps = fir->taps;
+	const int shift = 15 + fir->out_shift;
+	int64_t a;
+	int i;
+	int j;
+
+	for (j = 0; j < n; j++) {
+		a = 0;
+		data = &x[j];
+		for (i = 0; i < taps; i++)
+			a += (int64_t)coef[i] * data[-i];
+
+		/* Q2.46 -> Q2.31, saturate to Q1.31 */
+		y[j] = sat_int32(a >> shift);
+	}
+}
+
+#endif /* !FIR_X86 */
+
 #endif
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/math/fir_config.h>
+
+#if FIR_X86
+
+#include <sof/common.h>
+#include <sof/audio/format.h>
+#include <sof/math/fir_generic.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * EQ FIR algorithm code for x86 host builds with SSE4.1 or AVX2
+ *
+ * The filter state, delay line layout and the initialization functions
+ * are shared with fir_generic.c. The 32x16 products are accumulated
+ * exactly into 64 bits so the result is bit-exact with the generic
+ * version regardless of the summation order.
+ */
+
+#if defined(__AVX2__)
+static inline int64_t fir_hsum_256(__m256i acc)
+{
+	__m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc),
+				  _mm256_extracti128_si256(acc, 1));
+
+	return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+#endif
+
+/* Multiply and accumulate n taps. The coefficients are read in ascending
+ * and the delay line samples in descending order starting from data.
+ */
+static inline int64_t fir_mac_x86(const int16_t *coef, const int32_t *data,
+				  int n)
+{
+	__m128i acc_even = _mm_setzero_si128();
+	__m128i acc_odd = _mm_setzero_si128();
+	__m128i c4;
+	__m128i d4;
+	int64_t y = 0;
+	int i = 0;
+
+#if defined(__AVX2__)
+	const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i acc8_even = _mm256_setzero_si256();
+	__m256i acc8_odd = _mm256_setzero_si256();
+	__m256i c8;
+	__m256i d8;
+
+	for (; i + 8 <= n; i += 8) {
+		c8 = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&coef[i]));
+		d8 = _mm256_loadu_si256((const __m256i *)(data - i - 7));
+		d8 = _mm256_permutevar8x32_epi32(d8, reverse);
+		acc8_even = _mm256_add_epi64(acc8_even, _mm256_mul_epi32(c8, d8));
+		acc8_odd = _mm256_add_epi64(acc8_odd,
+					    _mm256_mul_epi32(_mm256_srli_epi64(c8, 32),
+							     _mm256_srli_epi64(d8, 32)));
+	}
+
+	y = fir_hsum_256(_mm256_add_epi64(acc8_even, acc8_odd));
+#endif
+
+	for (; i + 4 <= n; i += 4) {
+		c4 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)&coef[i]));
+		d4 = _mm_loadu_si128((const __m128i *)(data - i - 3));
+		d4 = _mm_shuffle_epi32(d4, _MM_SHUFFLE(0, 1, 2, 3));
+		acc_even = _mm_add_epi64(acc_even, _mm_mul_epi32(c4, d4));
+		acc_odd = _mm_add_epi64(acc_odd, _mm_mul_epi32(_mm_srli_epi64(c4, 32),
+							       _mm_srli_epi64(d4, 32)));
+	}
+
+	acc_even = _mm_add_epi64(acc_even, acc_odd);
+	y += _mm_cvtsi128_si64(acc_even) + _mm_extract_epi64(acc_even, 1);
+
+	for (; i < n; i++)
+		y += (int64_t)coef[i] * data[-i];
+
+	return y;
+}
+
+/* As fir_mac_x86() for two successive outputs, the second one reads the
+ * delay line from data + 1. The coefficients are loaded once for both.
+ */
+static inline void fir_mac_2x_x86(const int16_t *coef, const int32_t *data, int n,
+				  int64_t *y0, int64_t *y1)
+{
+	__m128i acc0 = _mm_setzero_si128();
+	__m128i acc1 = _mm_setzero_si128();
+	__m128i c4;
+	__m128i d4;
+	int64_t a0 = 0;
+	int64_t a1 = 0;
+	int i = 0;
+
+#if defined(__AVX2__)
+	const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i acc8_0 = _mm256_setzero_si256();
+	__m256i acc8_1 = _mm256_setzero_si256();
+	__m256i c8_even;
+	__m256i c8_odd;
+	__m256i d8;
+
+	for (; i + 8 <= n; i += 8) {
+		c8_even = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&coef[i]));
+		c8_odd = _mm256_srli_epi64(c8_even, 32);
+		d8 = _mm256_loadu_si256((const __m256i *)(data - i - 7));
+		d8 = _mm256_permutevar8x32_epi32(d8, reverse);
+		acc8_0 = _mm256_add_epi64(acc8_0, _mm256_mul_epi32(c8_even, d8));
+		acc8_0 = _mm256_add_epi64(acc8_0, _mm256_mul_epi32(c8_odd,
+								   _mm256_srli_epi64(d8, 32)));
+		d8 = _mm256_loadu_si256((const __m256i *)(data - i - 6));
+		d8 = _mm256_permutevar8x32_epi32(d8, reverse);
+		acc8_1 = _mm256_add_epi64(acc8_1, _mm256_mul_epi32(c8_even, d8));
+		acc8_1 = _mm256_add_epi64(acc8_1, _mm256_mul_epi32(c8_odd,
+								   _mm256_srli_epi64(d8, 32)));
+	}
+
+	a0 = fir_hsum_256(acc8_0);
+	a1 = fir_hsum_256(acc8_1);
+#endif
+
+	for (; i + 4 <= n; i += 4) {
+		c4 = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)&coef[i]));
+		d4 = _mm_loadu_si128((const __m128i *)(data - i - 3));
+		d4 = _mm_shuffle_epi32(d4, _MM_SHUFFLE(0, 1, 2, 3));
+		acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(c4, d4));
+		acc0 = _mm_add_epi64(acc0, _mm_mul_epi32(_mm_srli_epi64(c4, 32),
+							 _mm_srli_epi64(d4, 32)));
+		d4 = _mm_loadu_si128((const __m128i *)(data - i - 2));
+		d4 = _mm_shuffle_epi32(d4, _MM_SHUFFLE(0, 1, 2, 3));
+		acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(c4, d4));
+		acc1 = _mm_add_epi64(acc1, _mm_mul_epi32(_mm_srli_epi64(c4, 32),
+							 _mm_srli_epi64(d4, 32)));
+	}
+
+	a0 += _mm_cvtsi128_si64(acc0) + _mm_extract_epi64(acc0, 1);
+	a1 += _mm_cvtsi128_si64(acc1) + _mm_extract_epi64(acc1, 1);
+
+	for (; i < n; i++) {
+		a0 += (int64_t)coef[i] * data[-i];
+		a1 += (int64_t)coef[i] * data[1 - i];
+	}
+
+	*y0 = a0;
+	*y1 = a1;
+}
+
+/* Filter taps for a delay line position, the read continues from the
+ * delay line end after the circular wrap.
+ */
+static inline int64_t fir_mac_circular(struct fir_state_32x16 *fir, int pos)
+{
+	const int taps = fir->taps;
+	int n1 = MIN(pos + 1, taps);
+	int64_t y;
+
+	y = fir_mac_x86(fir->coef, &fir->delay[pos], n1);
+	y += fir_mac_x86(&fir->coef[n1], &fir->delay[fir->length - 1], taps - n1);
+	return y;
+}
+
+int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
+{
+	int64_t y;
+	const int shift = 15 + fir->out_shift;
+	int pos = fir->rwi;
+
+	/* Bypass is set with length set to zero. */
+	if (!fir->length)
+		return x;
+
+	/* Write sample to delay and advance the write index */
+	fir->delay[pos] = x;
+	fir->rwi++;
+	if (fir->rwi == fir->length)
+		fir->rwi = 0;
+
+	y = fir_mac_circular(fir, pos);
+
+	/* Q2.46 -> Q2.31, saturate to Q1.31 */
+	return sat_int32(y >> shift);
+}
+
+void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *y0, int32_t *y1)
+{
+	int64_t a0;
+	int64_t a1;
+	const int shift = 15 + fir->out_shift;
+	int pos = fir->rwi;
+
+	/* Bypass is set with length set to zero. */
+	if (!fir->taps) {
+		*y0 = x0;
+		*y1 = x1;
+		return;
+	}
+
+	/* Write samples to delay, the length is even so the second sample
+	 * never wraps.
+	 */
+	fir->delay[pos] = x0;
+	fir->delay[pos + 1] = x1;
+	fir->rwi += 2;
+	if (fir->rwi >= fir->length)
+		fir->rwi -= fir->length;
+
+	a0 = fir_mac_circular(fir, pos);
+	a1 = fir_mac_circular(fir, pos + 1);
+
+	/* Q2.46 -> Q2.31, saturate to Q1.31 */
+	*y0 = sat_int32(a0 >> shift);
+	*y1 = sat_int32(a1 >> shift);
+}
+
+void fir_32x16_linear(struct fir_state_32x16 *fir, const int32_t *x, int32_t *y, int n)
+{
+	int64_t a0;
+	int64_t a1;
+	const int shift = 15 + fir->out_shift;
+	int j;
+
+	/* Q2.46 -> Q2.31, saturate to Q1.31 */
+	for (j = 0; j + 2 <= n; j += 2) {
+		fir_mac_2x_x86(fir->coef, &x[j], fir->taps, &a0, &a1);
+		y[j] = sat_int32(a0 >> shift);
+		y[j + 1] = sat_int32(a1 >> shift);
+	}
+
+	if (j < n)
+		y[j] = sat_int32(fir_mac_x86(fir->coef, &x[j], fir->taps) >> shift);
+}
+
+#endif /* FIR_X86 */
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/format.h>
+#include <sof/math/iir_df2t.h>
+
+#if IIR_X86
+
+#include <sof/math/iir_x86.h>
+#include <sof/math/numbers.h>
+#include <user/eq.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Multichannel DF2T IIR for x86 host builds
+ *
+ * The channels of a frame are adjacent in interleaved data, so a group of
+ * IIR_X86_LANES channels is loaded to one vector and each biquad step is
+ * done for the group with one instruction. The filters keep their own
+ * coefficients and delay lines, the coefficients are gathered to lanes and
+ * the delays are copied in and out once per call.
+ */
+
+/* lanes can share the loop when the section layout is the same */
+static bool iir_df2t_lanes_match(struct iir_state_df2t *iir[], int lanes)
+{
+	int i;
+
+	if (!iir[0]->biquads)
+		return false;
+
+	for (i = 1; i < lanes; i++)
+		if (iir[i]->biquads != iir[0]->biquads ||
+		    iir[i]->biquads_in_series != iir[0]->biquads_in_series)
+			return false;
+
+	return true;
+}
+
+static void iir_df2t_lanes(struct iir_state_df2t *iir[], int lanes, int nch,
+			   const int32_t *x, int32_t *y, int frames)
+{
+	iir_vec coef[SOF_EQ_IIR_BIQUADS_MAX][SOF_EQ_IIR_NBIQUAD];
+	iir_vec delay[SOF_EQ_IIR_BIQUADS_MAX][IIR_DF2T_NUM_DELAYS];
+	int64_t tmp64[IIR_X86_LANES];
+	int32_t tmp32[IIR_X86_LANES];
+	iir_vec in;
+	iir_vec out;
+	iir_vec acc;
+	iir_vec tmp;
+	iir_vec *c;
+	iir_vec *d;
+	int biquads = iir[0]->biquads;
+	int nseries = iir[0]->biquads_in_series;
+	int b, i, j, k, l;
+	int f;
+
+	/* Gather coefficients {a2, a1, b2, b1, b0, shift, gain} to lanes,
+	 * the shift is turned to the count used by iir_vec_rnd_sat32_v().
+	 * Unused lanes get zero coefficients.
+	 */
+	for (b = 0; b < biquads; b++) {
+		for (k = 0; k < SOF_EQ_IIR_NBIQUAD; k++) {
+			for (l = 0; l < IIR_X86_LANES; l++) {
+				tmp64[l] = l < lanes ? iir[l]->coef[b * SOF_EQ_IIR_NBIQUAD + k] : 0;
+				if (k == 5)
+					tmp64[l] += 45 - 31 - 1;
+			}
+			coef[b][k] = iir_vec_load64(tmp64);
+		}
+
+		for (k = 0; k < IIR_DF2T_NUM_DELAYS; k++) {
+			i = b * IIR_DF2T_NUM_DELAYS + k;
+			for (l = 0; l < IIR_X86_LANES; l++)
+				tmp64[l] = l < lanes ? iir[l]->delay[i] : 0;
+			delay[b][k] = iir_vec_load64(tmp64);
+		}
+	}
+
+	memset(tmp32, 0, sizeof(tmp32));
+	for (f = 0; f < frames; f++) {
+		if (lanes == IIR_X86_LANES) {
+			in = iir_vec_load32(x);
+		} else {
+			for (l = 0; l < lanes; l++)
+				tmp32[l] = x[l];
+			in = iir_vec_load32(tmp32);
+		}
+
+		out = iir_vec_set1(0);
+		c = coef[0];
+		d = delay[0];
+		for (j = 0; j < biquads; j += nseries) {
+			tmp = in;
+			for (i = 0; i < nseries; i++) {
+				/* b0 * x + d0, Q3.61 to saturated Q1.31 */
+				acc = iir_vec_add(iir_vec_mul(c[4], tmp), d[0]);
+				acc = iir_vec_rnd_sat32(acc, 61 - 31 - 1);
+
+				/* d0 = d1 + b1 * x + a1 * y, d1 = b2 * x + a2 * y */
+				d[0] = iir_vec_add(d[1], iir_vec_add(iir_vec_mul(c[3], tmp),
+								     iir_vec_mul(c[1], acc)));
+				d[1] = iir_vec_add(iir_vec_mul(c[2], tmp), iir_vec_mul(c[0], acc));
+
+				/* gain Q2.14 and output shift */
+				tmp = iir_vec_rnd_sat32_v(iir_vec_mul(c[6], acc), c[5]);
+
+				c += SOF_EQ_IIR_NBIQUAD;
+				d += IIR_DF2T_NUM_DELAYS;
+			}
+			out = iir_vec_sat32(iir_vec_add(out, tmp));
+		}
+
+		if (lanes == IIR_X86_LANES) {
+			iir_vec_store32(y, out);
+		} else {
+			iir_vec_store32(tmp32, out);
+			for (l = 0; l < lanes; l++)
+				y[l] = tmp32[l];
+		}
+
+		x += nch;
+		y += nch;
+	}
+
+	for (b = 0; b < biquads; b++) {
+		for (k = 0; k < IIR_DF2T_NUM_DELAYS; k++) {
+			iir_vec_store64(tmp64, delay[b][k]);
+			for (l = 0; l < lanes; l++)
+				iir[l]->delay[b * IIR_DF2T_NUM_DELAYS + k] = tmp64[l];
+		}
+	}
+}
+
+void iir_df2t_multich(struct iir_state_df2t *iir[], int nch, const int32_t *x,
+		      int32_t *y, int frames)
+{
+	int lanes;
+	int ch;
+	int i;
+	int f;
+
+	for (ch = 0; ch < nch; ch += lanes) {
+		lanes = MIN(nch - ch, IIR_X86_LANES);
+		if (iir_df2t_lanes_match(&iir[ch], lanes)) {
+			iir_df2t_lanes(&iir[ch], lanes, nch, x + ch, y + ch, frames);
+			continue;
+		}
+
+		/* different filters or bypass in the group */
+		for (i = ch; i < ch + lanes; i++)
+			for (f = 0; f < frames * nch; f += nch)
+				y[f + i] = iir_df2t(iir[i], x[f + i]);
+	}
+}
+
+#endif /* IIR_X86 */
@@ -5,8 +5,10 @@
 // Author: Seppo Ingalsuo <seppo.ingalsuo@linux.intel.com>
 
 #include <sof/math/matrix.h>
+#include <sof/math/numbers.h>
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 
 int mat_multiply(struct mat_matrix_16b *a, struct mat_matrix_16b *b, struct mat_matrix_16b *c)
 {
@@ -58,6 +60,29 @@ int mat_multiply(struct mat_matrix_16b *a, struct mat_matrix_16b *b, struct mat_
 	return 0;
 }
 
+int mat_transpose_16b(const struct mat_matrix_16b *a, struct mat_matrix_16b *at)
+{
+	const int16_t *x;
+	int16_t *z = at->data;
+	int i, j;
+
+	if (a->rows != at->columns || a->columns != at->rows)
+		return -EINVAL;
+
+	for (i = 0; i < a->columns; i++) {
+		x = a->data + i;
+		for (j = 0; j < a->rows; j++) {
+			*z++ = *x;
+			x += a->columns;
+		}
+	}
+
+	at->fractions = a->fractions;
+	return 0;
+}
+
+#if !MATRIX_X86
+
 int mat_multiply_elementwise(struct mat_matrix_16b *a, struct mat_matrix_16b *b,
 			     struct mat_matrix_16b *c)
 {	int64_t p;
@@ -94,3 +119,80 @@ int mat_multiply_elementwise(struct mat_matrix_16b *a, struct mat_matrix_16b *b,
 
 	return 0;
 }
+
+/* The 32 bit sums are kept in unsigned type to wrap on overflow the same
+ * way as the vector versions in matrix_x86.c do.
+ */
+int mat_multiply_acc32(const struct mat_matrix_16b *a, const struct mat_matrix_16b *b,
+		       struct mat_matrix_16b *c)
+{
+	uint32_t acc[MAT_BLOCK_COLUMNS];
+	const int16_t *x;
+	const int16_t *y;
+	int16_t *z;
+	int16_t x_k;
+	int i, j, k, n, col;
+	const int shift_minus_one = a->fractions + b->fractions - c->fractions - 1;
+
+	if (a->columns != b->rows || a->rows != c->rows || b->columns != c->columns ||
+	    shift_minus_one < -1)
+		return -EINVAL;
+
+	/* For a strip of columns of b the rows of a are multiplied in order
+	 * k, j to read both a and b sequentially. The strip stays in cache
+	 * for all the rows of a.
+	 */
+	for (col = 0; col < b->columns; col += MAT_BLOCK_COLUMNS) {
+		n = MIN(b->columns - col, MAT_BLOCK_COLUMNS);
+		for (i = 0; i < a->rows; i++) {
+			x = a->data + a->columns * i;
+			y = b->data + col;
+			memset(acc, 0, sizeof(acc[0]) * n);
+			for (k = 0; k < a->columns; k++) {
+				x_k = x[k];
+				for (j = 0; j < n; j++)
+					acc[j] += (uint32_t)((int32_t)x_k * y[j]);
+
+				y += b->columns;
+			}
+
+			z = c->data + c->columns * i + col;
+			for (j = 0; j < n; j++)
+				z[j] = mat_round_acc32((int32_t)acc[j], shift_minus_one);
+		}
+	}
+
+	return 0;
+}
+
+int mat_multiply_transposed_acc32(const struct mat_matrix_16b *a,
+				  const struct mat_matrix_16b *bt,
+				  struct mat_matrix_16b *c)
+{
+	uint32_t s;
+	const int16_t *x;
+	const int16_t *y;
+	int16_t *z = c->data;
+	int i, j, k;
+	const int shift_minus_one = a->fractions + bt->fractions - c->fractions - 1;
+
+	if (a->columns != bt->columns || a->rows != c->rows || bt->rows != c->columns ||
+	    shift_minus_one < -1)
+		return -EINVAL;
+
+	for (i = 0; i < a->rows; i++) {
+		y = bt->data;
+		for (j = 0; j < bt->rows; j++) {
+			x = a->data + a->columns * i;
+			s = 0;
+			for (k = 0; k < a->columns; k++)
+				s += (uint32_t)((int32_t)*x++ * *y++);
+
+			*z++ = mat_round_acc32((int32_t)s, shift_minus_one);
+		}
+	}
+
+	return 0;
+}
+
+#endif /* !MATRIX_X86 */
@@ -0,0 +1,444 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/math/matrix.h>
+
+#if MATRIX_X86
+
+#include <sof/math/numbers.h>
+#include <immintrin.h>
+#include <errno.h>
+#include <stdint.h>
+
+/*
+ * Matrix multiply for x86 host builds
+ *
+ * The 32 bit sums of products are computed with the 16x16 bit multiply and
+ * pairwise add instruction. For c = a * b the rows k and k + 1 of b are
+ * interleaved so that each 32 bit lane gets the products of one column with
+ * the elements k and k + 1 of the row of a. The adds wrap on overflow the
+ * same way as the unsigned sums of the generic versions in matrix.c, so
+ * the results are bit exact with them.
+ */
+
+#if defined(__AVX2__)
+
+#define MAT_X86_LANES	16
+
+#define mat_vec		__m256i
+
+static inline mat_vec mat_vec_load(const int16_t *p)
+{
+	return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline void mat_vec_store(int16_t *p, mat_vec v)
+{
+	_mm256_storeu_si256((__m256i *)p, v);
+}
+
+static inline mat_vec mat_vec_zero(void)
+{
+	return _mm256_setzero_si256();
+}
+
+/* lanes of 32 bits with x0 in the low and x1 in the high half */
+static inline mat_vec mat_vec_set_pair(int16_t x0, int16_t x1)
+{
+	return _mm256_set1_epi32((uint16_t)x0 | ((uint32_t)(uint16_t)x1 << 16));
+}
+
+static inline mat_vec mat_vec_unpacklo(mat_vec a, mat_vec b)
+{
+	return _mm256_unpacklo_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_unpackhi(mat_vec a, mat_vec b)
+{
+	return _mm256_unpackhi_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_madd(mat_vec a, mat_vec b)
+{
+	return _mm256_madd_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_add32(mat_vec a, mat_vec b)
+{
+	return _mm256_add_epi32(a, b);
+}
+
+/* The unpacks work in 128 bit halves, the sums from the low unpack are
+ * for columns 0-3 and 8-11 and from the high unpack for columns 4-7 and
+ * 12-15. Store them in column order.
+ */
+static inline void mat_vec_store_acc(int32_t *p, mat_vec lo, mat_vec hi)
+{
+	_mm256_storeu_si256((__m256i *)p, _mm256_permute2x128_si256(lo, hi, 0x20));
+	_mm256_storeu_si256((__m256i *)(p + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+static inline int32_t mat_vec_sum32(mat_vec v)
+{
+	__m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4e));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xb1));
+	return _mm_cvtsi128_si32(s);
+}
+
+/* the sums of lanes of v0 to v3 to int32 elements 0 to 3 */
+static inline __m128i mat_vec_sum32x4(mat_vec v0, mat_vec v1, mat_vec v2, mat_vec v3)
+{
+	__m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(v0, v1), _mm256_hadd_epi32(v2, v3));
+
+	return _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1));
+}
+
+/* Products of 16 bit lanes shifted right by shift_minus_one, rounded and
+ * truncated to 16 bits as in the generic mat_multiply_elementwise().
+ */
+static inline mat_vec mat_vec_mul_round(mat_vec x, mat_vec y, __m128i shift_minus_one)
+{
+	const __m256i one = _mm256_set1_epi32(1);
+	const __m256i low = _mm256_set1_epi32(0xffff);
+	__m256i lo = _mm256_mullo_epi16(x, y);
+	__m256i hi = _mm256_mulhi_epi16(x, y);
+	__m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+	__m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+
+	p0 = _mm256_srai_epi32(_mm256_add_epi32(_mm256_sra_epi32(p0, shift_minus_one), one), 1);
+	p1 = _mm256_srai_epi32(_mm256_add_epi32(_mm256_sra_epi32(p1, shift_minus_one), one), 1);
+	return _mm256_packus_epi32(_mm256_and_si256(p0, low), _mm256_and_si256(p1, low));
+}
+
+#else
+
+#define MAT_X86_LANES	8
+
+#define mat_vec		__m128i
+
+static inline mat_vec mat_vec_load(const int16_t *p)
+{
+	return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void mat_vec_store(int16_t *p, mat_vec v)
+{
+	_mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline mat_vec mat_vec_zero(void)
+{
+	return _mm_setzero_si128();
+}
+
+static inline mat_vec mat_vec_set_pair(int16_t x0, int16_t x1)
+{
+	return _mm_set1_epi32((uint16_t)x0 | ((uint32_t)(uint16_t)x1 << 16));
+}
+
+static inline mat_vec mat_vec_unpacklo(mat_vec a, mat_vec b)
+{
+	return _mm_unpacklo_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_unpackhi(mat_vec a, mat_vec b)
+{
+	return _mm_unpackhi_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_madd(mat_vec a, mat_vec b)
+{
+	return _mm_madd_epi16(a, b);
+}
+
+static inline mat_vec mat_vec_add32(mat_vec a, mat_vec b)
+{
+	return _mm_add_epi32(a, b);
+}
+
+static inline void mat_vec_store_acc(int32_t *p, mat_vec lo, mat_vec hi)
+{
+	_mm_storeu_si128((__m128i *)p, lo);
+	_mm_storeu_si128((__m128i *)(p + 4), hi);
+}
+
+static inline int32_t mat_vec_sum32(mat_vec v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+	return _mm_cvtsi128_si32(v);
+}
+
+static inline __m128i mat_vec_sum32x4(mat_vec v0, mat_vec v1, mat_vec v2, mat_vec v3)
+{
+	return _mm_hadd_epi32(_mm_hadd_epi32(v0, v1), _mm_hadd_epi32(v2, v3));
+}
+
+static inline mat_vec mat_vec_mul_round(mat_vec x, mat_vec y, __m128i shift_minus_one)
+{
+	const __m128i one = _mm_set1_epi32(1);
+	const __m128i low = _mm_set1_epi32(0xffff);
+	__m128i lo = _mm_mullo_epi16(x, y);
+	__m128i hi = _mm_mulhi_epi16(x, y);
+	__m128i p0 = _mm_unpacklo_epi16(lo, hi);
+	__m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+	p0 = _mm_srai_epi32(_mm_add_epi32(_mm_sra_epi32(p0, shift_minus_one), one), 1);
+	p1 = _mm_srai_epi32(_mm_add_epi32(_mm_sra_epi32(p1, shift_minus_one), one), 1);
+	return _mm_packus_epi32(_mm_and_si128(p0, low), _mm_and_si128(p1, low));
+}
+
+#endif /* __AVX2__ */
+
+int mat_multiply_elementwise(struct mat_matrix_16b *a, struct mat_matrix_16b *b,
+			     struct mat_matrix_16b *c)
+{
+	int64_t p;
+	int16_t *x = a->data;
+	int16_t *y = b->data;
+	int16_t *z = c->data;
+	const int n = a->rows * a->columns;
+	int i = 0;
+	const int shift_minus_one = a->fractions + b->fractions - c->fractions - 1;
+
+	if (a->columns != b->columns || b->columns != c->columns ||
+	    a->rows != b->rows || b->rows != c->rows) {
+		return -EINVAL;
+	}
+
+	/* If all data is Q0 */
+	if (shift_minus_one == -1) {
+		for (i = 0; i < n; i++)
+			z[i] = x[i] * y[i];
+
+		return 0;
+	}
+
+	if (shift_minus_one >= 0) {
+		const __m128i shift = _mm_cvtsi32_si128(shift_minus_one);
+
+		for (; i <= n - MAT_X86_LANES; i += MAT_X86_LANES)
+			mat_vec_store(z + i, mat_vec_mul_round(mat_vec_load(x + i),
+							       mat_vec_load(y + i), shift));
+	}
+
+	for (; i < n; i++) {
+		p = (int32_t)x[i] * y[i];
+		z[i] = (int16_t)(((p >> shift_minus_one) + 1) >> 1); /* Shift to Qx.y */
+	}
+
+	return 0;
+}
+
+/* Sums of products of rows x0 and x1 of a with a group of MAT_X86_LANES
+ * columns of b starting from y, b has y_inc columns. The interleaved rows
+ * of b are used for both rows of a.
+ */
+static inline void mat_multiply_lanes(const int16_t *x0, const int16_t *x1, const int16_t *y,
+				      int y_inc, int k_count, int32_t *acc0, int32_t *acc1)
+{
+	mat_vec acc0_lo = mat_vec_zero();
+	mat_vec acc0_hi = mat_vec_zero();
+	mat_vec acc1_lo = mat_vec_zero();
+	mat_vec acc1_hi = mat_vec_zero();
+	mat_vec y0;
+	mat_vec y1;
+	mat_vec y_lo;
+	mat_vec y_hi;
+	mat_vec x01;
+	int k;
+
+	for (k = 0; k < k_count - 1; k += 2) {
+		y0 = mat_vec_load(y);
+		y1 = mat_vec_load(y + y_inc);
+		y_lo = mat_vec_unpacklo(y0, y1);
+		y_hi = mat_vec_unpackhi(y0, y1);
+		x01 = mat_vec_set_pair(x0[k], x0[k + 1]);
+		acc0_lo = mat_vec_add32(acc0_lo, mat_vec_madd(y_lo, x01));
+		acc0_hi = mat_vec_add32(acc0_hi, mat_vec_madd(y_hi, x01));
+		x01 = mat_vec_set_pair(x1[k], x1[k + 1]);
+		acc1_lo = mat_vec_add32(acc1_lo, mat_vec_madd(y_lo, x01));
+		acc1_hi = mat_vec_add32(acc1_hi, mat_vec_madd(y_hi, x01));
+		y += 2 * y_inc;
+	}
+
+	/* odd number of rows in b, pair the last one with zeros */
+	if (k < k_count) {
+		y0 = mat_vec_load(y);
+		y1 = mat_vec_zero();
+		y_lo = mat_vec_unpacklo(y0, y1);
+		y_hi = mat_vec_unpackhi(y0, y1);
+		x01 = mat_vec_set_pair(x0[k], 0);
+		acc0_lo = mat_vec_add32(acc0_lo, mat_vec_madd(y_lo, x01));
+		acc0_hi = mat_vec_add32(acc0_hi, mat_vec_madd(y_hi, x01));
+		x01 = mat_vec_set_pair(x1[k], 0);
+		acc1_lo = mat_vec_add32(acc1_lo, mat_vec_madd(y_lo, x01));
+		acc1_hi = mat_vec_add32(acc1_hi, mat_vec_madd(y_hi, x01));
+	}
+
+	mat_vec_store_acc(acc0, acc0_lo, acc0_hi);
+	mat_vec_store_acc(acc1, acc1_lo, acc1_hi);
+}
+
+/* Sums for the columns j0 to n - 1 of the strip that do not fill a vector,
+ * the products are added in order k, j as in the generic version.
+ */
+static void mat_multiply_tail(const int16_t *x, const int16_t *y, int y_inc, int k_count,
+			      int j0, int n, int32_t *acc)
+{
+	uint32_t tail[MAT_X86_LANES];
+	int16_t x_k;
+	int j, k;
+
+	for (j = j0; j < n; j++)
+		tail[j - j0] = 0;
+
+	for (k = 0; k < k_count; k++) {
+		x_k = x[k];
+		for (j = j0; j < n; j++)
+			tail[j - j0] += (uint32_t)((int32_t)x_k * y[j]);
+
+		y += y_inc;
+	}
+
+	for (j = j0; j < n; j++)
+		acc[j] = (int32_t)tail[j - j0];
+}
+
+int mat_multiply_acc32(const struct mat_matrix_16b *a, const struct mat_matrix_16b *b,
+		       struct mat_matrix_16b *c)
+{
+	int32_t acc[2][MAT_BLOCK_COLUMNS];
+	const int16_t *x0;
+	const int16_t *x1;
+	const int16_t *y;
+	int16_t *z;
+	int i, j, n, col, rows;
+	const int shift_minus_one = a->fractions + b->fractions - c->fractions - 1;
+
+	if (a->columns != b->rows || a->rows != c->rows || b->columns != c->columns ||
+	    shift_minus_one < -1)
+		return -EINVAL;
+
+	/* For a strip of columns of b the rows of a are processed in pairs,
+	 * the strip stays in cache for all the rows of a.
+	 */
+	for (col = 0; col < b->columns; col += MAT_BLOCK_COLUMNS) {
+		n = MIN(b->columns - col, MAT_BLOCK_COLUMNS);
+		y = b->data + col;
+		for (i = 0; i < a->rows; i += 2) {
+			/* with an odd number of rows the last row is done twice */
+			rows = MIN(a->rows - i, 2);
+			x0 = a->data + a->columns * i;
+			x1 = x0 + a->columns * (rows - 1);
+			for (j = 0; j <= n - MAT_X86_LANES; j += MAT_X86_LANES)
+				mat_multiply_lanes(x0, x1, y + j, b->columns, a->columns,
+						   acc[0] + j, acc[1] + j);
+
+			if (j < n) {
+				mat_multiply_tail(x0, y, b->columns, a->columns, j, n, acc[0]);
+				if (rows > 1)
+					mat_multiply_tail(x1, y, b->columns, a->columns, j, n,
+							  acc[1]);
+			}
+
+			z = c->data + c->columns * i + col;
+			for (j = 0; j < n; j++)
+				z[j] = mat_round_acc32(acc[0][j], shift_minus_one);
+
+			if (rows > 1) {
+				z += c->columns;
+				for (j = 0; j < n; j++)
+					z[j] = mat_round_acc32(acc[1][j], shift_minus_one);
+			}
+		}
+	}
+
+	return 0;
+}
+
+/* Dot product of x and y with k_count elements */
+static inline int32_t mat_dot_product(const int16_t *x, const int16_t *y, int k_count)
+{
+	mat_vec acc = mat_vec_zero();
+	uint32_t s;
+	int k;
+
+	for (k = 0; k <= k_count - MAT_X86_LANES; k += MAT_X86_LANES)
+		acc = mat_vec_add32(acc, mat_vec_madd(mat_vec_load(x + k), mat_vec_load(y + k)));
+
+	s = mat_vec_sum32(acc);
+	for (; k < k_count; k++)
+		s += (uint32_t)((int32_t)x[k] * y[k]);
+
+	return (int32_t)s;
+}
+
+/* Dot products of x with four rows of y that has y_inc columns */
+static inline void mat_dot_product4(const int16_t *x, const int16_t *y, int y_inc, int k_count,
+				    int32_t *acc)
+{
+	mat_vec acc0 = mat_vec_zero();
+	mat_vec acc1 = mat_vec_zero();
+	mat_vec acc2 = mat_vec_zero();
+	mat_vec acc3 = mat_vec_zero();
+	mat_vec xv;
+	uint32_t s[4];
+	int k, r;
+
+	for (k = 0; k <= k_count - MAT_X86_LANES; k += MAT_X86_LANES) {
+		xv = mat_vec_load(x + k);
+		acc0 = mat_vec_add32(acc0, mat_vec_madd(xv, mat_vec_load(y + k)));
+		acc1 = mat_vec_add32(acc1, mat_vec_madd(xv, mat_vec_load(y + y_inc + k)));
+		acc2 = mat_vec_add32(acc2, mat_vec_madd(xv, mat_vec_load(y + 2 * y_inc + k)));
+		acc3 = mat_vec_add32(acc3, mat_vec_madd(xv, mat_vec_load(y + 3 * y_inc + k)));
+	}
+
+	_mm_storeu_si128((__m128i *)s, mat_vec_sum32x4(acc0, acc1, acc2, acc3));
+	for (; k < k_count; k++)
+		for (r = 0; r < 4; r++)
+			s[r] += (uint32_t)((int32_t)x[k] * y[r * y_inc + k]);
+
+	for (r = 0; r < 4; r++)
+		acc[r] = (int32_t)s[r];
+}
+
+int mat_multiply_transposed_acc32(const struct mat_matrix_16b *a,
+				  const struct mat_matrix_16b *bt,
+				  struct mat_matrix_16b *c)
+{
+	const int16_t *x;
+	const int16_t *y;
+	int32_t acc[4];
+	int16_t *z = c->data;
+	int i, j, r;
+	const int shift_minus_one = a->fractions + bt->fractions - c->fractions - 1;
+
+	if (a->columns != bt->columns || a->rows != c->rows || bt->rows != c->columns ||
+	    shift_minus_one < -1)
+		return -EINVAL;
+
+	for (i = 0; i < a->rows; i++) {
+		x = a->data + a->columns * i;
+		y = bt->data;
+		for (j = 0; j <= bt->rows - 4; j += 4) {
+			mat_dot_product4(x, y, bt->columns, a->columns, acc);
+			for (r = 0; r < 4; r++)
+				*z++ = mat_round_acc32(acc[r], shift_minus_one);
+
+			y += 4 * bt->columns;
+		}
+
+		for (; j < bt->rows; j++) {
+			*z++ = mat_round_acc32(mat_dot_product(x, y, a->columns), shift_minus_one);
+			y += bt->columns;
+		}
+	}
+
+	return 0;
+}
+
+#endif /* MATRIX_X86 */
@@ -6,7 +6,11 @@
 
 #define _GNU_SOURCE
 
+#include <sof/audio/buffer.h>
 #include <sof/audio/component.h>
+#include <sof/audio/pipeline.h>
+#include <sof/ipc/common.h>
+#include <sof/ipc/topology.h>
 #include <sof/schedule/task.h>
 #include <sof/schedule/schedule.h>
 #include <sof/schedule/ll_schedule.h>
@@ -28,16 +32,78 @@ DECLARE_SOF_UUID("ll-schedule", ll_sched_uuid, 0x77de2074, 0x828c, 0x4044,
 
 DECLARE_TR_CTX(ll_tr, SOF_UUID(ll_sched_uuid), LOG_LEVEL_INFO);
 
+struct ll_exec;
+
 struct ll_vcore {
 	struct list_item list; /* list of tasks in priority queue */
 	pthread_mutex_t list_mutex;
 	pthread_t thread_id;
 	int vcore_ready;
 	int core_id;
+	struct ll_exec *exec; /* work stealing executor, NULL for one thread */
+};
+
+/*
+ * Work stealing executor. Tasks scheduled before or after another task and
+ * tasks of pipelines connected by buffers form a chain that runs in list
+ * order, each chain is one work item per tick.
+ * Chains are pushed to the deque of the worker that ran them last and idle
+ * workers steal from the other end of the other deques.
+ */
+struct ll_exec_deque {
+	pthread_mutex_t lock;
+	int *items;		/* chain indexes */
+	int head;		/* stolen from head */
+	int tail;		/* owner pushes and pops at tail */
+};
+
+struct ll_exec_chain {
+	const void *root;	/* first task scheduled in this chain */
+	int first;		/* index of first task in exec->tasks */
+	int last;		/* index of last task in exec->tasks */
+};
+
+struct ll_exec_worker {
+	struct ll_exec *exec;
+	struct ll_exec_deque deque;
+	pthread_t thread_id;
+	int index;
+	uint64_t busy_us;	/* time spent in task run() */
+	uint32_t chains;	/* chains run */
+	uint32_t steals;	/* chains taken from other workers */
+};
+
+struct ll_exec {
+	struct ll_vcore *vc;
+	struct ll_exec_worker *workers;
+	int num_workers;
+	int num_cpus;		/* online host cores for worker affinity */
+
+	/* tasks of the current tick, grouped to chains */
+	struct task **tasks;
+	int *next;		/* next task in the chain or -1 */
+	struct ll_exec_chain *chains;
+	int capacity;
+	int num_chains;
+
+	/* tick hand-over between the scheduler thread and workers */
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	uint32_t tick;
+	int pending;		/* chains not yet completed in this tick */
+	bool stop;
 };
 
 static int tick_period_us;
 
+/* set for executor worker threads */
+static __thread bool ll_exec_thread;
+
+/* task in run() on this thread and whether it cancelled itself */
+static __thread struct task *ll_run_current;
+static __thread bool ll_run_cancelled;
+
 /**
  * Implement an override of how cores defined in SOF topology
  * are mapped to host cores.
@@ -58,27 +124,106 @@ static unsigned int sof_host_core_base(void)
 	return host_core;
 }
 
-static void *ll_thread(void *data)
+/* wait for the next emulated LL tick */
+static int ll_wait_tick(struct timespec *ts)
 {
-	struct ll_vcore *vc = data;
-	struct timespec ts, td0, td1;
-	struct list_item *tlist, *tlist_;
-	struct task *task;
 	int err;
-	uint64_t delta;
+
+	while (1) {
+		/* wait for next tick */
+		err = nanosleep(ts, ts);
+		if (err == 0)
+			return 0; /* sleep fully completed */
+		else if (err == EINTR) {
+			continue; /* interrupted - keep going */
+		} else {
+			/* something bad happened ... */
+			fprintf(stderr, "error: sleep failed: %s\n",
+				strerror(err));
+			return -EINVAL;
+		}
+	}
+}
+
+static void ll_set_affinity(int core_id)
+{
 	cpu_set_t cpuset;
-	pthread_t thread;
+	int err;
 
-	/* Set affinity mask to pipeline core */
-	thread = pthread_self();
 	CPU_ZERO(&cpuset);
-	CPU_SET(vc->core_id, &cpuset);
+	CPU_SET(core_id, &cpuset);
 
-	printf("ll_schedule: new thread for core %d\n", vc->core_id);
-	err = pthread_setaffinity_np(thread, sizeof(cpuset), &cpuset);
+	err = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
 	if (err != 0)
 		fprintf(stderr, "error: failed to set CPU affinity to core %d: %s\n",
-			vc->core_id, strerror(err));
+			core_id, strerror(err));
+}
+
+static uint64_t ll_run_task(struct task *task)
+{
+	struct timespec td0, td1;
+	uint64_t delta;
+
+	ll_run_current = task;
+	ll_run_cancelled = false;
+
+	/* run task and time it */
+	clock_gettime(CLOCK_MONOTONIC, &td0);
+	task->ops.run(task->data);
+	clock_gettime(CLOCK_MONOTONIC, &td1);
+
+	ll_run_current = NULL;
+
+	/* Calculate average task exec time */
+	delta = (td1.tv_sec - td0.tv_sec) * 1000000;
+	delta += (td1.tv_nsec - td0.tv_nsec) / 1000;
+	task->start += delta;
+
+	return delta;
+}
+
+/* update the task state after run(), called with list_mutex held */
+static void ll_run_done(struct task *task)
+{
+	/* cancelled from its own run(), the pipeline can be freed now */
+	if (ll_run_cancelled)
+		task->state = SOF_TASK_STATE_CANCEL;
+	/* only re-queue if not cancelled */
+	else if (task->state == SOF_TASK_STATE_RUNNING)
+		task->state = SOF_TASK_STATE_QUEUED;
+}
+
+/* run all queued tasks in list order, called with list_mutex held */
+static void ll_run_list(struct ll_vcore *vc)
+{
+	struct list_item *tlist, *tlist_;
+	struct task *task;
+
+	/* iterate through the task list */
+	list_for_item_safe(tlist, tlist_, &vc->list) {
+		task = container_of(tlist, struct task, list);
+
+		/* only run queued tasks */
+		if (task->state == SOF_TASK_STATE_QUEUED) {
+			task->state = SOF_TASK_STATE_RUNNING;
+			pthread_mutex_unlock(&vc->list_mutex);
+
+			ll_run_task(task);
+
+			pthread_mutex_lock(&vc->list_mutex);
+			ll_run_done(task);
+		}
+	}
+}
+
+static void *ll_thread(void *data)
+{
+	struct ll_vcore *vc = data;
+	struct timespec ts;
+
+	/* Set affinity mask to pipeline core */
+	printf("ll_schedule: new thread for core %d\n", vc->core_id);
+	ll_set_affinity(vc->core_id);
 
 	/* convert uS to seconds and ns */
 	ts.tv_sec = tick_period_us / 1000000;
@@ -90,69 +235,594 @@ static void *ll_thread(void *data)
 		 * here to provide a similar processing experience on testbench
 		 * to actual DSP FW.
 		 */
-		if (tick_period_us) {
-			while (1) {
-				/* wait for next tick */
-				err = nanosleep(&ts, &ts);
-				if (err == 0)
-					break; /* sleep fully completed */
-				else if (err == EINTR) {
-					continue; /* interrupted - keep going */
-				} else {
-					/* something bad happened ... */
-					fprintf(stderr, "error: sleep failed: %s\n",
-						strerror(err));
-					goto out;
-				}
-			}
-		}
+		if (tick_period_us && ll_wait_tick(&ts) < 0)
+			goto out;
 
 		/* LL time slice now running at this point */
 		pthread_mutex_lock(&vc->list_mutex);
 
-		/* list empty then return */
+		/* list empty then return, a task scheduled from now on starts a new thread */
 		if (list_is_empty(&vc->list)) {
+			vc->vcore_ready = 0;
 			pthread_mutex_unlock(&vc->list_mutex);
 			fprintf(stdout, "LL scheduler thread exit - list empty\n");
 			break;
 		}
 
-		/* iterate through the task list */
-		list_for_item_safe(tlist, tlist_, &vc->list) {
-			task = container_of(tlist, struct task, list);
+		ll_run_list(vc);
 
-			/* only run queued tasks */
-			if (task->state == SOF_TASK_STATE_QUEUED) {
-				task->state = SOF_TASK_STATE_RUNNING;
-				pthread_mutex_unlock(&vc->list_mutex);
+		pthread_mutex_unlock(&vc->list_mutex);
+	}
 
-				/* run task and time it */
-				clock_gettime(CLOCK_MONOTONIC, &td0);
-				task->ops.run(task->data);
-				clock_gettime(CLOCK_MONOTONIC, &td1);
+out:
+	/* nothing in list so stop LL thread */
+	vc->vcore_ready = 0;
+	return NULL;
+}
 
-				pthread_mutex_lock(&vc->list_mutex);
+/* grow the per tick arrays to hold all tasks in the list */
+static int ll_exec_reserve(struct ll_exec *exec, int count)
+{
+	struct task **tasks;
+	int *next;
+	struct ll_exec_chain *chains;
+	int i;
 
-				/* only re-queue if not cancelled */
-				if (task->state == SOF_TASK_STATE_RUNNING)
-					task->state = SOF_TASK_STATE_QUEUED;
+	if (count <= exec->capacity)
+		return 0;
 
-				/* Calculate average task exec time */
-				delta = (td1.tv_sec - td0.tv_sec) * 1000000;
-				delta += (td1.tv_nsec - td0.tv_nsec) / 1000;
-				task->start += delta;
-			}
+	count = MAX(count, exec->capacity * 2);
+
+	/*
+	 * Arrays grown before a failure keep their new size, the capacity is
+	 * only raised once all of them have grown, so it always matches the
+	 * smallest one.
+	 */
+	tasks = realloc(exec->tasks, count * sizeof(*tasks));
+	if (!tasks)
+		return -ENOMEM;
+	exec->tasks = tasks;
+
+	next = realloc(exec->next, count * sizeof(*next));
+	if (!next)
+		return -ENOMEM;
+	exec->next = next;
+
+	chains = realloc(exec->chains, count * sizeof(*chains));
+	if (!chains)
+		return -ENOMEM;
+	exec->chains = chains;
+
+	for (i = 0; i < exec->num_workers; i++) {
+		next = realloc(exec->workers[i].deque.items, count * sizeof(*next));
+		if (!next)
+			return -ENOMEM;
+		exec->workers[i].deque.items = next;
+	}
+
+	exec->capacity = count;
+	return 0;
+}
+
+/*
+ * Group queued tasks to chains in list order, called with list_mutex held.
+ * Tasks sharing the same root, see ll_exec_join_connected(), run in list
+ * order by one worker, other chains are independent.
+ */
+static int ll_exec_build_chains(struct ll_exec *exec, struct ll_vcore *vc)
+{
+	struct list_item *tlist;
+	struct task *task;
+	const void *root;
+	int count = 0;
+	int ret;
+	int i;
+
+	list_for_item(tlist, &vc->list)
+		count++;
+
+	ret = ll_exec_reserve(exec, count);
+	if (ret < 0)
+		return ret;
+
+	exec->num_chains = 0;
+	count = 0;
+
+	list_for_item(tlist, &vc->list) {
+		task = container_of(tlist, struct task, list);
+		if (task->state != SOF_TASK_STATE_QUEUED)
+			continue;
+
+		exec->tasks[count] = task;
+		exec->next[count] = -1;
+		root = ll_sch_get_pdata(task);
+
+		for (i = 0; i < exec->num_chains; i++)
+			if (exec->chains[i].root == root)
+				break;
+
+		if (i < exec->num_chains) {
+			exec->next[exec->chains[i].last] = count;
+			exec->chains[i].last = count;
+		} else {
+			exec->chains[i].root = root;
+			exec->chains[i].first = count;
+			exec->chains[i].last = count;
+			exec->num_chains++;
+		}
+
+		count++;
+	}
+
+	return 0;
+}
+
+/* owner takes the most recently pushed chain */
+static int ll_exec_pop(struct ll_exec_deque *dq)
+{
+	int chain = -1;
+
+	pthread_mutex_lock(&dq->lock);
+	if (dq->tail != dq->head)
+		chain = dq->items[--dq->tail];
+	pthread_mutex_unlock(&dq->lock);
+
+	return chain;
+}
+
+/* thieves take the oldest chain */
+static int ll_exec_steal(struct ll_exec_deque *dq)
+{
+	int chain = -1;
+
+	pthread_mutex_lock(&dq->lock);
+	if (dq->tail != dq->head)
+		chain = dq->items[dq->head++];
+	pthread_mutex_unlock(&dq->lock);
+
+	return chain;
+}
+
+static void ll_exec_run_chain(struct ll_exec_worker *w, int chain)
+{
+	struct ll_exec *exec = w->exec;
+	struct ll_vcore *vc = exec->vc;
+	struct task *task;
+	int i;
+
+	for (i = exec->chains[chain].first; i >= 0; i = exec->next[i]) {
+		task = exec->tasks[i];
+
+		/* task can be cancelled after the chains were built */
+		pthread_mutex_lock(&vc->list_mutex);
+		if (task->state != SOF_TASK_STATE_QUEUED) {
+			pthread_mutex_unlock(&vc->list_mutex);
+			continue;
+		}
+		task->state = SOF_TASK_STATE_RUNNING;
+		pthread_mutex_unlock(&vc->list_mutex);
+
+		w->busy_us += ll_run_task(task);
+
+		pthread_mutex_lock(&vc->list_mutex);
+		ll_run_done(task);
+		pthread_mutex_unlock(&vc->list_mutex);
+	}
+
+	w->chains++;
+}
+
+/* run chains of the current tick until all deques are empty */
+static void ll_exec_run_tick(struct ll_exec_worker *w)
+{
+	struct ll_exec *exec = w->exec;
+	int chain;
+	int i;
+
+	while (1) {
+		chain = ll_exec_pop(&w->deque);
+
+		for (i = 1; chain < 0 && i < exec->num_workers; i++) {
+			chain = ll_exec_steal(&exec->workers[(w->index + i) %
+							     exec->num_workers].deque);
+			if (chain >= 0)
+				w->steals++;
+		}
+
+		if (chain < 0)
+			return;
+
+		ll_exec_run_chain(w, chain);
+
+		pthread_mutex_lock(&exec->lock);
+		if (!--exec->pending)
+			pthread_cond_broadcast(&exec->done);
+		pthread_mutex_unlock(&exec->lock);
+	}
+}
+
+static void *ll_exec_worker_thread(void *data)
+{
+	struct ll_exec_worker *w = data;
+	struct ll_exec *exec = w->exec;
+	uint32_t tick = 0;
+	bool stop;
+
+	ll_exec_thread = true;
+	ll_set_affinity((exec->vc->core_id + w->index) % exec->num_cpus);
+
+	while (1) {
+		pthread_mutex_lock(&exec->lock);
+		while (!exec->stop && exec->tick == tick)
+			pthread_cond_wait(&exec->start, &exec->lock);
+		tick = exec->tick;
+		stop = exec->stop;
+		pthread_mutex_unlock(&exec->lock);
+
+		if (stop)
+			break;
+
+		ll_exec_run_tick(w);
+	}
+
+	return NULL;
+}
+
+/* queue chains round robin, a chain runs on the same worker every tick */
+static void ll_exec_start_tick(struct ll_exec *exec)
+{
+	struct ll_exec_deque *dq;
+	int i;
+
+	for (i = 0; i < exec->num_workers; i++) {
+		dq = &exec->workers[i].deque;
+		pthread_mutex_lock(&dq->lock);
+		dq->head = 0;
+		dq->tail = 0;
+		pthread_mutex_unlock(&dq->lock);
+	}
+
+	/* push in reverse so owners pop chains in list order */
+	for (i = exec->num_chains - 1; i >= 0; i--) {
+		dq = &exec->workers[i % exec->num_workers].deque;
+		pthread_mutex_lock(&dq->lock);
+		dq->items[dq->tail++] = i;
+		pthread_mutex_unlock(&dq->lock);
+	}
+
+	exec->pending = exec->num_chains;
+	exec->tick++;
+	pthread_cond_broadcast(&exec->start);
+}
+
+static void ll_exec_report(struct ll_exec *exec, uint64_t wall_us)
+{
+	struct ll_exec_worker *w;
+	int i;
+
+	for (i = 0; i < exec->num_workers; i++) {
+		w = &exec->workers[i];
+		printf("ll_schedule: worker %d busy %.1f%% chains %u steals %u\n",
+		       i, wall_us ? 100.0 * w->busy_us / wall_us : 0.0,
+		       w->chains, w->steals);
+	}
+}
+
+/*
+ * Work stealing variant of ll_thread(). This thread waits for the tick,
+ * hands the queued chains to the workers and runs chains as worker 0.
+ */
+static void *ll_exec_thread_main(void *data)
+{
+	struct ll_vcore *vc = data;
+	struct ll_exec *exec = vc->exec;
+	struct ll_exec_worker *w;
+	struct timespec ts, t0, t1;
+	uint64_t wall_us = 0;
+	int started;
+	int ret;
+	int i;
+
+	ll_exec_thread = true;
+	ll_set_affinity(vc->core_id);
+	printf("ll_schedule: new executor for core %d with %d workers\n",
+	       vc->core_id, exec->num_workers);
+
+	exec->stop = false;
+	exec->tick = 0;
+	exec->pending = 0;
+
+	for (started = 1; started < exec->num_workers; started++) {
+		w = &exec->workers[started];
+		w->busy_us = 0;
+		w->chains = 0;
+		w->steals = 0;
+		ret = pthread_create(&w->thread_id, NULL, ll_exec_worker_thread, w);
+		if (ret) {
+			fprintf(stderr, "error: failed to create LL worker %d %s\n",
+				started, strerror(ret));
+			goto out;
+		}
+	}
+
+	w = &exec->workers[0];
+	w->busy_us = 0;
+	w->chains = 0;
+	w->steals = 0;
+
+	ts.tv_sec = tick_period_us / 1000000;
+	ts.tv_nsec = (tick_period_us % 1000000) * 1000;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	while (1) {
+		if (tick_period_us && ll_wait_tick(&ts) < 0)
+			break;
+
+		pthread_mutex_lock(&vc->list_mutex);
+
+		/* list empty then return */
+		if (list_is_empty(&vc->list)) {
+			pthread_mutex_unlock(&vc->list_mutex);
+			fprintf(stdout, "LL scheduler thread exit - list empty\n");
+			break;
 		}
 
+		/* without memory for the chains run the tick on this thread */
+		ret = ll_exec_build_chains(exec, vc);
+		if (ret < 0) {
+			ll_run_list(vc);
+			pthread_mutex_unlock(&vc->list_mutex);
+			continue;
+		}
+
+		/* publish before the list is unlocked, cancel waits for the tick */
+		pthread_mutex_lock(&exec->lock);
+		ll_exec_start_tick(exec);
+		pthread_mutex_unlock(&exec->lock);
 		pthread_mutex_unlock(&vc->list_mutex);
+
+		ll_exec_run_tick(w);
+
+		pthread_mutex_lock(&exec->lock);
+		while (exec->pending)
+			pthread_cond_wait(&exec->done, &exec->lock);
+		pthread_mutex_unlock(&exec->lock);
 	}
 
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	wall_us = (t1.tv_sec - t0.tv_sec) * 1000000;
+	wall_us += (t1.tv_nsec - t0.tv_nsec) / 1000;
+
 out:
-	/* nothing in list so stop LL thread */
+	pthread_mutex_lock(&exec->lock);
+	exec->stop = true;
+	pthread_cond_broadcast(&exec->start);
+	pthread_mutex_unlock(&exec->lock);
+
+	for (i = 1; i < started; i++)
+		pthread_join(exec->workers[i].thread_id, NULL);
+
+	if (started == exec->num_workers)
+		ll_exec_report(exec, wall_us);
+
 	vc->vcore_ready = 0;
 	return NULL;
 }
 
+/* wait until tasks of the current tick have run, not called from workers */
+static void ll_exec_wait_tick(struct ll_vcore *vc)
+{
+	struct ll_exec *exec = vc->exec;
+
+	if (!exec || ll_exec_thread)
+		return;
+
+	pthread_mutex_lock(&exec->lock);
+	while (exec->pending)
+		pthread_cond_wait(&exec->done, &exec->lock);
+	pthread_mutex_unlock(&exec->lock);
+}
+
+static struct ll_exec *ll_exec_new(struct ll_vcore *vc)
+{
+	const char *env = getenv("SOF_HOST_LL_WORKERS");
+	struct ll_exec *exec;
+	int workers;
+	int cpus;
+	int i;
+
+	if (!env)
+		return NULL;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus <= 0)
+		cpus = 1;
+
+	workers = atoi(env);
+	if (workers <= 0)
+		workers = cpus;
+
+	exec = calloc(1, sizeof(*exec));
+	if (!exec)
+		return NULL;
+
+	exec->workers = calloc(workers, sizeof(*exec->workers));
+	if (!exec->workers) {
+		free(exec);
+		return NULL;
+	}
+
+	exec->vc = vc;
+	exec->num_workers = workers;
+	exec->num_cpus = cpus;
+	pthread_mutex_init(&exec->lock, NULL);
+	pthread_cond_init(&exec->start, NULL);
+	pthread_cond_init(&exec->done, NULL);
+
+	for (i = 0; i < workers; i++) {
+		exec->workers[i].exec = exec;
+		exec->workers[i].index = i;
+		pthread_mutex_init(&exec->workers[i].deque.lock, NULL);
+	}
+
+	return exec;
+}
+
+static void ll_exec_free(struct ll_exec *exec)
+{
+	int i;
+
+	if (!exec)
+		return;
+
+	for (i = 0; i < exec->num_workers; i++)
+		free(exec->workers[i].deque.items);
+
+	free(exec->workers);
+	free(exec->tasks);
+	free(exec->next);
+	free(exec->chains);
+	free(exec);
+}
+
+/* union-find over the pipelines of the topology */
+static int ll_exec_find(int *parent, int i)
+{
+	while (parent[i] != i) {
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+
+	return i;
+}
+
+static int ll_exec_pipe_index(struct pipeline **pipes, int count, const struct pipeline *p)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+		if (pipes[i] == p)
+			return i;
+
+	return -1;
+}
+
+/* index of the pipeline running the task, -1 if not a pipeline task */
+static int ll_exec_task_pipe(struct pipeline **pipes, int count, const struct task *task)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+		if (pipes[i]->pipe_task == task)
+			return i;
+
+	return -1;
+}
+
+/* gives all tasks with the old root the new one, called with list_mutex held */
+static void ll_exec_set_root(struct ll_vcore *vc, const void *old, void *root)
+{
+	struct list_item *tlist;
+	struct task *task;
+
+	list_for_item(tlist, &vc->list) {
+		task = container_of(tlist, struct task, list);
+		if (ll_sch_get_pdata(task) == old)
+			ll_sch_set_pdata(task, root);
+	}
+}
+
+/*
+ * Pipelines connected by a buffer must not run at the same time, as the
+ * producer and consumer would both update the buffer. Puts the task of a
+ * newly scheduled pipeline into the chain of any queued pipeline connected
+ * to it through buffers, merging chains as needed. Called in IPC context,
+ * so the topology doesn't change meanwhile, with list_mutex held.
+ */
+static void ll_exec_join_connected(struct ll_vcore *vc, struct task *task)
+{
+	struct ipc *ipc = ipc_get();
+	struct list_item *clist, *blist, *tlist;
+	struct ipc_comp_dev *icd;
+	struct comp_buffer *buffer;
+	struct comp_dev *sink;
+	struct pipeline **pipes;
+	struct task *queued;
+	void *root;
+	int *parent;
+	int count = 0;
+	int self;
+	int a, b;
+
+	if (!vc->exec)
+		return;
+
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_PIPELINE)
+			count++;
+	}
+
+	if (!count)
+		return;
+
+	pipes = malloc(count * sizeof(*pipes));
+	parent = malloc(count * sizeof(*parent));
+	if (!pipes || !parent) {
+		/* serialize everything rather than risk a race */
+		list_for_item(tlist, &vc->list)
+			ll_sch_set_pdata(container_of(tlist, struct task, list), vc);
+		goto out;
+	}
+
+	count = 0;
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_PIPELINE) {
+			parent[count] = count;
+			pipes[count++] = icd->pipeline;
+		}
+	}
+
+	/* join pipelines at both ends of every buffer */
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_COMPONENT)
+			continue;
+
+		list_for_item(blist, &icd->cd->bsink_list) {
+			buffer = container_of(blist, struct comp_buffer, source_list);
+			sink = buffer_get_comp(buffer, PPL_DIR_DOWNSTREAM);
+			if (!sink)
+				continue;
+
+			a = ll_exec_pipe_index(pipes, count, icd->cd->pipeline);
+			b = ll_exec_pipe_index(pipes, count, sink->pipeline);
+			if (a >= 0 && b >= 0)
+				parent[ll_exec_find(parent, a)] = ll_exec_find(parent, b);
+		}
+	}
+
+	self = ll_exec_task_pipe(pipes, count, task);
+	if (self < 0)
+		goto out;
+
+	self = ll_exec_find(parent, self);
+	root = ll_sch_get_pdata(task);
+
+	list_for_item(tlist, &vc->list) {
+		queued = container_of(tlist, struct task, list);
+		a = ll_exec_task_pipe(pipes, count, queued);
+		if (a >= 0 && ll_exec_find(parent, a) == self &&
+		    ll_sch_get_pdata(queued) != root)
+			ll_exec_set_root(vc, ll_sch_get_pdata(queued), root);
+	}
+
+out:
+	free(pipes);
+	free(parent);
+}
+
 static int schedule_ll_task_complete(void *data, struct task *task)
 {
 	struct ll_vcore *vc = data;
@@ -166,11 +836,9 @@ static int schedule_ll_task_complete(void *data, struct task *task)
 	return 0;
 }
 
-/* schedule new LL task */
-static int schedule_ll_task(void *data, struct task *task, uint64_t start,
-			    uint64_t period)
+/* start the vcore thread if not running */
+static int schedule_ll_start(struct ll_vcore *vc, struct task *task)
 {
-	struct ll_vcore *vc = data;
 	pthread_attr_t attr;
 	struct sched_param param;
 	int err;
@@ -178,13 +846,6 @@ static int schedule_ll_task(void *data, struct task *task, uint64_t start,
 	uid_t uid = getuid();
 	uid_t euid = geteuid();
 
-	/* add task to list */
-	pthread_mutex_lock(&vc->list_mutex);
-	list_item_prepend(&task->list, &vc->list);
-	task->state = SOF_TASK_STATE_QUEUED;
-	task->start = 0;
-	pthread_mutex_unlock(&vc->list_mutex);
-
 	/* is vcore thread running ? */
 	if (!vc->vcore_ready) {
 		/* do we have elevated privileges to attempt RT priority */
@@ -223,7 +884,8 @@ static int schedule_ll_task(void *data, struct task *task, uint64_t start,
 create:
 		/* nope, so start thread for this virtual core */
 		err = pthread_create(&vc->thread_id, valid_attr ? &attr : NULL,
-				     ll_thread, &vc[task->core]);
+				     vc->exec ? ll_exec_thread_main : ll_thread,
+				     &vc[task->core]);
 		if (err < 0) {
 			fprintf(stderr, "error: failed to create LL thread for vcore %d %s\n",
 				task->core, strerror(err));
@@ -236,8 +898,59 @@ create:
 	return 0;
 }
 
+/* schedule new LL task */
+static int schedule_ll_task(void *data, struct task *task, uint64_t start,
+			    uint64_t period)
+{
+	struct ll_vcore *vc = data;
+
+	/* add task to list */
+	pthread_mutex_lock(&vc->list_mutex);
+	list_item_prepend(&task->list, &vc->list);
+	task->state = SOF_TASK_STATE_QUEUED;
+	task->start = 0;
+	ll_sch_set_pdata(task, task);
+	ll_exec_join_connected(vc, task);
+	pthread_mutex_unlock(&vc->list_mutex);
+
+	return schedule_ll_start(vc, task);
+}
+
+/* schedule LL task to run in the same tick and thread as reference task */
+static int schedule_ll_task_ref(struct ll_vcore *vc, struct task *task,
+				struct task *ref, bool before)
+{
+	pthread_mutex_lock(&vc->list_mutex);
+	if (before)
+		list_item_append(&task->list, &ref->list);
+	else
+		list_item_prepend(&task->list, &ref->list);
+	task->state = SOF_TASK_STATE_QUEUED;
+	task->start = 0;
+	ll_sch_set_pdata(task, ll_sch_get_pdata(ref));
+	ll_exec_join_connected(vc, task);
+	pthread_mutex_unlock(&vc->list_mutex);
+
+	return schedule_ll_start(vc, task);
+}
+
+static int schedule_ll_task_before(void *data, struct task *task, uint64_t start,
+				   uint64_t period, struct task *before)
+{
+	return schedule_ll_task_ref(data, task, before, true);
+}
+
+static int schedule_ll_task_after(void *data, struct task *task, uint64_t start,
+				  uint64_t period, struct task *after)
+{
+	return schedule_ll_task_ref(data, task, after, false);
+}
+
 static void ll_scheduler_free(void *data, uint32_t flags)
 {
+	struct ll_vcore *vc = data;
+
+	ll_exec_free(vc->exec);
 	free(data);
 }
 
@@ -248,15 +961,27 @@ static int schedule_ll_task_cancel(void *data, struct task *task)
 
 	pthread_mutex_lock(&vc->list_mutex);
 	/* delete task */
-	task->state = SOF_TASK_STATE_CANCEL;
 	list_item_del(&task->list);
 
+	/*
+	 * The testbench frees the pipeline once it sees the cancelled state,
+	 * a task cancelling itself is marked cancelled after its run().
+	 */
+	if (task == ll_run_current) {
+		ll_run_cancelled = true;
+		pthread_mutex_unlock(&vc->list_mutex);
+		return 0;
+	}
+
+	task->state = SOF_TASK_STATE_CANCEL;
+
 	/* list empty then return */
-	if (list_is_empty(&vc->list)) {
+	if (list_is_empty(&vc->list) && !ll_exec_thread) {
 		pthread_mutex_unlock(&vc->list_mutex);
 		pthread_join(vc->thread_id, NULL);
 	} else {
 		pthread_mutex_unlock(&vc->list_mutex);
+		ll_exec_wait_tick(vc);
 	}
 
 	return 0;
@@ -272,11 +997,12 @@ static int schedule_ll_task_free(void *data, struct task *task)
 	list_item_del(&task->list);
 
 	/* list empty then return */
-	if (list_is_empty(&vc->list)) {
+	if (list_is_empty(&vc->list) && !ll_exec_thread) {
 		pthread_mutex_unlock(&vc->list_mutex);
 		pthread_join(vc->thread_id, NULL);
 	} else {
 		pthread_mutex_unlock(&vc->list_mutex);
+		ll_exec_wait_tick(vc);
 	}
 
 	return 0;
@@ -284,6 +1010,8 @@ static int schedule_ll_task_free(void *data, struct task *task)
 
 static struct scheduler_ops schedule_ll_ops = {
 	.schedule_task		= schedule_ll_task,
+	.schedule_task_before	= schedule_ll_task_before,
+	.schedule_task_after	= schedule_ll_task_after,
 	.schedule_task_running	= NULL,
 	.schedule_task_complete = schedule_ll_task_complete,
 	.reschedule_task	= NULL,
@@ -321,6 +1049,9 @@ int scheduler_init_ll(struct ll_schedule_domain *domain)
 		vcore[i].core_id = core_zero + i;
 	}
 
+	/* all tasks are queued to vcore 0, optionally run them on N threads */
+	vcore[0].exec = ll_exec_new(&vcore[0]);
+
 	scheduler_init(SOF_SCHEDULE_LL_TIMER, &schedule_ll_ops, vcore);
 
 	return 0;
@@ -22,6 +22,7 @@
 #include <sof/platform.h>
 #include <sof/schedule/ll_schedule.h>
 #include <sof/schedule/ll_schedule_domain.h>
+#include <sof/schedule/ll_schedule_stats.h>
 #include <sof/schedule/schedule.h>
 #include <sof/schedule/task.h>
 #include <rtos/spinlock.h>
@@ -74,6 +75,9 @@ struct ll_schedule_data {
 	struct perf_cnt_data pcd;
 #endif
 	struct ll_schedule_domain *domain;	/* scheduling domain */
+#if CONFIG_SCHEDULE_LL_STATS
+	struct ll_sched_stats stats;		/* statistics for the host */
+#endif
 };
 
 static const struct scheduler_ops schedule_ll_ops;
@@ -205,7 +209,7 @@ static void schedule_ll_tasks_execute(struct ll_schedule_data *sch)
 	 * a pipeline task terminates a DMIC task.
 	 */
 	while (wlist != &sch->tasks) {
-#ifdef CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS
+#if defined(CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS) || CONFIG_SCHEDULE_LL_STATS
 		uint32_t cycles0, cycles1;
 #endif
 		task = list_item(wlist, struct task, list);
@@ -217,7 +221,7 @@ static void schedule_ll_tasks_execute(struct ll_schedule_data *sch)
 
 		tr_dbg(&ll_tr, "task %p %pU being started...", task, task->uid);
 
-#ifdef CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS
+#if defined(CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS) || CONFIG_SCHEDULE_LL_STATS
 		cycles0 = (uint32_t)sof_cycle_get_64();
 #endif
 		task->state = SOF_TASK_STATE_RUNNING;
@@ -245,9 +249,14 @@ static void schedule_ll_tasks_execute(struct ll_schedule_data *sch)
 
 		k_spin_unlock(&domain->lock, key);
 
-#ifdef CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS
+#if defined(CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS) || CONFIG_SCHEDULE_LL_STATS
 		cycles1 = (uint32_t)sof_cycle_get_64();
+#endif
+#ifdef CONFIG_SCHEDULE_LOG_CYCLE_STATISTICS
 		dsp_load_check(task, cycles0, cycles1);
+#endif
+#if CONFIG_SCHEDULE_LL_STATS
+		ll_stats_task_run(&sch->stats, task, cycles1 - cycles0);
 #endif
 	}
 }
@@ -287,6 +296,22 @@ static void schedule_ll_client_reschedule(struct ll_schedule_data *sch)
 
 }
 
+#if CONFIG_SCHEDULE_LL_STATS
+/* interrupts are disabled, the task list can't change */
+static void schedule_ll_stats_tick(struct ll_schedule_data *sch, uint64_t start)
+{
+	struct list_item *tlist;
+
+	if (!ll_stats_tick(&sch->stats, start, sof_cycle_get_64()))
+		return;
+
+	list_for_item(tlist, &sch->tasks)
+		ll_stats_publish_task(&sch->stats, container_of(tlist, struct task, list));
+
+	ll_stats_publish(&sch->stats);
+}
+#endif
+
 static void schedule_ll_tasks_run(void *data)
 {
 	struct ll_schedule_data *sch = data;
@@ -294,6 +319,9 @@ static void schedule_ll_tasks_run(void *data)
 	k_spinlock_key_t key;
 	uint32_t flags;
 	uint32_t core = cpu_get_id();
+#if CONFIG_SCHEDULE_LL_STATS
+	uint64_t tick_start = sof_cycle_get_64();
+#endif
 
 	tr_dbg(&ll_tr, "timer interrupt on core %d, at %u, previous next_tick %u",
 	       core,
@@ -325,6 +353,10 @@ static void schedule_ll_tasks_run(void *data)
 	perf_cnt_stamp(&sch->pcd, perf_ll_sched_trace, 0 /* ignored */);
 	perf_cnt_average(&sch->pcd, perf_avg_ll_sched_trace, 0 /* ignored */);
 
+#if CONFIG_SCHEDULE_LL_STATS
+	schedule_ll_stats_tick(sch, tick_start);
+#endif
+
 	key = k_spin_lock(&domain->lock);
 
 	/* reset the new_target_tick for the first core */
@@ -781,6 +813,9 @@ int scheduler_init_ll(struct ll_schedule_domain *domain)
 	list_init(&sch->tasks);
 	atomic_init(&sch->num_tasks, 0);
 	sch->domain = domain;
+#if CONFIG_SCHEDULE_LL_STATS
+	ll_stats_init(&sch->stats, cpu_get_id());
+#endif
 
 	/* notification of clock changes */
 	notifier_register(sch, NULL, NOTIFIER_CLK_CHANGE_ID(domain->clk),
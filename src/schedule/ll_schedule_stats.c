@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <rtos/cache.h>
+#include <rtos/timer.h>
+#include <sof/common.h>
+#include <sof/lib/cpu.h>
+#include <sof/lib/memory.h>
+#include <sof/lib/uuid.h>
+#include <sof/math/numbers.h>
+#include <sof/schedule/ll_schedule_domain.h>
+#include <sof/schedule/ll_schedule_stats.h>
+#include <sof/schedule/task.h>
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Published statistics of one core. seq is odd while the owning core
+ * is writing, the reader retries or gives up on an odd or changed seq.
+ */
+struct ll_stats_shared {
+	uint32_t seq;
+	struct ll_core_stats_info info;
+} __aligned(PLATFORM_DCACHE_ALIGN);
+
+static struct ll_stats_shared ll_stats_shared[CONFIG_CORE_COUNT];
+
+void ll_stats_init(struct ll_sched_stats *stats, int core)
+{
+	stats->window_start = sof_cycle_get_64();
+	stats->window_busy = 0;
+	stats->ticks = 0;
+	stats->overruns = 0;
+	stats->budget = k_us_to_cyc_ceil64(LL_TIMER_PERIOD_US);
+	stats->window_ticks = 0;
+	stats->core = core;
+}
+
+static inline int ll_stats_hist_bin(uint32_t cycles)
+{
+	int bin;
+
+	if (cycles >> (LL_STATS_HIST_SHIFT + 1) == 0)
+		return 0;
+
+	bin = 31 - clz(cycles) - LL_STATS_HIST_SHIFT;
+
+	return MIN(bin, LL_STATS_HIST_BINS - 1);
+}
+
+void ll_stats_task_run(struct ll_sched_stats *stats, struct task *task, uint32_t cycles)
+{
+	struct ll_task_stats *ts = &task->ll_stats;
+
+	ts->hist[ll_stats_hist_bin(cycles)]++;
+	ts->runs++;
+
+	if (cycles > stats->budget)
+		ts->overruns++;
+
+	if (cycles > ts->cycles_max)
+		ts->cycles_max = cycles;
+}
+
+bool ll_stats_tick(struct ll_sched_stats *stats, uint64_t start, uint64_t end)
+{
+	struct ll_stats_shared *shared = ll_stats_shared + stats->core;
+	struct ll_core_stats_info *info = &shared->info;
+	uint64_t busy = end - start;
+
+	stats->ticks++;
+	stats->window_busy += busy;
+
+	if (busy > stats->budget)
+		stats->overruns++;
+
+	if (++stats->window_ticks < 1 << LL_STATS_WINDOW_SIZE)
+		return false;
+
+	shared->seq++;
+	dcache_writeback_region((__sparse_force void __sparse_cache *)&shared->seq,
+				sizeof(shared->seq));
+
+	info->ticks = stats->ticks;
+	info->overruns = stats->overruns;
+	info->budget = stats->budget;
+	info->window_cycles = end - stats->window_start;
+	info->window_busy = stats->window_busy;
+	info->task_count = 0;
+
+	stats->window_start = end;
+	stats->window_busy = 0;
+	stats->window_ticks = 0;
+
+	return true;
+}
+
+void ll_stats_publish_task(struct ll_sched_stats *stats, struct task *task)
+{
+	struct ll_core_stats_info *info = &ll_stats_shared[stats->core].info;
+	struct ll_task_stats_info *ti;
+
+	if (info->task_count < LL_STATS_MAX_TASKS) {
+		ti = info->tasks + info->task_count;
+		ti->uuid = task->uid->id;
+		ti->id = (uint32_t)(uintptr_t)task;
+		ti->priority = task->priority;
+		ti->stats = task->ll_stats;
+	}
+
+	info->task_count++;
+}
+
+void ll_stats_publish(struct ll_sched_stats *stats)
+{
+	struct ll_stats_shared *shared = ll_stats_shared + stats->core;
+
+	shared->info.task_info_count = MIN(shared->info.task_count, LL_STATS_MAX_TASKS);
+
+	shared->seq++;
+	dcache_writeback_region((__sparse_force void __sparse_cache *)shared, sizeof(*shared));
+}
+
+int ll_stats_get(int core, struct ll_core_stats_info *info)
+{
+	struct ll_stats_shared *shared = ll_stats_shared + core;
+	uint32_t seq;
+
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)shared, sizeof(*shared));
+
+	seq = shared->seq;
+	if (!seq)
+		return -ENODATA;
+
+	if (seq & 1)
+		return -EAGAIN;
+
+	*info = shared->info;
+
+	/* the owning core may have started publishing while copying */
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)&shared->seq,
+				 sizeof(shared->seq));
+
+	return shared->seq == seq ? 0 : -EAGAIN;
+}
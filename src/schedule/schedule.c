@@ -41,6 +41,9 @@ int schedule_task_init(struct task *task,
 	task->state = SOF_TASK_STATE_INIT;
 	task->ops.run = run;
 	task->data = data;
+#if CONFIG_SCHEDULE_LL_STATS
+	task->ll_stats = (struct ll_task_stats){ 0 };
+#endif
 
 	return 0;
 }
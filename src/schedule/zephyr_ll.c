@@ -8,8 +8,11 @@
 #include <rtos/spinlock.h>
 #include <sof/audio/component.h>
 #include <rtos/interrupt.h>
+#include <rtos/timer.h>
 #include <sof/lib/notifier.h>
 #include <sof/schedule/ll_schedule_domain.h>
+#include <sof/schedule/ll_schedule_stats.h>
+#include <sof/schedule/ll_task_queue.h>
 #include <sof/schedule/schedule.h>
 #include <sof/schedule/task.h>
 #include <sof/lib/perf_cnt.h>
@@ -25,16 +28,21 @@ DECLARE_TR_CTX(ll_tr, SOF_UUID(zll_sched_uuid), LOG_LEVEL_INFO);
 
 /* per-scheduler data */
 struct zephyr_ll {
-	struct list_item tasks;			/* list of ll tasks */
+	struct ll_task_queue queue;		/* ll tasks by priority */
 	unsigned int n_tasks;			/* task counter */
 	struct ll_schedule_domain *ll_domain;	/* scheduling domain */
 	unsigned int core;			/* core ID of this instance */
+#if CONFIG_SCHEDULE_LL_STATS
+	struct ll_sched_stats stats;		/* statistics for the host */
+#endif
 };
 
 /* per-task scheduler data */
 struct zephyr_ll_pdata {
 	bool run;
 	bool freeing;
+	bool queued;		/* on the scheduler queue */
+	uint8_t list_index;	/* queue list holding the task */
 	struct k_sem sem;
 };
 
@@ -57,7 +65,10 @@ static void zephyr_ll_assert_core(const struct zephyr_ll *sch)
 static void zephyr_ll_task_done(struct zephyr_ll *sch,
 				struct task *task)
 {
-	list_item_del(&task->list);
+	struct zephyr_ll_pdata *pdata = task->priv_data;
+
+	ll_task_queue_del(&sch->queue, task, pdata->list_index);
+	pdata->queued = false;
 
 	if (!sch->n_tasks) {
 		tr_info(&ll_tr, "task count underrun!");
@@ -81,40 +92,28 @@ static void zephyr_ll_task_done(struct zephyr_ll *sch,
 /* The caller must hold the lock and possibly disable interrupts */
 static void zephyr_ll_task_insert_unlocked(struct zephyr_ll *sch, struct task *task)
 {
-	struct task *task_iter;
-	struct list_item *list;
+	struct zephyr_ll_pdata *pdata = task->priv_data;
 
 	task->state = SOF_TASK_STATE_QUEUED;
 
 	/*
-	 * Tasks are added into the list from highest to lowest priority. This
-	 * way they can then be run in the same order. Tasks with the same
+	 * Tasks are run from highest to lowest priority. Tasks with the same
 	 * priority are served on a first-come-first-serve basis
 	 */
-	list_for_item(list, &sch->tasks) {
-		task_iter = container_of(list, struct task, list);
-		if (task->priority < task_iter->priority) {
-			list_item_append(&task->list, &task_iter->list);
-			break;
-		}
-	}
-
-	/*
-	 * If the task has not been added, it means that it has the lowest
-	 * priority and should be added at the end of the list
-	 */
-	if (list == &sch->tasks)
-		list_item_append(&task->list, &sch->tasks);
+	pdata->list_index = ll_task_queue_add(&sch->queue, task);
+	pdata->queued = true;
 }
 
-static void zephyr_ll_task_insert_before_unlocked(struct task *task, struct task *before)
+/* The task goes to the queue list of the reference, next to it */
+static void zephyr_ll_task_insert_next_to_unlocked(struct zephyr_ll *sch, struct task *task,
+						   struct task *reference, bool before)
 {
-	list_item_append(&task->list, &before->list);
-}
+	struct zephyr_ll_pdata *ref_pdata = reference->priv_data;
+	struct zephyr_ll_pdata *pdata = task->priv_data;
 
-static void zephyr_ll_task_insert_after_unlocked(struct task *task, struct task *after)
-{
-	list_item_prepend(&task->list, &after->list);
+	ll_task_queue_add_next_to(&sch->queue, task, reference, ref_pdata->list_index, before);
+	pdata->list_index = ref_pdata->list_index;
+	pdata->queued = true;
 }
 
 /* perf measurement windows size 2^x */
@@ -154,27 +153,20 @@ static inline enum task_state do_task_run(struct task *task)
  */
 
 /*
- * struct task::start and struct ll_schedule_domain::next are parts of the
- * original LL scheduler design, they aren't needed in this Zephyr-only
- * implementation and will be removed after an initial upstreaming.
+ * Runs the tasks of one queue list, called with the lock held. We have to
+ * traverse the list manually, because we drop the lock while executing
+ * tasks, at that time tasks can be removed from or added to the list.
  */
-static void zephyr_ll_run(void *data)
+static void zephyr_ll_run_list(struct zephyr_ll *sch, struct list_item *head,
+			       uint32_t *flags)
 {
-	struct zephyr_ll *sch = data;
+	struct list_item *list = head->next;
 	struct task *task;
-	struct list_item *list;
-	uint32_t flags;
-
-	zephyr_ll_lock(sch, &flags);
-
-	/*
-	 * We have to traverse the list manually, because we drop the lock while
-	 * executing tasks, at that time tasks can be removed from or added to
-	 * the list.
-	 */
-	list = sch->tasks.next;
+#if CONFIG_SCHEDULE_LL_STATS
+	uint32_t cycles0;
+#endif
 
-	while (list != &sch->tasks) {
+	while (list != head) {
 		enum task_state state;
 		struct zephyr_ll_pdata *pdata;
 
@@ -190,13 +182,19 @@ static void zephyr_ll_run(void *data)
 		pdata->run = true;
 		task->state = SOF_TASK_STATE_RUNNING;
 
-		zephyr_ll_unlock(sch, &flags);
+		zephyr_ll_unlock(sch, flags);
 
+#if CONFIG_SCHEDULE_LL_STATS
+		cycles0 = (uint32_t)sof_cycle_get_64();
+#endif
 		/*
 		 * task's .run() should only return either
 		 * SOF_TASK_STATE_COMPLETED or SOF_TASK_STATE_RESCHEDULE
 		 */
 		state = do_task_run(task);
+#if CONFIG_SCHEDULE_LL_STATS
+		ll_stats_task_run(&sch->stats, task, (uint32_t)sof_cycle_get_64() - cycles0);
+#endif
 		if (state != SOF_TASK_STATE_COMPLETED &&
 		    state != SOF_TASK_STATE_RESCHEDULE) {
 			tr_err(&ll_tr,
@@ -205,7 +203,7 @@ static void zephyr_ll_run(void *data)
 			state = SOF_TASK_STATE_RESCHEDULE;
 		}
 
-		zephyr_ll_lock(sch, &flags);
+		zephyr_ll_lock(sch, flags);
 
 		/*
 		 * The .next pointer could've been changed while the lock wasn't
@@ -237,11 +235,63 @@ static void zephyr_ll_run(void *data)
 			}
 		}
 	}
+}
+
+#if CONFIG_SCHEDULE_LL_STATS
+static void zephyr_ll_stats_tick(struct zephyr_ll *sch, uint64_t start)
+{
+	struct list_item *list;
+	uint32_t flags;
+	int index;
+
+	if (!ll_stats_tick(&sch->stats, start, sof_cycle_get_64()))
+		return;
+
+	zephyr_ll_lock(sch, &flags);
+
+	ll_task_queue_for_each(&sch->queue, index, list)
+		ll_stats_publish_task(&sch->stats, container_of(list, struct task, list));
+
+	zephyr_ll_unlock(sch, &flags);
+
+	ll_stats_publish(&sch->stats);
+}
+#endif
+
+/*
+ * struct task::start and struct ll_schedule_domain::next are parts of the
+ * original LL scheduler design, they aren't needed in this Zephyr-only
+ * implementation and will be removed after an initial upstreaming.
+ */
+static void zephyr_ll_run(void *data)
+{
+	struct zephyr_ll *sch = data;
+	uint32_t flags;
+	int index;
+#if CONFIG_SCHEDULE_LL_STATS
+	uint64_t tick_start = sof_cycle_get_64();
+#endif
+
+	zephyr_ll_lock(sch, &flags);
+
+	/*
+	 * Lists are run from the highest priority one. The next non-empty
+	 * list is looked up when the previous one is done, tasks added to it
+	 * meanwhile run in this tick too.
+	 */
+	for (index = ll_task_queue_next_list(&sch->queue, -1);
+	     index < LL_TASK_QUEUE_LISTS;
+	     index = ll_task_queue_next_list(&sch->queue, index))
+		zephyr_ll_run_list(sch, &sch->queue.lists[index], &flags);
 
 	zephyr_ll_unlock(sch, &flags);
 
 	notifier_event(sch, NOTIFIER_ID_LL_POST_RUN,
 		       NOTIFIER_TARGET_CORE_LOCAL, NULL, 0);
+
+#if CONFIG_SCHEDULE_LL_STATS
+	zephyr_ll_stats_tick(sch, tick_start);
+#endif
 }
 
 /*
@@ -257,8 +307,6 @@ static int zephyr_ll_task_schedule_common(struct zephyr_ll *sch, struct task *ta
 					  struct task *reference, bool before)
 {
 	struct zephyr_ll_pdata *pdata;
-	struct task *task_iter;
-	struct list_item *list;
 	uint32_t flags;
 	int ret;
 
@@ -281,24 +329,16 @@ static int zephyr_ll_task_schedule_common(struct zephyr_ll *sch, struct task *ta
 		return -EDEADLK;
 	}
 
-	/* check if the task is already scheduled */
-	list_for_item(list, &sch->tasks) {
-		task_iter = container_of(list, struct task, list);
-
-		if (task_iter == task) {
-			/* if cancelled, reschedule the task */
-			if (task->state == SOF_TASK_STATE_CANCEL)
-				break;
-
-			/*
-			 * keep original start. TODO: this shouldn't be happening.
-			 * Remove after verification
-			 */
-			zephyr_ll_unlock(sch, &flags);
-			tr_warn(&ll_tr, "task %p (%pU) already scheduled",
-				task, task->uid);
-			return 0;
-		}
+	/* check if the task is already scheduled, if cancelled, reschedule it */
+	if (pdata->queued && task->state != SOF_TASK_STATE_CANCEL) {
+		/*
+		 * keep original start. TODO: this shouldn't be happening.
+		 * Remove after verification
+		 */
+		zephyr_ll_unlock(sch, &flags);
+		tr_warn(&ll_tr, "task %p (%pU) already scheduled",
+			task, task->uid);
+		return 0;
 	}
 
 	if (task->state == SOF_TASK_STATE_CANCEL) {
@@ -310,10 +350,8 @@ static int zephyr_ll_task_schedule_common(struct zephyr_ll *sch, struct task *ta
 
 	if (!reference)
 		zephyr_ll_task_insert_unlocked(sch, task);
-	else if (before)
-		zephyr_ll_task_insert_before_unlocked(task, reference);
 	else
-		zephyr_ll_task_insert_after_unlocked(task, reference);
+		zephyr_ll_task_insert_next_to_unlocked(sch, task, reference, before);
 
 	sch->n_tasks++;
 
@@ -504,10 +542,13 @@ int zephyr_ll_scheduler_init(struct ll_schedule_domain *domain)
 
 	/* initialize per-core scheduler private data */
 	sch = rmalloc(SOF_MEM_ZONE_SYS, 0, SOF_MEM_CAPS_RAM, sizeof(*sch));
-	list_init(&sch->tasks);
+	ll_task_queue_init(&sch->queue);
 	sch->ll_domain = domain;
 	sch->core = cpu_get_id();
 	sch->n_tasks = 0;
+#if CONFIG_SCHEDULE_LL_STATS
+	ll_stats_init(&sch->stats, sch->core);
+#endif
 
 	scheduler_init(domain->type, &zephyr_ll_ops, sch);
 
@@ -0,0 +1,22 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __TEST_ASRC_FARROW_REF_H__
+#define __TEST_ASRC_FARROW_REF_H__
+
+#include <sof/audio/asrc/asrc_farrow.h>
+#include <stdint.h>
+
+/* The generic version is built with these names for the comparison */
+void asrc_fir_filter16_ref(struct asrc_farrow *src_obj, int16_t **output_buffers,
+			   int index_output_frame);
+void asrc_fir_filter32_ref(struct asrc_farrow *src_obj, int32_t **output_buffers,
+			   int index_output_frame);
+void asrc_calc_impulse_response_n4_ref(struct asrc_farrow *src_obj);
+void asrc_calc_impulse_response_n5_ref(struct asrc_farrow *src_obj);
+void asrc_calc_impulse_response_n6_ref(struct asrc_farrow *src_obj);
+void asrc_calc_impulse_response_n7_ref(struct asrc_farrow *src_obj);
+
+#endif /* __TEST_ASRC_FARROW_REF_H__ */
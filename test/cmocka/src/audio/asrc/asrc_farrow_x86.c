@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <string.h>
+#include <cmocka.h>
+#include <sof/audio/asrc/asrc_farrow.h>
+#include "asrc_farrow_ref.h"
+
+#define CONVERT_COEFF(x) ((int32_t)(x))
+#include <sof/audio/coefficients/asrc/asrc_farrow_coeff_44100Hz_to_48000Hz.h>
+#include <sof/audio/coefficients/asrc/asrc_farrow_coeff_48000Hz_to_08000Hz.h>
+#include <sof/audio/coefficients/asrc/asrc_farrow_coeff_48000Hz_to_24000Hz.h>
+#include <sof/audio/coefficients/asrc/asrc_farrow_coeff_48000Hz_to_32000Hz.h>
+
+#define TEST_CHANNELS		8
+#define TEST_FRAMES		4
+#define TEST_TIMES		32
+#define TEST_RANDOM_TAPS	(7 * ASRC_MAX_FILTER_LENGTH)
+
+struct test_filter {
+	const int32_t *coefs;
+	int filter_length;
+	int num_filters;
+};
+
+struct test_asrc {
+	struct asrc_farrow obj;
+	int32_t impulse_response[ASRC_MAX_FILTER_LENGTH];
+};
+
+static struct test_asrc asrc_ref;
+static struct test_asrc asrc_x86;
+static int32_t ring32[TEST_CHANNELS][2 * ASRC_MAX_FILTER_LENGTH];
+static int16_t ring16[TEST_CHANNELS][2 * ASRC_MAX_FILTER_LENGTH];
+static int32_t *ring32_p[TEST_CHANNELS];
+static int16_t *ring16_p[TEST_CHANNELS];
+static int32_t random_coefs[TEST_RANDOM_TAPS];
+
+static uint32_t rand_state = 1;
+
+static int32_t test_rand(void)
+{
+	rand_state = rand_state * 1664525 + 1013904223;
+	return (int32_t)rand_state;
+}
+
+static void test_asrc_init(struct test_asrc *t, const struct test_filter *f, int nch,
+			   enum asrc_io_format output_format)
+{
+	memset(t, 0, sizeof(*t));
+	t->obj.num_channels = nch;
+	t->obj.filter_length = f->filter_length;
+	t->obj.num_filters = f->num_filters;
+	t->obj.buffer_length = 2 * f->filter_length;
+	t->obj.polyphase_filters = f->coefs;
+	t->obj.impulse_response = t->impulse_response;
+	t->obj.ring_buffers32 = ring32_p;
+	t->obj.ring_buffers16 = ring16_p;
+	t->obj.output_format = output_format;
+}
+
+static void test_calc_ir(struct test_asrc *ref, struct test_asrc *x86)
+{
+	switch (ref->obj.num_filters) {
+	case 4:
+		asrc_calc_impulse_response_n4_ref(&ref->obj);
+		asrc_calc_impulse_response_n4(&x86->obj);
+		break;
+	case 5:
+		asrc_calc_impulse_response_n5_ref(&ref->obj);
+		asrc_calc_impulse_response_n5(&x86->obj);
+		break;
+	case 6:
+		asrc_calc_impulse_response_n6_ref(&ref->obj);
+		asrc_calc_impulse_response_n6(&x86->obj);
+		break;
+	default:
+		asrc_calc_impulse_response_n7_ref(&ref->obj);
+		asrc_calc_impulse_response_n7(&x86->obj);
+		break;
+	}
+}
+
+/* Fills the ring buffers with both copies of the delay line as
+ * asrc_write_to_ring_buffer32() and asrc_write_to_ring_buffer16() do.
+ */
+static void test_fill_rings(int filter_length, bool full_scale)
+{
+	int ch;
+	int i;
+
+	for (ch = 0; ch < TEST_CHANNELS; ch++) {
+		for (i = 0; i < filter_length; i++) {
+			ring32[ch][i] = test_rand();
+			if (full_scale)
+				ring32[ch][i] = ring32[ch][i] < 0 ? INT32_MIN : INT32_MAX;
+			ring16[ch][i] = ring32[ch][i] >> 16;
+			ring32[ch][i + filter_length] = ring32[ch][i];
+			ring16[ch][i + filter_length] = ring16[ch][i];
+		}
+
+		ring32_p[ch] = ring32[ch];
+		ring16_p[ch] = ring16[ch];
+	}
+}
+
+static void test_farrow(const struct test_filter *f)
+{
+	int32_t out32_ref[TEST_CHANNELS][TEST_CHANNELS * TEST_FRAMES];
+	int32_t out32_x86[TEST_CHANNELS][TEST_CHANNELS * TEST_FRAMES];
+	int16_t out16_ref[TEST_CHANNELS][TEST_CHANNELS * TEST_FRAMES];
+	int16_t out16_x86[TEST_CHANNELS][TEST_CHANNELS * TEST_FRAMES];
+	int32_t *out32_ref_p[TEST_CHANNELS];
+	int32_t *out32_x86_p[TEST_CHANNELS];
+	int16_t *out16_ref_p[TEST_CHANNELS];
+	int16_t *out16_x86_p[TEST_CHANNELS];
+	enum asrc_io_format format;
+	int frame;
+	int nch;
+	int ch;
+	int n;
+
+	for (ch = 0; ch < TEST_CHANNELS; ch++) {
+		out32_ref_p[ch] = out32_ref[ch];
+		out32_x86_p[ch] = out32_x86[ch];
+		out16_ref_p[ch] = out16_ref[ch];
+		out16_x86_p[ch] = out16_x86[ch];
+	}
+
+	for (n = 0; n < TEST_TIMES; n++) {
+		nch = n % TEST_CHANNELS + 1;
+		format = n & 1 ? ASRC_IOF_INTERLEAVED : ASRC_IOF_DEINTERLEAVED;
+		test_asrc_init(&asrc_ref, f, nch, format);
+		test_asrc_init(&asrc_x86, f, nch, format);
+
+		/* Q5.27 time, the last ones saturate in the << 4 */
+		asrc_ref.obj.time_value = (uint32_t)test_rand() >> 5;
+		if (n == 0)
+			asrc_ref.obj.time_value = 0;
+		else if (n >= TEST_TIMES - 2)
+			asrc_ref.obj.time_value = (uint32_t)test_rand() | 1 << 27;
+		asrc_x86.obj.time_value = asrc_ref.obj.time_value;
+
+		test_calc_ir(&asrc_ref, &asrc_x86);
+		assert_memory_equal(asrc_ref.impulse_response, asrc_x86.impulse_response,
+				    f->filter_length * sizeof(int32_t));
+
+		memset(out32_ref, 0, sizeof(out32_ref));
+		memset(out32_x86, 0, sizeof(out32_x86));
+		memset(out16_ref, 0, sizeof(out16_ref));
+		memset(out16_x86, 0, sizeof(out16_x86));
+		test_fill_rings(f->filter_length, n == TEST_TIMES - 1);
+		for (frame = 0; frame < TEST_FRAMES; frame++) {
+			/* any write position of the upper half */
+			asrc_ref.obj.buffer_write_position = f->filter_length +
+				(uint32_t)test_rand() % f->filter_length;
+			asrc_x86.obj.buffer_write_position = asrc_ref.obj.buffer_write_position;
+
+			asrc_fir_filter32_ref(&asrc_ref.obj, out32_ref_p, frame);
+			asrc_fir_filter32(&asrc_x86.obj, out32_x86_p, frame);
+			asrc_fir_filter16_ref(&asrc_ref.obj, out16_ref_p, frame);
+			asrc_fir_filter16(&asrc_x86.obj, out16_x86_p, frame);
+		}
+
+		assert_memory_equal(out32_ref, out32_x86, sizeof(out32_ref));
+		assert_memory_equal(out16_ref, out16_x86, sizeof(out16_ref));
+	}
+}
+
+static void test_audio_asrc_farrow_x86_44100_48000(void **state)
+{
+	const struct test_filter f = { coeff44100to48000, 64, 7 };
+
+	(void)state;
+
+	test_farrow(&f);
+}
+
+static void test_audio_asrc_farrow_x86_48000_08000(void **state)
+{
+	const struct test_filter f = { coeff48000to08000, 128, 4 };
+
+	(void)state;
+
+	test_farrow(&f);
+}
+
+static void test_audio_asrc_farrow_x86_48000_24000(void **state)
+{
+	const struct test_filter f = { coeff48000to24000, 80, 5 };
+
+	(void)state;
+
+	test_farrow(&f);
+}
+
+static void test_audio_asrc_farrow_x86_48000_32000(void **state)
+{
+	const struct test_filter f = { coeff48000to32000, 80, 6 };
+
+	(void)state;
+
+	test_farrow(&f);
+}
+
+/* Full scale random coefficients saturate the polynomials and the lengths
+ * leave partial vectors in both the impulse response and the FIR.
+ */
+static void test_audio_asrc_farrow_x86_random(void **state)
+{
+	struct test_filter f = { random_coefs };
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < TEST_RANDOM_TAPS; i++)
+		random_coefs[i] = test_rand();
+
+	for (f.num_filters = 4; f.num_filters <= 7; f.num_filters++) {
+		for (f.filter_length = 2; f.filter_length <= 22; f.filter_length += 2)
+			test_farrow(&f);
+	}
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_asrc_farrow_x86_44100_48000),
+		cmocka_unit_test(test_audio_asrc_farrow_x86_48000_08000),
+		cmocka_unit_test(test_audio_asrc_farrow_x86_48000_24000),
+		cmocka_unit_test(test_audio_asrc_farrow_x86_48000_32000),
+		cmocka_unit_test(test_audio_asrc_farrow_x86_random),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/lib/notifier.h>
+#include <sof/ipc/driver.h>
+#include <sof/ipc/msg.h>
+#include <sof/ipc/topology.h>
+#include <sof/ipc/schedule.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cmocka.h>
+
+/* Buffer produce and consume notifications with the real notifier */
+
+#define TEST_BUFFERS		32
+#define TEST_LISTENERS		16
+#define TEST_BENCH_UPDATES	200000
+
+static struct notify *test_notify;
+
+struct notify **arch_notify_get(void)
+{
+	return &test_notify;
+}
+
+struct test_listener {
+	int produce_count;
+	int consume_count;
+	int free_count;
+	uint32_t bytes;
+};
+
+static void test_listener_cb(void *arg, enum notify_id type, void *data)
+{
+	struct test_listener *listener = arg;
+	struct buffer_cb_transact *transact = data;
+
+	switch (type) {
+	case NOTIFIER_ID_BUFFER_PRODUCE:
+		listener->produce_count++;
+		listener->bytes += transact->transaction_amount;
+		break;
+	case NOTIFIER_ID_BUFFER_CONSUME:
+		listener->consume_count++;
+		listener->bytes += transact->transaction_amount;
+		break;
+	case NOTIFIER_ID_BUFFER_FREE:
+		listener->free_count++;
+		break;
+	default:
+		break;
+	}
+}
+
+static int setup(void **state)
+{
+	int i;
+
+	(void)state;
+
+	test_notify = calloc(1, sizeof(*test_notify));
+	if (!test_notify)
+		return -1;
+
+	for (i = NOTIFIER_ID_CPU_FREQ; i < NOTIFIER_ID_COUNT; i++)
+		list_init(&test_notify->list[i]);
+
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = NOTIFIER_ID_CPU_FREQ; i < NOTIFIER_ID_COUNT; i++) {
+		assert_int_equal(test_notify->num_handles[i], 0);
+		free(test_notify->caller_list[i]);
+	}
+
+	free(test_notify);
+	test_notify = NULL;
+	return 0;
+}
+
+static struct comp_buffer *test_buffer_new(void)
+{
+	struct sof_ipc_buffer desc = {
+		.size = 256
+	};
+	struct comp_buffer *buf = buffer_new(&desc);
+
+	assert_non_null(buf);
+	return buf;
+}
+
+static void test_audio_buffer_notify_caller(void **state)
+{
+	struct comp_buffer *buf[TEST_BUFFERS];
+	struct test_listener listener[TEST_BUFFERS];
+	struct test_listener all;
+	int i;
+
+	(void)state;
+
+	memset(listener, 0, sizeof(listener));
+	memset(&all, 0, sizeof(all));
+
+	for (i = 0; i < TEST_BUFFERS; i++) {
+		buf[i] = test_buffer_new();
+		assert_int_equal(notifier_register(&listener[i], buf[i],
+						   NOTIFIER_ID_BUFFER_PRODUCE,
+						   test_listener_cb, 0), 0);
+		assert_int_equal(notifier_register(&listener[i], buf[i], NOTIFIER_ID_BUFFER_FREE,
+						   test_listener_cb, 0), 0);
+	}
+
+	assert_int_equal(notifier_register(&all, NULL, NOTIFIER_ID_BUFFER_PRODUCE,
+					   test_listener_cb, 0), 0);
+
+	/* each buffer reaches its own listener and the one without caller */
+	for (i = 0; i < TEST_BUFFERS; i++)
+		comp_update_buffer_produce(buf[i], i + 1);
+
+	for (i = 0; i < TEST_BUFFERS; i++) {
+		assert_int_equal(listener[i].produce_count, 1);
+		assert_int_equal(listener[i].bytes, i + 1);
+	}
+
+	assert_int_equal(all.produce_count, TEST_BUFFERS);
+
+	/* no listeners for consume */
+	comp_update_buffer_consume(buf[0], 1);
+	assert_int_equal(listener[0].consume_count, 0);
+
+	/* an event without caller goes to all listeners of the type */
+	notifier_event(NULL, NOTIFIER_ID_BUFFER_PRODUCE, NOTIFIER_TARGET_CORE_LOCAL,
+		       &(struct buffer_cb_transact){ .transaction_amount = 0 },
+		       sizeof(struct buffer_cb_transact));
+	for (i = 0; i < TEST_BUFFERS; i++)
+		assert_int_equal(listener[i].produce_count, 2);
+
+	assert_int_equal(all.produce_count, TEST_BUFFERS + 1);
+
+	/* unregistered listener of buffer 1 does not get events */
+	notifier_unregister(NULL, buf[1], NOTIFIER_ID_BUFFER_PRODUCE);
+	comp_update_buffer_produce(buf[1], 1);
+	comp_update_buffer_produce(buf[2], 1);
+	assert_int_equal(listener[1].produce_count, 2);
+	assert_int_equal(listener[2].produce_count, 3);
+
+	notifier_unregister(&all, NULL, NOTIFIER_ID_BUFFER_PRODUCE);
+	comp_update_buffer_produce(buf[2], 1);
+	assert_int_equal(all.produce_count, TEST_BUFFERS + 3);
+
+	/* free notifies its own listener and drops its registrations */
+	for (i = 0; i < TEST_BUFFERS; i++) {
+		buffer_free(buf[i]);
+		assert_int_equal(listener[i].free_count, 1);
+	}
+}
+
+static double bench_ns(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static double test_produce_ns(struct comp_buffer *buf)
+{
+	struct timespec start, end;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < TEST_BENCH_UPDATES; i++) {
+		comp_update_buffer_produce(buf, 4);
+		comp_update_buffer_consume(buf, 4);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return bench_ns(&start, &end) / TEST_BENCH_UPDATES;
+}
+
+/* Informative only, produce and consume of a buffer without listeners
+ * and with listeners on other buffers, like probes on a few buffers of a
+ * topology.
+ */
+static void test_audio_buffer_notify_bench(void **state)
+{
+	struct comp_buffer *buf[TEST_BUFFERS];
+	struct test_listener listener[TEST_LISTENERS];
+	double idle_ns, others_ns, own_ns;
+	int i;
+
+	(void)state;
+
+	memset(listener, 0, sizeof(listener));
+
+	for (i = 0; i < TEST_BUFFERS; i++)
+		buf[i] = test_buffer_new();
+
+	idle_ns = test_produce_ns(buf[TEST_BUFFERS - 1]);
+
+	for (i = 0; i < TEST_LISTENERS; i++) {
+		notifier_register(&listener[i], buf[i], NOTIFIER_ID_BUFFER_PRODUCE,
+				  test_listener_cb, 0);
+		notifier_register(&listener[i], buf[i], NOTIFIER_ID_BUFFER_FREE,
+				  test_listener_cb, 0);
+	}
+
+	others_ns = test_produce_ns(buf[TEST_BUFFERS - 1]);
+	own_ns = test_produce_ns(buf[0]);
+	assert_int_equal(listener[0].produce_count, TEST_BENCH_UPDATES);
+
+	printf("produce + consume: no listeners %.1f ns, ", idle_ns);
+	printf("%d listeners on other buffers %.1f ns, ", TEST_LISTENERS, others_ns);
+	printf("own listener %.1f ns\n", own_ns);
+
+	for (i = 0; i < TEST_BUFFERS; i++)
+		buffer_free(buf[i]);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_audio_buffer_notify_caller, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_buffer_notify_bench, setup, teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
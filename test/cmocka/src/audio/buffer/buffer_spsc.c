@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <cmocka.h>
+
+/* not a power of two so that positions wrap at odd places */
+#define SPSC_BUFFER_WORDS	97
+#define SPSC_STRESS_WORDS	(1024 * 1024)
+
+struct spsc_stress {
+	struct comp_buffer *buffer;
+	uint32_t errors;
+};
+
+static struct comp_buffer *spsc_buffer_new(uint32_t size)
+{
+	struct sof_ipc_buffer desc = {
+		.size = size,
+	};
+	struct comp_buffer *buf = buffer_new(&desc);
+
+	assert_non_null(buf);
+	assert_int_equal(buffer_set_spsc(buf), 0);
+	assert_non_null(buf->stream.spsc);
+
+	return buf;
+}
+
+static void test_audio_buffer_spsc_full_and_empty(void **state)
+{
+	struct comp_buffer *buf = spsc_buffer_new(40);
+
+	(void)state;
+
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 0);
+	assert_int_equal(audio_stream_get_free_bytes(&buf->stream), 40);
+
+	comp_update_buffer_produce(buf, 40);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 40);
+	assert_int_equal(audio_stream_get_free_bytes(&buf->stream), 0);
+	assert_ptr_equal(buf->stream.w_ptr, buf->stream.r_ptr);
+
+	comp_update_buffer_consume(buf, 30);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 10);
+
+	/* write position wraps past the read position */
+	comp_update_buffer_produce(buf, 25);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 35);
+	assert_int_equal(audio_stream_get_free_bytes(&buf->stream), 5);
+
+	comp_update_buffer_consume(buf, 35);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 0);
+	assert_int_equal(audio_stream_get_free_bytes(&buf->stream), 40);
+	assert_ptr_equal(buf->stream.w_ptr, buf->stream.r_ptr);
+
+	buffer_reset_pos(buf, NULL);
+	assert_int_equal(buf->stream.spsc->w_pos, 0);
+	assert_int_equal(buf->stream.spsc->r_pos, 0);
+
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_spsc_keeps_stream_state(void **state)
+{
+	struct sof_ipc_buffer desc = {
+		.size = 40,
+	};
+	struct comp_buffer *buf = buffer_new(&desc);
+
+	(void)state;
+
+	assert_non_null(buf);
+	comp_update_buffer_produce(buf, 32);
+	comp_update_buffer_consume(buf, 20);
+
+	assert_int_equal(buffer_set_spsc(buf), 0);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 12);
+	assert_int_equal(audio_stream_get_free_bytes(&buf->stream), 28);
+
+	comp_update_buffer_produce(buf, 28);
+	assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 40);
+
+	buffer_free(buf);
+}
+
+static void *spsc_producer(void *arg)
+{
+	struct spsc_stress *st = arg;
+	struct comp_buffer __sparse_cache *buf_c;
+	uint32_t value = 0;
+	uint32_t *ptr;
+	uint32_t words;
+	uint32_t i;
+
+	while (value < SPSC_STRESS_WORDS) {
+		buf_c = buffer_acquire(st->buffer);
+
+		/* vary the chunk size to hit all wrap positions */
+		words = MIN(audio_stream_get_free_bytes(&buf_c->stream) / sizeof(uint32_t),
+			    value % 13 + 1);
+		words = MIN(words, SPSC_STRESS_WORDS - value);
+
+		ptr = buf_c->stream.w_ptr;
+		for (i = 0; i < words; i++) {
+			*ptr = value++;
+			ptr = audio_stream_wrap(&buf_c->stream, ptr + 1);
+		}
+
+		comp_update_buffer_produce(buf_c, words * sizeof(uint32_t));
+		buffer_release(buf_c);
+
+		/* let the consumer run if the host has a single cpu */
+		if (!words)
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+static void *spsc_consumer(void *arg)
+{
+	struct spsc_stress *st = arg;
+	struct comp_buffer __sparse_cache *buf_c;
+	uint32_t value = 0;
+	uint32_t *ptr;
+	uint32_t words;
+	uint32_t i;
+
+	while (value < SPSC_STRESS_WORDS) {
+		buf_c = buffer_acquire(st->buffer);
+
+		words = MIN(audio_stream_get_avail_bytes(&buf_c->stream) / sizeof(uint32_t),
+			    value % 7 + 1);
+
+		ptr = buf_c->stream.r_ptr;
+		for (i = 0; i < words; i++) {
+			if (*ptr != value++)
+				st->errors++;
+			ptr = audio_stream_wrap(&buf_c->stream, ptr + 1);
+		}
+
+		comp_update_buffer_consume(buf_c, words * sizeof(uint32_t));
+		buffer_release(buf_c);
+
+		if (!words)
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+static void test_audio_buffer_spsc_two_thread_stress(void **state)
+{
+	struct spsc_stress st = {
+		.buffer = spsc_buffer_new(SPSC_BUFFER_WORDS * sizeof(uint32_t)),
+	};
+	pthread_t producer;
+	pthread_t consumer;
+
+	(void)state;
+
+	assert_int_equal(pthread_create(&consumer, NULL, spsc_consumer, &st), 0);
+	assert_int_equal(pthread_create(&producer, NULL, spsc_producer, &st), 0);
+	assert_int_equal(pthread_join(producer, NULL), 0);
+	assert_int_equal(pthread_join(consumer, NULL), 0);
+
+	assert_int_equal(st.errors, 0);
+	assert_int_equal(audio_stream_get_avail_bytes(&st.buffer->stream), 0);
+
+	buffer_free(st.buffer);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_buffer_spsc_full_and_empty),
+		cmocka_unit_test(test_audio_buffer_spsc_keeps_stream_state),
+		cmocka_unit_test(test_audio_buffer_spsc_two_thread_stress),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
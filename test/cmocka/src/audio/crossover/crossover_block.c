@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * The crossover processes the period in blocks through all the LR4 filters.
+ * The band outputs are compared with the filters run one sample at a time,
+ * for all formats, channel counts and numbers of sinks, with period sizes
+ * that split the blocks at different frames.
+ */
+
+#include <sof/audio/component.h>
+#include <sof/audio/crossover/crossover.h>
+#include <sof/audio/format.h>
+#include <sof/math/iir_df2t.h>
+#include <user/eq.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#define TEST_FRAMES		480
+#define TEST_MAX_CHANNELS	PLATFORM_MAX_CHANNELS
+
+/* Butterworth lowpass and highpass pairs of the LR4 filters at 48 kHz */
+static const struct sof_eq_iir_biquad test_coef[] = {
+	/* 300 Hz */
+	{ -1015736075, 2087866987, 402728, 805456, 402728, 0, 16384 },
+	{ -1015736075, 2087866987, 1044336221, -2088672443, 1044336221, 0, 16384 },
+	/* 2000 Hz */
+	{ -741524947, 1753413056, 15463429, 30926858, 15463429, 0, 16384 },
+	{ -741524947, 1753413056, 892169957, -1784339914, 892169957, 0, 16384 },
+	/* 8000 Hz */
+	{ -258136345, 665939085, 166484771, 332969542, 166484771, 0, 16384 },
+	{ -258136345, 665939085, 499454314, -998908627, 499454314, 0, 16384 },
+};
+
+struct test_lr4 {
+	int32_t coef[2 * SOF_EQ_IIR_NBIQUAD];
+	int64_t delay[CROSSOVER_NUM_DELAYS_LR4];
+};
+
+/* filters of the component and of the reference */
+static struct test_lr4 test_lr4[2][TEST_MAX_CHANNELS][2][CROSSOVER_MAX_LR4];
+static struct crossover_state test_ref_state[TEST_MAX_CHANNELS];
+static struct comp_data test_cd;
+
+static int32_t test_in[TEST_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_ref[CROSSOVER_4WAY_NUM_SINKS][TEST_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_out[CROSSOVER_4WAY_NUM_SINKS][TEST_FRAMES * TEST_MAX_CHANNELS];
+
+/* drivers of the pass through functions, not used */
+int audio_stream_copy(const struct audio_stream __sparse_cache *source, uint32_t ioffset,
+		      struct audio_stream __sparse_cache *sink, uint32_t ooffset, uint32_t samples)
+{
+	fail();
+	return 0;
+}
+
+static void test_init_lr4(struct iir_state_df2t *iir, struct test_lr4 *lr4,
+			  const struct sof_eq_iir_biquad *coef)
+{
+	*(struct sof_eq_iir_biquad *)lr4->coef = *coef;
+	*(struct sof_eq_iir_biquad *)(lr4->coef + SOF_EQ_IIR_NBIQUAD) = *coef;
+	memset(lr4->delay, 0, sizeof(lr4->delay));
+	iir->coef = lr4->coef;
+	iir->delay = lr4->delay;
+	iir->biquads = 2;
+	iir->biquads_in_series = 2;
+}
+
+static void test_init_state(struct crossover_state state[], int k, int nch)
+{
+	int ch;
+	int i;
+
+	for (ch = 0; ch < nch; ch++)
+		for (i = 0; i < CROSSOVER_MAX_LR4; i++) {
+			test_init_lr4(&state[ch].lowpass[i], &test_lr4[k][ch][0][i],
+				      &test_coef[2 * i]);
+			test_init_lr4(&state[ch].highpass[i], &test_lr4[k][ch][1][i],
+				      &test_coef[2 * i + 1]);
+		}
+}
+
+/* the reference splits one sample at a time as the diagrams in crossover.h */
+static void test_ref_split(struct crossover_state *s, int num_sinks, int32_t x, int32_t y[])
+{
+	int32_t z1;
+	int32_t z2;
+
+	switch (num_sinks) {
+	case CROSSOVER_2WAY_NUM_SINKS:
+		y[0] = iir_df2t(&s->lowpass[0], x);
+		y[1] = iir_df2t(&s->highpass[0], x);
+		break;
+	case CROSSOVER_3WAY_NUM_SINKS:
+		z1 = iir_df2t(&s->lowpass[0], x);
+		z2 = iir_df2t(&s->highpass[0], x);
+		y[0] = sat_int32((int64_t)iir_df2t(&s->lowpass[1], z1) +
+				 iir_df2t(&s->highpass[1], z1));
+		y[1] = iir_df2t(&s->lowpass[2], z2);
+		y[2] = iir_df2t(&s->highpass[2], z2);
+		break;
+	default:
+		z1 = iir_df2t(&s->lowpass[1], x);
+		z2 = iir_df2t(&s->highpass[1], x);
+		y[0] = iir_df2t(&s->lowpass[0], z1);
+		y[1] = iir_df2t(&s->highpass[0], z1);
+		y[2] = iir_df2t(&s->lowpass[2], z2);
+		y[3] = iir_df2t(&s->highpass[2], z2);
+		break;
+	}
+}
+
+/* converts a Q1.31 sample to the format as the component does */
+static int32_t test_to_fmt(enum sof_ipc_frame fmt, int32_t x)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return sat_int16(Q_SHIFT_RND(x, 31, 15));
+	case SOF_IPC_FRAME_S24_4LE:
+		return sat_int24(Q_SHIFT_RND(x, 31, 23));
+	default:
+		return x;
+	}
+}
+
+static int32_t test_from_fmt(enum sof_ipc_frame fmt, int32_t x)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return x << 16;
+	case SOF_IPC_FRAME_S24_4LE:
+		return x << 8;
+	default:
+		return x;
+	}
+}
+
+static void test_stream_init(struct audio_stream *stream, void *addr, size_t bytes,
+			     enum sof_ipc_frame fmt, int nch)
+{
+	memset(stream, 0, sizeof(*stream));
+	stream->addr = addr;
+	stream->end_addr = (char *)addr + bytes;
+	stream->size = bytes;
+	stream->r_ptr = addr;
+	stream->w_ptr = addr;
+	stream->channels = nch;
+	stream->frame_fmt = fmt;
+}
+
+static void test_crossover(enum sof_ipc_frame fmt, int nch, int num_sinks, int period)
+{
+	struct comp_buffer *sinks[CROSSOVER_4WAY_NUM_SINKS] = { NULL };
+	struct comp_buffer sink_buf[CROSSOVER_4WAY_NUM_SINKS];
+	struct comp_buffer source;
+	struct comp_dev dev;
+	const size_t sample_bytes = fmt == SOF_IPC_FRAME_S16_LE ? 2 : 4;
+	const int samples = TEST_FRAMES * nch;
+	int32_t y[CROSSOVER_4WAY_NUM_SINKS];
+	int32_t *block_buf;
+	int16_t *x16 = (int16_t *)test_in;
+	int16_t *y16;
+	int frames;
+	int i, j;
+
+	memset(&dev, 0, sizeof(dev));
+	memset(&test_cd, 0, sizeof(test_cd));
+	memset(test_out, 0, sizeof(test_out));
+	test_init_state(test_cd.state, 0, nch);
+	test_init_state(test_ref_state, 1, nch);
+
+	block_buf = malloc(num_sinks * CROSSOVER_BLOCK_FRAMES * nch * sizeof(int32_t));
+	assert_non_null(block_buf);
+	for (j = 0; j < num_sinks; j++)
+		test_cd.block_buf[j] = block_buf + j * CROSSOVER_BLOCK_FRAMES * nch;
+
+	test_cd.crossover_split_block = crossover_find_split_block_func(num_sinks);
+	test_cd.crossover_process = crossover_find_proc_func(fmt);
+	assert_non_null(test_cd.crossover_split_block);
+	assert_non_null(test_cd.crossover_process);
+	dev.priv_data = &test_cd;
+
+	/* full scale noise in the component format and the reference output */
+	for (i = 0; i < samples; i++) {
+		test_in[i] = test_to_fmt(fmt, (int32_t)rand() * 2 + (rand() & 1));
+		if (sample_bytes == 2)
+			x16[i] = test_in[i];
+	}
+
+	for (i = 0; i < samples; i++) {
+		test_ref_split(&test_ref_state[i % nch], num_sinks,
+			       test_from_fmt(fmt, sample_bytes == 2 ? x16[i] : test_in[i]), y);
+		for (j = 0; j < num_sinks; j++)
+			test_ref[j][i] = test_to_fmt(fmt, y[j]);
+	}
+
+	test_stream_init(&source.stream, test_in, samples * sample_bytes, fmt, nch);
+	for (j = 0; j < num_sinks; j++) {
+		test_stream_init(&sink_buf[j].stream, test_out[j], samples * sample_bytes,
+				 fmt, nch);
+		/* the second sink of four is not connected */
+		if (num_sinks != CROSSOVER_4WAY_NUM_SINKS || j != 1)
+			sinks[j] = &sink_buf[j];
+	}
+
+	for (i = 0; i < TEST_FRAMES; i += frames) {
+		frames = MIN(period, TEST_FRAMES - i);
+		test_cd.crossover_process(&dev, &source, sinks, num_sinks, frames);
+		source.stream.r_ptr = (char *)source.stream.r_ptr + frames * nch * sample_bytes;
+		for (j = 0; j < num_sinks; j++)
+			sink_buf[j].stream.w_ptr = (char *)sink_buf[j].stream.w_ptr +
+				frames * nch * sample_bytes;
+	}
+
+	for (j = 0; j < num_sinks; j++) {
+		if (!sinks[j])
+			continue;
+
+		for (i = 0; i < samples; i++) {
+			y16 = (int16_t *)test_out[j];
+			assert_int_equal(sample_bytes == 2 ? y16[i] : test_out[j][i],
+					 test_ref[j][i]);
+		}
+	}
+
+	free(block_buf);
+}
+
+static void test_crossover_block(void **state)
+{
+	const enum sof_ipc_frame fmts[] = {
+		SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE
+	};
+	const int periods[] = { 1, 37, 48, CROSSOVER_BLOCK_FRAMES, 100 };
+	int num_sinks;
+	int nch;
+	int f;
+	int p;
+
+	(void)state;
+
+	for (f = 0; f < ARRAY_SIZE(fmts); f++)
+		for (num_sinks = CROSSOVER_2WAY_NUM_SINKS;
+		     num_sinks <= CROSSOVER_4WAY_NUM_SINKS; num_sinks++)
+			for (nch = 1; nch <= TEST_MAX_CHANNELS; nch++)
+				for (p = 0; p < ARRAY_SIZE(periods); p++)
+					test_crossover(fmts[f], nch, num_sinks, periods[p]);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_crossover_block),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
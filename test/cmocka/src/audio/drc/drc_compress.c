@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * Compares drc_compress_output(), which computes the gains of a division
+ * before applying them to each channel block, with the per frame version it
+ * replaced. The output of the DRC must not change, so the outputs must be
+ * equal both for random envelopes and for a DRC run over noise bursts.
+ */
+
+#include <sof/audio/drc/drc.h>
+#include <sof/audio/drc/drc_algorithm.h>
+#include <sof/audio/drc/drc_math.h>
+#include <sof/audio/format.h>
+#include <sof/audio/audio_stream.h>
+#include <user/drc.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <cmocka.h>
+
+#define ONE_Q30			Q_CONVERT_FLOAT(1.0f, 30)
+#define TEST_MAX_CHANNELS	8
+#define TEST_FRAMES		CONFIG_DRC_MAX_PRE_DELAY_FRAMES
+#define TEST_DIVISIONS		4000
+
+/* -20 dB threshold, 10 dB knee, 4:1 ratio, 3 ms attack, 2.5 ms release */
+static const struct sof_drc_params test_params = {
+	.enabled = 1,
+	.db_threshold = -335544320,
+	.db_knee = 167772160,
+	.ratio = 67108864,
+	.linear_threshold = 107374182,
+	.slope = 268435456,
+	.K = 8978105,
+	.knee_alpha = 3637176,
+	.knee_beta = -4613030,
+	.knee_threshold = 5305422,
+	.ratio_base = 284157634,
+	.master_linear_gain = 37249824,
+	.one_over_attack_frames = 7456540,
+	.sat_release_frames_inv_neg = -8947849,
+	.sat_release_rate_at_neg_two_db = 2062296,
+	.kSpacingDb = 5,
+	.kA = 3932160,
+	.kB = 1070387,
+	.kC = 2215545,
+	.kD = 578867,
+	.kE = 67362,
+};
+
+struct test_drc {
+	struct drc_state state;
+	int32_t buf[TEST_MAX_CHANNELS][TEST_FRAMES];
+};
+
+static struct test_drc test_ref;
+static struct test_drc test_dut;
+static uint32_t test_seed = 1;
+
+/* drc_default_pass() isn't tested */
+int audio_stream_copy(const struct audio_stream __sparse_cache *source, uint32_t ioffset,
+		      struct audio_stream __sparse_cache *sink, uint32_t ooffset, uint32_t samples)
+{
+	fail();
+	return 0;
+}
+
+static int32_t test_rand(void)
+{
+	test_seed = test_seed * 1664525 + 1013904223;
+	return (int32_t)test_seed;
+}
+
+/* the previous version, the gain of each frame is applied to all channels */
+static void drc_compress_output_ref(struct drc_state *state,
+				    const struct sof_drc_params *p,
+				    int nbyte, int nch)
+{
+	const int div_start = state->pre_delay_read_index;
+	int is_release = state->envelope_rate >= ONE_Q30;
+	int32_t c, base, r, r2, r4; /* Q2.30 */
+	int32_t x[4]; /* Q2.30 */
+	int32_t total_gain; /* Q8.24 */
+	int16_t *sample16_p;
+	int32_t *sample32_p;
+	int i, j, ch;
+
+	if (!is_release) {
+		c = state->compressor_gain - state->scaled_desired_gain;
+		base = state->scaled_desired_gain;
+		r = ONE_Q30 - state->envelope_rate;
+	} else {
+		c = state->compressor_gain;
+		base = 0;
+		r = state->envelope_rate;
+	}
+
+	x[0] = Q_MULTSR_32X32((int64_t)c, r, 30, 30, 30);
+	for (j = 1; j < 4; j++)
+		x[j] = Q_MULTSR_32X32((int64_t)x[j - 1], r, 30, 30, 30);
+	r2 = Q_MULTSR_32X32((int64_t)r, r, 30, 30, 30);
+	r4 = Q_MULTSR_32X32((int64_t)r2, r2, 30, 30, 30);
+
+	for (i = 0; i < DRC_DIVISION_FRAMES; i += 4) {
+		if (i) {
+			for (j = 0; j < 4; j++) {
+				x[j] = Q_MULTSR_32X32((int64_t)x[j], r4, 30, 30, 30);
+				if (is_release)
+					x[j] = MIN(ONE_Q30, x[j]);
+			}
+		}
+
+		for (j = 0; j < 4; j++) {
+			total_gain = Q_MULTSR_32X32((int64_t)p->master_linear_gain,
+						    drc_sin_fixed(x[j] + base), 24, 31, 24);
+			for (ch = 0; ch < nch; ch++) {
+				if (nbyte == 2) {
+					sample16_p = (int16_t *)state->pre_delay_buffers[ch] +
+						div_start + i + j;
+					*sample16_p = sat_int16(Q_MULTSR_32X32((int64_t)*sample16_p,
+									       total_gain,
+									       15, 24, 15));
+				} else {
+					sample32_p = (int32_t *)state->pre_delay_buffers[ch] +
+						div_start + i + j;
+					*sample32_p = sat_int32(Q_MULTSR_32X32((int64_t)*sample32_p,
+									       total_gain,
+									       31, 24, 31));
+				}
+			}
+		}
+	}
+
+	state->compressor_gain = x[3] + base;
+}
+
+static void test_drc_init(struct test_drc *t, int nch)
+{
+	int ch;
+
+	memset(t, 0, sizeof(*t));
+	for (ch = 0; ch < nch; ch++)
+		t->state.pre_delay_buffers[ch] = (int8_t *)t->buf[ch];
+
+	t->state.compressor_gain = ONE_Q30;
+	t->state.pre_delay_write_index = DRC_DEFAULT_PRE_DELAY_FRAMES;
+	t->state.max_attack_compression_diff_db = INT32_MIN;
+}
+
+static void test_drc_assert_equal(const struct test_drc *ref, const struct test_drc *dut,
+				  int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		assert_memory_equal(ref->buf[ch], dut->buf[ch], sizeof(ref->buf[ch]));
+
+	assert_int_equal(ref->state.compressor_gain, dut->state.compressor_gain);
+}
+
+/* random envelopes in attack and release over random samples */
+static void test_drc_compress_random(void **state)
+{
+	int32_t rate;
+	int32_t gain;
+	int32_t desired;
+	int nbyte;
+	int nch;
+	int run;
+	int ch;
+	int i;
+
+	(void)state;
+
+	for (nbyte = 2; nbyte <= 4; nbyte += 2)
+		for (nch = 1; nch <= TEST_MAX_CHANNELS; nch++)
+			for (run = 0; run < 200; run++) {
+				test_drc_init(&test_ref, nch);
+				for (ch = 0; ch < nch; ch++)
+					for (i = 0; i < TEST_FRAMES; i++)
+						test_ref.buf[ch][i] = test_rand();
+
+				/* attack rates are below one, release rates up to 1.125
+				 * from gains that keep the warp input below one
+				 */
+				rate = test_rand() & (ONE_Q30 - 1);
+				gain = test_rand() & (ONE_Q30 - 1);
+				if (run & 1) {
+					rate = ONE_Q30 + (rate >> 3);
+					gain >>= 1;
+				}
+				desired = (uint32_t)test_rand() % ((uint32_t)gain + 1);
+				test_ref.state.envelope_rate = rate;
+				test_ref.state.compressor_gain = gain;
+				test_ref.state.scaled_desired_gain = desired;
+				test_ref.state.pre_delay_read_index =
+					(run * DRC_DIVISION_FRAMES) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
+
+				test_dut = test_ref;
+				for (ch = 0; ch < nch; ch++)
+					test_dut.state.pre_delay_buffers[ch] =
+						(int8_t *)test_dut.buf[ch];
+
+				drc_compress_output_ref(&test_ref.state, &test_params, nbyte, nch);
+				drc_compress_output(&test_dut.state, &test_params, nbyte, nch);
+				test_drc_assert_equal(&test_ref, &test_dut, nch);
+			}
+}
+
+/* writes the next input division, noise bursts with levels over 80 dB */
+static void test_drc_write_division(struct test_drc *t, int nbyte, int nch, int div)
+{
+	const int shift = (div / 50) % 14;
+	const int wp = t->state.pre_delay_write_index;
+	int32_t sample;
+	int ch;
+	int i;
+
+	for (i = 0; i < DRC_DIVISION_FRAMES; i++)
+		for (ch = 0; ch < nch; ch++) {
+			sample = test_rand() >> shift;
+			if (nbyte == 2)
+				((int16_t *)t->buf[ch])[wp + i] = sample >> 16;
+			else
+				t->buf[ch][wp + i] = sample;
+		}
+}
+
+/* runs the divisions as drc_process_one_division() does */
+static void test_drc_division(struct test_drc *t, int nbyte, int nch, bool ref)
+{
+	drc_update_detector_average(&t->state, &test_params, nbyte, nch);
+	drc_update_envelope(&t->state, &test_params);
+	if (ref)
+		drc_compress_output_ref(&t->state, &test_params, nbyte, nch);
+	else
+		drc_compress_output(&t->state, &test_params, nbyte, nch);
+
+	t->state.pre_delay_read_index = (t->state.pre_delay_read_index + DRC_DIVISION_FRAMES) &
+		DRC_MAX_PRE_DELAY_FRAMES_MASK;
+	t->state.pre_delay_write_index = (t->state.pre_delay_write_index + DRC_DIVISION_FRAMES) &
+		DRC_MAX_PRE_DELAY_FRAMES_MASK;
+}
+
+static void test_drc_compress_bursts(void **state)
+{
+	uint32_t seed;
+	int nbyte;
+	int nch;
+	int div;
+
+	(void)state;
+
+	for (nbyte = 2; nbyte <= 4; nbyte += 2)
+		for (nch = 1; nch <= 2; nch++) {
+			test_drc_init(&test_ref, nch);
+			test_drc_init(&test_dut, nch);
+			for (div = 0; div < TEST_DIVISIONS; div++) {
+				seed = test_seed;
+				test_drc_write_division(&test_ref, nbyte, nch, div);
+				test_seed = seed;
+				test_drc_write_division(&test_dut, nbyte, nch, div);
+
+				test_drc_division(&test_ref, nbyte, nch, true);
+				test_drc_division(&test_dut, nbyte, nch, false);
+				test_drc_assert_equal(&test_ref, &test_dut, nch);
+			}
+		}
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_drc_compress_random),
+		cmocka_unit_test(test_drc_compress_bursts),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
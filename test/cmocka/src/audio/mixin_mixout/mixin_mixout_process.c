@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <string.h>
+#include <cmocka.h>
+#include <ipc4/mixin_mixout.h>
+#include <rtos/string.h>
+
+/* The buffer lengths differ so the source and the sink wrap at different
+ * frames of the same call.
+ */
+#define TEST_SINK_FRAMES	24
+#define TEST_SOURCE_FRAMES	20
+#define TEST_MAX_CHANNELS	8
+#define TEST_MAX_FRAMES		16
+#define TEST_TIMES		256
+
+static int32_t sink_data[TEST_SINK_FRAMES * TEST_MAX_CHANNELS];
+static int32_t source_data[TEST_SOURCE_FRAMES * TEST_MAX_CHANNELS];
+static int32_t ref_data[TEST_SINK_FRAMES * TEST_MAX_CHANNELS];
+
+static const enum sof_ipc_frame test_formats[] = {
+	SOF_IPC_FRAME_S16_LE,
+	SOF_IPC_FRAME_S24_4LE,
+	SOF_IPC_FRAME_S32_LE,
+};
+
+static uint32_t rand_state = 1;
+
+static int32_t test_rand(void)
+{
+	rand_state = rand_state * 1664525 + 1013904223;
+	return (int32_t)rand_state;
+}
+
+static int test_rand_range(int n)
+{
+	return ((uint32_t)test_rand() >> 8) % n;
+}
+
+static int32_t test_get(const void *data, enum sof_ipc_frame fmt, int i)
+{
+	if (fmt == SOF_IPC_FRAME_S16_LE)
+		return ((const int16_t *)data)[i];
+
+	return ((const int32_t *)data)[i];
+}
+
+static void test_set(void *data, enum sof_ipc_frame fmt, int i, int32_t x)
+{
+	if (fmt == SOF_IPC_FRAME_S16_LE)
+		((int16_t *)data)[i] = x;
+	else
+		((int32_t *)data)[i] = x;
+}
+
+/* Mixed data is random full scale to saturate often */
+static void test_fill(void *data, enum sof_ipc_frame fmt, int samples)
+{
+	int i;
+
+	for (i = 0; i < samples; i++)
+		test_set(data, fmt, i, fmt == SOF_IPC_FRAME_S16_LE ? test_rand() >> 16 :
+			 test_rand());
+}
+
+/* The read or write pointer is placed to any frame. With the x86 version
+ * also to any sample, so frames are split by the wrap.
+ */
+static void test_stream_init(struct audio_stream *stream, void *data, int frames,
+			     int channels, enum sof_ipc_frame fmt, int *offset)
+{
+	int sample_bytes = get_sample_bytes(fmt);
+
+#ifdef MIXIN_MIXOUT_X86
+	*offset = test_rand_range(frames * channels);
+#else
+	*offset = test_rand_range(frames) * channels;
+#endif
+
+	memset(stream, 0, sizeof(*stream));
+	stream->addr = data;
+	stream->size = frames * channels * sample_bytes;
+	stream->end_addr = (uint8_t *)data + stream->size;
+	stream->r_ptr = (uint8_t *)data + *offset * sample_bytes;
+	stream->w_ptr = stream->r_ptr;
+	stream->channels = channels;
+	stream->frame_fmt = fmt;
+	stream->valid_sample_fmt = fmt;
+}
+
+static int32_t test_ref_normal(enum sof_ipc_frame fmt, int32_t dst, int32_t src, bool mix)
+{
+	if (!mix)
+		return src;
+
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return sat_int16(dst + src);
+	case SOF_IPC_FRAME_S24_4LE:
+		return sat_int24(sign_extend_s24(dst) + sign_extend_s24(src));
+	default:
+		return sat_int32((int64_t)dst + src);
+	}
+}
+
+static int32_t test_ref_remap(enum sof_ipc_frame fmt, int32_t dst, int32_t src, uint16_t gain,
+			      bool mix)
+{
+	int64_t q;
+
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		q = ((int32_t)src * gain) >> IPC4_MIXIN_GAIN_SHIFT;
+		return mix ? sat_int16(dst + q) : (int16_t)q;
+	case SOF_IPC_FRAME_S24_4LE:
+		q = (int32_t)(((int64_t)sign_extend_s24(src) * gain) >> IPC4_MIXIN_GAIN_SHIFT);
+		return mix ? sat_int24(sign_extend_s24(dst) + q) : (int32_t)q;
+	default:
+		q = ((int64_t)src * gain) >> IPC4_MIXIN_GAIN_SHIFT;
+		return mix ? sat_int32(dst + q) : (int32_t)q;
+	}
+}
+
+/* Remap mode as done by mix_and_remap() of mixin_mixout.c */
+static void test_remap(struct audio_stream *sink, int start_frame, int mixed_frames,
+		       struct audio_stream *source, int frame_count, uint32_t channel_map,
+		       uint16_t gain)
+{
+	remap_frames_func remap_frames = remap_frames_get_processing_function(sink->frame_fmt);
+	remap_mix_func remap = remap_mix_get_processing_function(sink->frame_fmt);
+	mute_func mute = mute_mix_get_processing_function(sink->frame_fmt);
+	int source_channel;
+	int i;
+
+	if (remap_frames) {
+		remap_frames(sink, start_frame, mixed_frames, source, frame_count, channel_map,
+			     gain);
+		return;
+	}
+
+	assert_non_null(remap);
+	assert_non_null(mute);
+	for (i = 0; i < sink->channels; i++) {
+		source_channel = (channel_map >> (i * 4)) & 0xf;
+		if (source_channel == 0xf)
+			mute(sink, i, start_frame, mixed_frames, frame_count);
+		else
+			remap(sink, i, sink->channels, start_frame, mixed_frames, source,
+			      source_channel, source->channels, frame_count, gain);
+	}
+}
+
+static void test_mix(enum sof_ipc_frame fmt, bool remap_mode)
+{
+	struct audio_stream sink;
+	struct audio_stream source;
+	normal_mix_func normal = normal_mix_get_processing_function(fmt);
+	uint32_t channel_map;
+	uint16_t gain;
+	int sink_samples;
+	int source_samples;
+	int sink_offset;
+	int source_offset;
+	int sink_channels;
+	int source_channels;
+	int start_frame;
+	int mixed_frames;
+	int frame_count;
+	int source_channel;
+	int n, f, ch;
+	int d, s;
+
+	assert_non_null(normal);
+
+	for (n = 0; n < TEST_TIMES; n++) {
+		sink_channels = test_rand_range(TEST_MAX_CHANNELS) + 1;
+		source_channels = remap_mode ? test_rand_range(TEST_MAX_CHANNELS) + 1 :
+			sink_channels;
+		frame_count = test_rand_range(TEST_MAX_FRAMES) + 1;
+		start_frame = test_rand_range(4);
+		mixed_frames = start_frame + test_rand_range(frame_count + 2);
+
+		/* sink channels from any source channel, muted ones or unity gain */
+		channel_map = 0;
+		for (ch = TEST_MAX_CHANNELS - 1; ch >= 0; ch--) {
+			source_channel = test_rand_range(4) ? test_rand_range(source_channels) :
+				0xf;
+			channel_map = channel_map << 4 | source_channel;
+		}
+
+		gain = n & 1 ? IPC4_MIXIN_UNITY_GAIN : test_rand_range(IPC4_MIXIN_UNITY_GAIN + 1);
+
+		test_stream_init(&sink, sink_data, TEST_SINK_FRAMES, sink_channels, fmt,
+				 &sink_offset);
+		test_stream_init(&source, source_data, TEST_SOURCE_FRAMES, source_channels, fmt,
+				 &source_offset);
+		sink_samples = TEST_SINK_FRAMES * sink_channels;
+		source_samples = TEST_SOURCE_FRAMES * source_channels;
+		test_fill(sink_data, fmt, sink_samples);
+		test_fill(source_data, fmt, source_samples);
+		memcpy_s(ref_data, sizeof(ref_data), sink_data, sizeof(sink_data));
+
+		for (f = 0; f < frame_count; f++) {
+			for (ch = 0; ch < sink_channels; ch++) {
+				d = (sink_offset + (start_frame + f) * sink_channels + ch) %
+					sink_samples;
+				source_channel = remap_mode ? (channel_map >> (ch * 4)) & 0xf : ch;
+				if (source_channel == 0xf) {
+					/* muted, cleared when not mixed yet */
+					if (start_frame + f >= mixed_frames)
+						test_set(ref_data, fmt, d, 0);
+					continue;
+				}
+
+				s = (source_offset + f * source_channels + source_channel) %
+					source_samples;
+				if (remap_mode)
+					test_set(ref_data, fmt, d,
+						 test_ref_remap(fmt, test_get(ref_data, fmt, d),
+								test_get(source_data, fmt, s), gain,
+								start_frame + f < mixed_frames));
+				else
+					test_set(ref_data, fmt, d,
+						 test_ref_normal(fmt, test_get(ref_data, fmt, d),
+								 test_get(source_data, fmt, s),
+								 start_frame + f < mixed_frames));
+			}
+		}
+
+		if (remap_mode)
+			test_remap(&sink, start_frame, mixed_frames, &source, frame_count,
+				   channel_map, gain);
+		else
+			normal(&sink, start_frame * sink_channels, mixed_frames * sink_channels,
+			       &source, frame_count * sink_channels, gain);
+
+		assert_memory_equal(sink_data, ref_data, sizeof(sink_data));
+	}
+}
+
+static void test_audio_mixin_mixout_normal(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < ARRAY_SIZE(test_formats); i++)
+		test_mix(test_formats[i], false);
+}
+
+static void test_audio_mixin_mixout_remap(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < ARRAY_SIZE(test_formats); i++)
+		test_mix(test_formats[i], true);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_mixin_mixout_normal),
+		cmocka_unit_test(test_audio_mixin_mixout_remap),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
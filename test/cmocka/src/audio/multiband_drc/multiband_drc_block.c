@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * Multiband DRC processes the period in blocks through all the stages, each
+ * stage keeps its state between the blocks. The output must not depend on
+ * how the stream is split in periods, so every period size must give the
+ * same output as processing the stream one frame at a time.
+ */
+
+#include <sof/audio/component.h>
+#include <sof/audio/drc/drc.h>
+#include <sof/audio/format.h>
+#include <sof/audio/multiband_drc/multiband_drc.h>
+#include <sof/math/iir_df2t.h>
+#include <user/drc.h>
+#include <user/eq.h>
+#include <user/multiband_drc.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#define TEST_FRAMES		960
+#define TEST_MAX_CHANNELS	PLATFORM_MAX_CHANNELS
+#define TEST_BANDS		SOF_MULTIBAND_DRC_MAX_BANDS
+
+/* Butterworth lowpass and highpass pairs of the crossover at 48 kHz */
+static const struct sof_eq_iir_biquad test_crossover_coef[] = {
+	/* 300 Hz */
+	{ -1015736075, 2087866987, 402728, 805456, 402728, 0, 16384 },
+	{ -1015736075, 2087866987, 1044336221, -2088672443, 1044336221, 0, 16384 },
+	/* 2000 Hz */
+	{ -741524947, 1753413056, 15463429, 30926858, 15463429, 0, 16384 },
+	{ -741524947, 1753413056, 892169957, -1784339914, 892169957, 0, 16384 },
+	/* 8000 Hz */
+	{ -258136345, 665939085, 166484771, 332969542, 166484771, 0, 16384 },
+	{ -258136345, 665939085, 499454314, -998908627, 499454314, 0, 16384 },
+};
+
+/* +6 dB at 1 kHz and +3 dB at 5 kHz peaking filters and their inverse */
+static const struct sof_eq_iir_biquad test_emp_coef[] = {
+	{ -942030206, 1998526821, 876486401, -1998526821, 1139285629, 0, 16384 },
+	{ -502755827, 1250719677, 384979246, -1250719677, 1191518405, 0, 16384 },
+};
+
+static const struct sof_eq_iir_biquad test_deemp_coef[] = {
+	{ -826061597, 1883550340, 887834627, -1883550340, 1011968794, 0, 16384 },
+	{ -346925667, 1127091300, 453060529, -1127091300, 967606963, 0, 16384 },
+};
+
+/* -20 dB threshold, 10 dB knee, 4:1 ratio, 3 ms attack, 2.5 ms release */
+static const struct sof_drc_params test_drc_params = {
+	.enabled = 1,
+	.db_threshold = -335544320,
+	.db_knee = 167772160,
+	.ratio = 67108864,
+	.linear_threshold = 107374182,
+	.slope = 268435456,
+	.K = 8978105,
+	.knee_alpha = 3637176,
+	.knee_beta = -4613030,
+	.knee_threshold = 5305422,
+	.ratio_base = 284157634,
+	.master_linear_gain = 37249824,
+	.one_over_attack_frames = 7456540,
+	.sat_release_frames_inv_neg = -8947849,
+	.sat_release_rate_at_neg_two_db = 2062296,
+	.kSpacingDb = 5,
+	.kA = 3932160,
+	.kB = 1070387,
+	.kC = 2215545,
+	.kD = 578867,
+	.kE = 67362,
+};
+
+struct test_iir {
+	int32_t coef[2 * SOF_EQ_IIR_NBIQUAD];
+	int64_t delay[CROSSOVER_NUM_DELAYS_LR4];
+};
+
+/* filters of each channel: emphasis, deemphasis, crossover lowpass and highpass */
+struct test_filters {
+	struct test_iir emp;
+	struct test_iir deemp;
+	struct test_iir lr4[2][CROSSOVER_MAX_LR4];
+};
+
+static struct test_filters test_filters[TEST_MAX_CHANNELS];
+static int32_t test_pre_delay[TEST_BANDS][CONFIG_DRC_MAX_PRE_DELAY_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_block_buf[TEST_BANDS][MULTIBAND_DRC_BLOCK_FRAMES * TEST_MAX_CHANNELS];
+static struct multiband_drc_comp_data test_cd;
+static struct sof_multiband_drc_config *test_config;
+
+static int32_t test_in[TEST_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_ref[TEST_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_out[TEST_FRAMES * TEST_MAX_CHANNELS];
+
+/* drivers of the pass through functions, not used */
+int audio_stream_copy(const struct audio_stream __sparse_cache *source, uint32_t ioffset,
+		      struct audio_stream __sparse_cache *sink, uint32_t ooffset, uint32_t samples)
+{
+	fail();
+	return 0;
+}
+
+static void test_init_iir(struct iir_state_df2t *iir, struct test_iir *t,
+			  const struct sof_eq_iir_biquad *coef0,
+			  const struct sof_eq_iir_biquad *coef1)
+{
+	*(struct sof_eq_iir_biquad *)t->coef = *coef0;
+	*(struct sof_eq_iir_biquad *)(t->coef + SOF_EQ_IIR_NBIQUAD) = *coef1;
+	memset(t->delay, 0, sizeof(t->delay));
+	iir->coef = t->coef;
+	iir->delay = t->delay;
+	iir->biquads = 2;
+	iir->biquads_in_series = 2;
+}
+
+/* the state after multiband_drc_setup(), band 2 has the DRC disabled */
+static void test_init(int nch, int num_bands, bool emp, size_t sample_bytes)
+{
+	struct sof_multiband_drc_config *config = test_config;
+	struct multiband_drc_state *state = &test_cd.state;
+	struct drc_state *drc;
+	int band;
+	int ch;
+	int i;
+
+	memset(&test_cd, 0, sizeof(test_cd));
+	memset(test_pre_delay, 0, sizeof(test_pre_delay));
+
+	config->num_bands = num_bands;
+	config->enable_emp_deemp = emp;
+	for (band = 0; band < num_bands; band++) {
+		config->drc_coef[band] = test_drc_params;
+		config->drc_coef[band].enabled = band != 2;
+	}
+
+	for (ch = 0; ch < nch; ch++) {
+		test_init_iir(&state->emphasis[ch], &test_filters[ch].emp,
+			      &test_emp_coef[0], &test_emp_coef[1]);
+		test_init_iir(&state->deemphasis[ch], &test_filters[ch].deemp,
+			      &test_deemp_coef[0], &test_deemp_coef[1]);
+		for (i = 0; i < CROSSOVER_MAX_LR4; i++) {
+			test_init_iir(&state->crossover[ch].lowpass[i],
+				      &test_filters[ch].lr4[0][i],
+				      &test_crossover_coef[2 * i], &test_crossover_coef[2 * i]);
+			test_init_iir(&state->crossover[ch].highpass[i],
+				      &test_filters[ch].lr4[1][i],
+				      &test_crossover_coef[2 * i + 1],
+				      &test_crossover_coef[2 * i + 1]);
+		}
+	}
+
+	/* a different pre-delay in each band */
+	for (band = 0; band < num_bands; band++) {
+		drc = &state->drc[band];
+		for (ch = 0; ch < nch; ch++)
+			drc->pre_delay_buffers[ch] = (int8_t *)test_pre_delay[band] +
+				ch * CONFIG_DRC_MAX_PRE_DELAY_FRAMES * sample_bytes;
+
+		drc->compressor_gain = Q_CONVERT_FLOAT(1.0f, 30);
+		drc->max_attack_compression_diff_db = INT32_MIN;
+		drc->last_pre_delay_frames = DRC_DIVISION_FRAMES * (band + 1);
+		drc->pre_delay_write_index = drc->last_pre_delay_frames;
+		state->block_buf[band] = test_block_buf[band];
+	}
+
+	test_cd.config = config;
+	test_cd.crossover_split_block = crossover_find_split_block_func(num_bands);
+	assert_non_null(test_cd.crossover_split_block);
+}
+
+static void test_stream_init(struct audio_stream *stream, void *addr, size_t bytes,
+			     enum sof_ipc_frame fmt, int nch)
+{
+	memset(stream, 0, sizeof(*stream));
+	stream->addr = addr;
+	stream->end_addr = (char *)addr + bytes;
+	stream->size = bytes;
+	stream->r_ptr = addr;
+	stream->w_ptr = addr;
+	stream->channels = nch;
+	stream->frame_fmt = fmt;
+}
+
+static void test_run(enum sof_ipc_frame fmt, int nch, int num_bands, bool emp, int period,
+		     int32_t *out)
+{
+	const size_t sample_bytes = fmt == SOF_IPC_FRAME_S16_LE ? 2 : 4;
+	const size_t bytes = TEST_FRAMES * nch * sample_bytes;
+	struct audio_stream source;
+	struct audio_stream sink;
+	struct comp_dev dev;
+	multiband_drc_func func = multiband_drc_find_proc_func(fmt);
+	int frames;
+	int i;
+
+	assert_non_null(func);
+	test_init(nch, num_bands, emp, sample_bytes);
+	memset(&dev, 0, sizeof(dev));
+	dev.priv_data = &test_cd;
+
+	test_stream_init(&source, test_in, bytes, fmt, nch);
+	test_stream_init(&sink, out, bytes, fmt, nch);
+
+	for (i = 0; i < TEST_FRAMES; i += frames) {
+		frames = MIN(period, TEST_FRAMES - i);
+		func(&dev, &source, &sink, frames);
+		source.r_ptr = (char *)source.r_ptr + frames * nch * sample_bytes;
+		sink.w_ptr = (char *)sink.w_ptr + frames * nch * sample_bytes;
+	}
+}
+
+/* noise bursts at -40 dB and full scale, in the component format */
+static void test_input(enum sof_ipc_frame fmt, int nch)
+{
+	int16_t *x16 = (int16_t *)test_in;
+	int32_t x;
+	int i;
+
+	srand(1);
+	for (i = 0; i < TEST_FRAMES * nch; i++) {
+		x = (int32_t)rand() * 2 + (rand() & 1);
+		if (!((i / nch / 160) & 1))
+			x /= 100;
+
+		switch (fmt) {
+		case SOF_IPC_FRAME_S16_LE:
+			x16[i] = x >> 16;
+			break;
+		case SOF_IPC_FRAME_S24_4LE:
+			test_in[i] = x >> 8;
+			break;
+		default:
+			test_in[i] = x;
+			break;
+		}
+	}
+}
+
+static void test_multiband_drc_block(void **state)
+{
+	const enum sof_ipc_frame fmts[] = {
+		SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE
+	};
+	const int channels[] = { 1, 2, 5, TEST_MAX_CHANNELS };
+	const int periods[] = { 16, 37, 48, 192 };
+	size_t bytes;
+	int num_bands;
+	int emp;
+	int f;
+	int c;
+	int p;
+
+	(void)state;
+
+	for (f = 0; f < ARRAY_SIZE(fmts); f++)
+		for (c = 0; c < ARRAY_SIZE(channels); c++)
+			for (num_bands = 2; num_bands <= TEST_BANDS; num_bands++)
+				for (emp = 0; emp <= 1; emp++) {
+					bytes = TEST_FRAMES * channels[c] *
+						(fmts[f] == SOF_IPC_FRAME_S16_LE ? 2 : 4);
+					test_input(fmts[f], channels[c]);
+
+					/* one frame at a time is the reference */
+					test_run(fmts[f], channels[c], num_bands, emp, 1,
+						 test_ref);
+					for (p = 0; p < ARRAY_SIZE(periods); p++) {
+						memset(test_out, 0, sizeof(test_out));
+						test_run(fmts[f], channels[c], num_bands, emp,
+							 periods[p], test_out);
+						assert_memory_equal(test_out, test_ref, bytes);
+					}
+				}
+}
+
+static int setup_group(void **state)
+{
+	test_config = malloc(sizeof(*test_config) + TEST_BANDS * sizeof(struct sof_drc_params));
+	if (!test_config)
+		return -1;
+
+	return 0;
+}
+
+static int teardown_group(void **state)
+{
+	free(test_config);
+	return 0;
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_multiband_drc_block),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, setup_group, teardown_group);
+}
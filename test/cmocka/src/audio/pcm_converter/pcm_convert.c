@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/pcm_converter.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <sof/audio/buffer.h>
+#include <ipc/stream.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <cmocka.h>
+
+#include "../../util.h"
+
+/* Odd buffer size and offsets so that the conversions wrap in the middle
+ * of SIMD blocks and leave scalar tails.
+ */
+#define TEST_SAMPLES		997
+#define TEST_SOURCE_OFFSET	333
+#define TEST_SINK_OFFSET	201
+
+/* samples converted for the throughput report */
+#define BENCH_SAMPLES		(4 * 1024 * 1024)
+
+/*
+ * Reference conversions, the scalar per sample code of the generic
+ * converter before the kernels were vectorised.
+ */
+static int32_t ref_shift(int32_t d, int32_t a)
+{
+	int64_t dd = d;
+
+	if (a > 32)
+		a = 32;
+	else if (a < -32)
+		a = -32;
+
+	dd = a >= 0 ? dd << a : dd >> -a;
+	if (dd > INT32_MAX)
+		dd = INT32_MAX;
+
+	return (int32_t)dd;
+}
+
+static int32_t ref_f_to_i(int32_t src, int32_t pow)
+{
+	int32_t exponent = ((src >> 23) & 0xFF) + pow - 127;
+	int32_t mantissa = (1 << 23) | (src & 0x7FFFFF);
+	uint32_t dst = ref_shift(mantissa, exponent - 23);
+
+	if (exponent - 22 < 9 || src < 0)
+		dst += ref_shift(mantissa, exponent - 22) & 1;
+
+	return src < 0 ? (int32_t)-dst : (int32_t)dst;
+}
+
+static int32_t ref_i_to_f(int32_t src, int32_t pow)
+{
+	uint32_t abs = src < 0 ? -(uint32_t)src : (uint32_t)src;
+	int32_t abs_clz;
+	int32_t mantissa;
+
+	if (src == 0)
+		return 0;
+
+	abs_clz = __builtin_clz(abs);
+	mantissa = ref_shift(abs, 23 - 31 + abs_clz) & 0x7FFFFF;
+
+	return (src & (1u << 31)) | (((127 + 31 - abs_clz - pow) & 0xFF) << 23) | mantissa;
+}
+
+static int32_t ref_s16_to_s24(int32_t x) { return x << 8; }
+static int32_t ref_s16_to_s32(int32_t x) { return x << 16; }
+static int32_t ref_s24_to_s32(int32_t x) { return x << 8; }
+static int32_t ref_s16_c16_to_s16_c32(int32_t x) { return x; }
+static int32_t ref_s16_c32_to_s16_c16(int32_t x) { return (int16_t)(x & 0xffff); }
+
+static int32_t ref_s24_to_s16(int32_t x)
+{
+	return sat_int16(Q_SHIFT_RND(sign_extend_s24(x), 23, 15));
+}
+
+static int32_t ref_s32_to_s16(int32_t x)
+{
+	return sat_int16(Q_SHIFT_RND(x, 31, 15));
+}
+
+static int32_t ref_s32_to_s24(int32_t x)
+{
+	return sat_int24(Q_SHIFT_RND(x, 31, 23));
+}
+
+static int32_t ref_s32_to_s24_be(int32_t x)
+{
+	return sat_int24(Q_SHIFT_RND(x, 31, 23)) << 8;
+}
+
+static int32_t ref_s16_to_f(int32_t x) { return ref_i_to_f(x, 15); }
+static int32_t ref_s24_to_f(int32_t x) { return ref_i_to_f(sign_extend_s24(x), 23); }
+static int32_t ref_s32_to_f(int32_t x) { return ref_i_to_f(x, 31); }
+static int32_t ref_f_to_s16(int32_t x) { return sat_int16(ref_f_to_i(x, 15)); }
+static int32_t ref_f_to_s24(int32_t x) { return sat_int24(ref_f_to_i(x, 23)); }
+static int32_t ref_f_to_s32(int32_t x) { return ref_f_to_i(x, 31); }
+
+struct pcm_convert_test {
+	const char *name;
+	enum sof_ipc_frame in;		/**< source container */
+	enum sof_ipc_frame valid_in;	/**< source valid bits, vc map only */
+	enum sof_ipc_frame out;		/**< sink container */
+	enum sof_ipc_frame valid_out;	/**< sink valid bits, vc map only */
+	bool vc;			/**< function from pcm_func_vc_map */
+	uint32_t type;			/**< vc map gateway type */
+	enum ipc4_direction_type dir;	/**< vc map direction */
+	int32_t (*ref)(int32_t x);
+};
+
+#define TEST_MAP(in_fmt, out_fmt, ref_func) \
+	{ #ref_func, in_fmt, in_fmt, out_fmt, out_fmt, false, 0, 0, ref_func }
+
+#define TEST_VC_MAP(in_fmt, valid_in_fmt, out_fmt, valid_out_fmt, gtw, direction, ref_func) \
+	{ #ref_func, in_fmt, valid_in_fmt, out_fmt, valid_out_fmt, true, gtw, direction, ref_func }
+
+static const struct pcm_convert_test tests[] = {
+	TEST_MAP(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S24_4LE, ref_s16_to_s24),
+	TEST_MAP(SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S16_LE, ref_s24_to_s16),
+	TEST_MAP(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE, ref_s16_to_s32),
+	TEST_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE, ref_s32_to_s16),
+	TEST_MAP(SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE, ref_s24_to_s32),
+	TEST_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S24_4LE, ref_s32_to_s24),
+	TEST_MAP(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_FLOAT, ref_s16_to_f),
+	TEST_MAP(SOF_IPC_FRAME_FLOAT, SOF_IPC_FRAME_S16_LE, ref_f_to_s16),
+	TEST_MAP(SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_FLOAT, ref_s24_to_f),
+	TEST_MAP(SOF_IPC_FRAME_FLOAT, SOF_IPC_FRAME_S24_4LE, ref_f_to_s24),
+	TEST_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_FLOAT, ref_s32_to_f),
+	TEST_MAP(SOF_IPC_FRAME_FLOAT, SOF_IPC_FRAME_S32_LE, ref_f_to_s32),
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S24_4LE, ipc4_gtw_link, ipc4_playback, ref_s32_to_s24_be),
+#if CONFIG_PCM_CONVERTER_FORMAT_S16_C16_AND_S16_C32
+	TEST_VC_MAP(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S16_LE, ipc4_gtw_all, ipc4_bidirection, ref_s16_c16_to_s16_c32),
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S16_LE,
+		    SOF_IPC_FRAME_S16_LE, ipc4_gtw_all, ipc4_bidirection, ref_s16_c32_to_s16_c16),
+#endif
+#if CONFIG_PCM_CONVERTER_FORMAT_S16_C32_AND_S32_C32
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S32_LE, ipc4_gtw_all, ipc4_bidirection, ref_s16_to_s32),
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S16_LE, ipc4_gtw_all, ipc4_bidirection, ref_s32_to_s16),
+#endif
+#if CONFIG_PCM_CONVERTER_FORMAT_S16_C32_AND_S24_C32
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S24_4LE, ipc4_gtw_dmic, ipc4_bidirection, ref_s16_to_s24),
+	TEST_VC_MAP(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE,
+		    SOF_IPC_FRAME_S16_LE, ipc4_gtw_dmic, ipc4_bidirection, ref_s24_to_s16),
+#endif
+};
+
+static uint32_t rand_state = 1;
+
+static uint32_t test_rand(void)
+{
+	rand_state = rand_state * 1664525 + 1013904223;
+	return rand_state;
+}
+
+/* Input sample i: edge values first, then random data. Float inputs mix
+ * random bit patterns (all exponents, inf and nan) with values in +-2.0.
+ */
+static int32_t test_input(const struct pcm_convert_test *t, int i)
+{
+	static const int32_t edges[] = {
+		0, 1, -1, 2, -2, 127, -128, 128, -129, 255, 256, INT16_MAX, INT16_MIN,
+		INT16_MAX + 1, INT16_MIN - 1, 0x7fff80, 0x7fffc0, INT24_MAXVALUE, INT24_MINVALUE,
+		0x800000, 0xffffff, 0x1000000, 0x7fff7fff, 0x7fff8000, 0x7fffff80, 0x7fffffc0,
+		INT32_MAX - 1, INT32_MAX, INT32_MIN, INT32_MIN + 1, 0x00008000, 0x0000c000,
+		-0x8000, -0x8001, -0x7fff8000, 0x3f800000, 0xbf800000, 0x3f000000, 0xbf000000,
+		0x7f800000, 0xff800000, 0x7fc00000, 0x4f000000, 0xcf000000, 0x37000000,
+		0xb7000000, 0x37800000, 0x33800000, 0x3f7fffff, 0xbf7fffff,
+	};
+	union {
+		float f;
+		int32_t i;
+	} u;
+	uint32_t r = test_rand();
+
+	if (i < ARRAY_SIZE(edges)) {
+		r = edges[i];
+	} else if (t->in == SOF_IPC_FRAME_FLOAT && (r & 1)) {
+		u.f = ((int32_t)r / 2147483648.0f) * 2.0f;
+		r = u.i;
+	}
+
+	return t->in == SOF_IPC_FRAME_S16_LE ? (int16_t)r : (int32_t)r;
+}
+
+static void test_set(void *addr, int bytes, int i, int32_t x)
+{
+	if (bytes == 2)
+		((int16_t *)addr)[i] = x;
+	else
+		((int32_t *)addr)[i] = x;
+}
+
+static int32_t test_get(const void *addr, int bytes, int i)
+{
+	if (bytes == 2)
+		return ((const int16_t *)addr)[i];
+
+	return ((const int32_t *)addr)[i];
+}
+
+static pcm_converter_func test_func(const struct pcm_convert_test *t)
+{
+	if (t->vc)
+		return pcm_get_conversion_vc_function(t->in, t->valid_in, t->out, t->valid_out,
+						      t->type, t->dir);
+
+	return pcm_get_conversion_function(t->in, t->out);
+}
+
+static void test_pcm_convert_pair(const struct pcm_convert_test *t)
+{
+	int in_bytes = get_sample_bytes(t->in);
+	int out_bytes = get_sample_bytes(t->out);
+	struct comp_buffer *source;
+	struct comp_buffer *sink;
+	struct timespec start, end;
+	pcm_converter_func func;
+	int32_t in[TEST_SAMPLES];
+	double seconds;
+	int idx, ret;
+	int i;
+
+	func = test_func(t);
+	assert_non_null(func);
+
+	source = create_test_source(NULL, 0, t->in, 1, TEST_SAMPLES * in_bytes);
+	sink = create_test_sink(NULL, 0, t->out, 1, TEST_SAMPLES * out_bytes);
+
+	/* full circular source starting from the middle of the buffer */
+	source->stream.r_ptr = (char *)source->stream.addr + TEST_SOURCE_OFFSET * in_bytes;
+	source->stream.w_ptr = source->stream.r_ptr;
+	for (i = 0; i < TEST_SAMPLES; i++) {
+		in[i] = test_input(t, i);
+		idx = (TEST_SOURCE_OFFSET + i) % TEST_SAMPLES;
+		test_set(source->stream.addr, in_bytes, idx, in[i]);
+	}
+	audio_stream_produce(&source->stream, TEST_SAMPLES * in_bytes);
+
+	sink->stream.w_ptr = (char *)sink->stream.addr + TEST_SINK_OFFSET * out_bytes;
+	sink->stream.r_ptr = sink->stream.w_ptr;
+
+	ret = func(&source->stream, 0, &sink->stream, 0, TEST_SAMPLES);
+	assert_int_equal(ret, TEST_SAMPLES);
+
+	for (i = 0; i < TEST_SAMPLES; i++) {
+		idx = (TEST_SINK_OFFSET + i) % TEST_SAMPLES;
+		if (test_get(sink->stream.addr, out_bytes, idx) != t->ref(in[i]))
+			print_error("%s: sample %d input 0x%08x output 0x%08x expected 0x%08x\n",
+				    t->name, i, in[i], test_get(sink->stream.addr, out_bytes, idx),
+				    t->ref(in[i]));
+		assert_int_equal(test_get(sink->stream.addr, out_bytes, idx), t->ref(in[i]));
+	}
+
+	/* throughput with the same wrapping buffers */
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_SAMPLES / TEST_SAMPLES; i++)
+		func(&source->stream, 0, &sink->stream, 0, TEST_SAMPLES);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	if (seconds > 0)
+		printf("%-26s %8.1f Msamples/s\n", t->name,
+		       (double)(BENCH_SAMPLES / TEST_SAMPLES) * TEST_SAMPLES / seconds / 1e6);
+
+	free_test_source(source);
+	free_test_sink(sink);
+}
+
+static void test_pcm_convert(void **state)
+{
+	const struct pcm_convert_test *t = *state;
+
+	test_pcm_convert_pair(t);
+}
+
+int main(void)
+{
+	struct CMUnitTest ut[ARRAY_SIZE(tests)];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(tests); i++) {
+		ut[i].name = tests[i].name;
+		ut[i].test_func = test_pcm_convert;
+		ut[i].setup_func = NULL;
+		ut[i].teardown_func = NULL;
+		ut[i].initial_state = (void *)&tests[i];
+	}
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(ut, NULL, NULL);
+}
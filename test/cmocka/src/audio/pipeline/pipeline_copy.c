@@ -0,0 +1,361 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/component_ext.h>
+#include <sof/audio/pipeline.h>
+#include <ipc/stream.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#define PIPELINE_ID		1
+#define PIPELINE_ID_OTHER	2
+#define MAX_COMPS		(PPL_COPY_LIST_SIZE + 2)
+
+struct copy_test_data {
+	struct pipeline p;
+	struct comp_dev comps[MAX_COMPS];
+	struct comp_buffer buffers[MAX_COMPS];
+	int num_buffers;
+	int order[2 * MAX_COMPS];
+	int count;
+	int stop_id;
+};
+
+static struct copy_test_data *test_data;
+
+static int mock_copy(struct comp_dev *dev)
+{
+	test_data->order[test_data->count++] = dev->ipc_config.id;
+
+	return dev->ipc_config.id == test_data->stop_id ? PPL_STATUS_PATH_STOP : 0;
+}
+
+static const struct comp_driver mock_drv = {
+	.ops = {
+		.copy = mock_copy,
+	},
+};
+
+static int setup(void **state)
+{
+	int i;
+
+	test_data = calloc(sizeof(*test_data), 1);
+	if (!test_data)
+		return -ENOMEM;
+
+	test_data->p.pipeline_id = PIPELINE_ID;
+	test_data->stop_id = -1;
+
+	for (i = 0; i < MAX_COMPS; i++) {
+		struct comp_dev *cd = &test_data->comps[i];
+
+		cd->ipc_config.id = i;
+		cd->ipc_config.pipeline_id = PIPELINE_ID;
+		cd->drv = &mock_drv;
+		cd->state = COMP_STATE_ACTIVE;
+		cd->pipeline = &test_data->p;
+		list_init(&cd->bsource_list);
+		list_init(&cd->bsink_list);
+	}
+
+	*state = test_data;
+
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	struct copy_test_data *td = *state;
+
+	free(td->p.copy_list);
+	free(td);
+
+	return 0;
+}
+
+static struct comp_buffer *connect(struct copy_test_data *td, int source, int sink)
+{
+	struct comp_buffer *buffer = &td->buffers[td->num_buffers++];
+
+	buffer->id = td->num_buffers;
+	list_init(&buffer->source_list);
+	list_init(&buffer->sink_list);
+	pipeline_connect(&td->comps[source], buffer, PPL_CONN_DIR_COMP_TO_BUFFER);
+	pipeline_connect(&td->comps[sink], buffer, PPL_CONN_DIR_BUFFER_TO_COMP);
+
+	return buffer;
+}
+
+/* run pipeline_copy() with the graph walk and with the flat copy list and
+ * check that both copy the same components in the same order
+ */
+static void copy_and_compare(struct copy_test_data *td, const int *expect, int num)
+{
+	int walk_order[2 * MAX_COMPS];
+	int walk_count;
+	int ret;
+	int i;
+
+	td->count = 0;
+	td->p.copy_walk = true;
+	ret = pipeline_copy(&td->p);
+	assert_true(ret >= 0);
+	walk_count = td->count;
+	for (i = 0; i < walk_count; i++)
+		walk_order[i] = td->order[i];
+
+	assert_int_equal(pipeline_copy_list_build(&td->p), 0);
+	assert_true(td->p.copy_list_valid);
+
+	td->count = 0;
+	td->p.copy_walk = false;
+	ret = pipeline_copy(&td->p);
+	assert_true(ret >= 0);
+
+	assert_int_equal(td->count, walk_count);
+	assert_memory_equal(td->order, walk_order, walk_count * sizeof(int));
+	assert_int_equal(td->count, num);
+	assert_memory_equal(td->order, expect, num * sizeof(int));
+}
+
+/* run pipeline_copy() with the flat copy list only, the graph walk copies
+ * merging paths out of order
+ */
+static void copy_list_check(struct copy_test_data *td, const int *expect, int num)
+{
+	assert_int_equal(pipeline_copy_list_build(&td->p), 0);
+
+	td->count = 0;
+	td->p.copy_walk = false;
+	assert_true(pipeline_copy(&td->p) >= 0);
+
+	assert_int_equal(td->count, num);
+	assert_memory_equal(td->order, expect, num * sizeof(int));
+}
+
+/* capture: 0 -> 1 -> 2 -> 3 and 1 -> 4 -> 5, 6 is in another pipeline,
+ * the last connected buffer is the first in the component buffer list
+ */
+static void build_capture(struct copy_test_data *td)
+{
+	td->comps[0].direction = SOF_IPC_STREAM_CAPTURE;
+	td->comps[6].ipc_config.pipeline_id = PIPELINE_ID_OTHER;
+	td->p.source_comp = &td->comps[0];
+	td->p.sink_comp = &td->comps[3];
+
+	connect(td, 0, 1);
+	connect(td, 1, 2);
+	connect(td, 2, 3);
+	connect(td, 1, 4);
+	connect(td, 4, 5);
+	connect(td, 3, 6);
+}
+
+/* playback: 5 -> 4 -> 1 and 3 -> 2 -> 1 -> 0, 6 is in another pipeline */
+static void build_playback(struct copy_test_data *td)
+{
+	td->comps[3].direction = SOF_IPC_STREAM_PLAYBACK;
+	td->comps[6].ipc_config.pipeline_id = PIPELINE_ID_OTHER;
+	td->p.source_comp = &td->comps[3];
+	td->p.sink_comp = &td->comps[0];
+
+	connect(td, 1, 0);
+	connect(td, 2, 1);
+	connect(td, 3, 2);
+	connect(td, 4, 1);
+	connect(td, 5, 4);
+	connect(td, 6, 3);
+}
+
+/* capture: 0 -> 1 -> 3 -> 4 and 0 -> 2 -> 3 */
+static void build_capture_merge(struct copy_test_data *td)
+{
+	td->comps[0].direction = SOF_IPC_STREAM_CAPTURE;
+	td->p.source_comp = &td->comps[0];
+	td->p.sink_comp = &td->comps[4];
+
+	connect(td, 0, 1);
+	connect(td, 0, 2);
+	connect(td, 1, 3);
+	connect(td, 2, 3);
+	connect(td, 3, 4);
+}
+
+/* playback: 4 -> 2 -> 1 -> 0 and 4 -> 3 -> 1 */
+static void build_playback_merge(struct copy_test_data *td)
+{
+	td->comps[4].direction = SOF_IPC_STREAM_PLAYBACK;
+	td->p.source_comp = &td->comps[4];
+	td->p.sink_comp = &td->comps[0];
+
+	connect(td, 4, 2);
+	connect(td, 4, 3);
+	connect(td, 2, 1);
+	connect(td, 3, 1);
+	connect(td, 1, 0);
+}
+
+static void test_audio_pipeline_copy_list_downstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {0, 1, 4, 5, 2, 3};
+
+	build_capture(td);
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+}
+
+static void test_audio_pipeline_copy_list_upstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {5, 4, 3, 2, 1, 0};
+
+	build_playback(td);
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+}
+
+static void test_audio_pipeline_copy_list_inactive_downstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {0, 1, 4, 5};
+
+	/* not active component is skipped with all components behind it */
+	build_capture(td);
+	td->comps[2].state = COMP_STATE_PAUSED;
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+
+	td->comps[2].state = COMP_STATE_ACTIVE;
+	td->comps[1].state = COMP_STATE_PAUSED;
+	copy_and_compare(td, expect, 1);
+}
+
+static void test_audio_pipeline_copy_list_inactive_upstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {5, 4, 1, 0};
+
+	build_playback(td);
+	td->comps[2].state = COMP_STATE_PAUSED;
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+}
+
+/* a merging component is copied after all its sources and as long as any
+ * of them is active
+ */
+static void test_audio_pipeline_copy_list_merge_downstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {0, 2, 1, 3, 4};
+	const int expect_inactive[] = {0, 2, 3, 4};
+
+	build_capture_merge(td);
+	copy_list_check(td, expect, ARRAY_SIZE(expect));
+
+	td->comps[1].state = COMP_STATE_PAUSED;
+	copy_list_check(td, expect_inactive, ARRAY_SIZE(expect_inactive));
+
+	td->comps[2].state = COMP_STATE_PAUSED;
+	copy_list_check(td, expect, 1);
+}
+
+static void test_audio_pipeline_copy_list_merge_upstream(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {4, 3, 2, 1, 0};
+	const int expect_inactive[] = {4, 2, 1, 0};
+
+	build_playback_merge(td);
+	copy_list_check(td, expect, ARRAY_SIZE(expect));
+
+	td->comps[3].state = COMP_STATE_PAUSED;
+	copy_list_check(td, expect_inactive, ARRAY_SIZE(expect_inactive));
+
+	td->comps[1].state = COMP_STATE_PAUSED;
+	copy_list_check(td, expect_inactive + 3, 1);
+}
+
+static void test_audio_pipeline_copy_list_path_stop(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {0, 1, 4, 5, 2};
+
+	build_capture(td);
+	td->stop_id = 2;
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+}
+
+static void test_audio_pipeline_copy_list_invalidate(void **state)
+{
+	struct copy_test_data *td = *state;
+	const int expect[] = {0, 1, 2, 3};
+	struct comp_buffer *buffer;
+
+	build_capture(td);
+	assert_int_equal(pipeline_copy_list_build(&td->p), 0);
+	assert_int_equal(td->p.copy_count, 6);
+
+	/* the list is built again after a graph change */
+	buffer = &td->buffers[3];
+	pipeline_disconnect(&td->comps[1], buffer, PPL_CONN_DIR_COMP_TO_BUFFER);
+	pipeline_disconnect(&td->comps[4], buffer, PPL_CONN_DIR_BUFFER_TO_COMP);
+	assert_false(td->p.copy_list_valid);
+
+	copy_and_compare(td, expect, ARRAY_SIZE(expect));
+	assert_int_equal(td->p.copy_count, 4);
+}
+
+static void test_audio_pipeline_copy_list_too_long(void **state)
+{
+	struct copy_test_data *td = *state;
+	int i;
+
+	td->comps[0].direction = SOF_IPC_STREAM_CAPTURE;
+	td->p.source_comp = &td->comps[0];
+	td->p.sink_comp = &td->comps[MAX_COMPS - 1];
+
+	for (i = 0; i < MAX_COMPS - 1; i++)
+		connect(td, i, i + 1);
+
+	/* the graph walk is used for too long pipelines */
+	assert_int_equal(pipeline_copy_list_build(&td->p), -ENOSPC);
+	assert_false(td->p.copy_list_valid);
+
+	td->count = 0;
+	assert_int_equal(pipeline_copy(&td->p), 0);
+	assert_int_equal(td->count, MAX_COMPS);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_downstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_upstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_inactive_downstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_inactive_upstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_merge_downstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_merge_upstream,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_path_stop,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_invalidate,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_audio_pipeline_copy_list_too_long,
+						setup, teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,15 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __TEST_SRC_REF_H__
+#define __TEST_SRC_REF_H__
+
+#include <sof/audio/src/src.h>
+
+/* The generic version is built with these names for the comparison */
+void src_polyphase_stage_cir_ref(struct src_stage_prm *s);
+void src_polyphase_stage_cir_s16_ref(struct src_stage_prm *s);
+
+#endif /* __TEST_SRC_REF_H__ */
@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * Compares the x86 polyphase stage with the generic version, built to the
+ * test with _ref suffixed names. Every stage of the coefficient set given
+ * by SRC_TEST_TABLE is run with 1 to 8 channels in s32 and s16 formats,
+ * the output, the output delay line and both copies of the mirrored FIR
+ * delay line must match.
+ */
+
+#include <sof/audio/src/src.h>
+#include <sof/common.h>
+#include SRC_TEST_TABLE
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#include "src_ref.h"
+
+#define TEST_MAX_CHANNELS	8
+#define TEST_RUNS		40
+
+struct test_src {
+	struct src_stage_prm prm;
+	struct src_state state;
+	int32_t *fir;
+	int32_t *out;
+	int32_t *y;
+};
+
+static uint32_t test_seed = 1;
+
+static int32_t test_rand(void)
+{
+	test_seed = test_seed * 1664525 + 1013904223;
+	return (int32_t)test_seed;
+}
+
+/* sets up one stage instance, the x86 one has two FIR delay line copies */
+static void test_src_init(struct test_src *t, struct src_stage *stage, int nch,
+			  int copies, int fir_words, int out_words, int y_words,
+			  size_t sample_bytes, void *x, int x_words)
+{
+	t->fir = calloc(fir_words * copies, sizeof(int32_t));
+	t->out = calloc(out_words, sizeof(int32_t));
+	t->y = calloc(y_words, sizeof(int32_t));
+	assert_non_null(t->fir);
+	assert_non_null(t->out);
+	assert_non_null(t->y);
+
+	t->state.fir_delay_size = fir_words;
+	t->state.out_delay_size = out_words;
+	t->state.fir_delay = t->fir;
+	t->state.out_delay = t->out;
+	t->state.fir_wp = &t->fir[fir_words - 1];
+	t->state.out_rp = t->out;
+
+	memset(&t->prm, 0, sizeof(t->prm));
+	t->prm.nch = nch;
+	t->prm.x_rptr = x;
+	t->prm.x_end_addr = (char *)x + x_words * sample_bytes;
+	t->prm.x_size = x_words * sample_bytes;
+	t->prm.y_wptr = t->y;
+	t->prm.y_addr = t->y;
+	t->prm.y_end_addr = (char *)t->y + y_words * sample_bytes;
+	t->prm.y_size = y_words * sample_bytes;
+	t->prm.shift = sample_bytes == sizeof(int16_t) ? 0 : (nch & 1) * 8;
+	t->prm.state = &t->state;
+	t->prm.stage = stage;
+}
+
+static void test_src_free(struct test_src *t)
+{
+	free(t->fir);
+	free(t->out);
+	free(t->y);
+}
+
+/*
+ * Runs both versions over blocks of random, small and full scale input.
+ * The FIR write position starts from frame fir_frame of the delay line so
+ * that the wrap can be placed anywhere. Returns the number of FIR delay
+ * line wraps seen.
+ */
+static int test_src_stage(struct src_stage *stage, int nch, bool s16, int fir_frame,
+			  int runs)
+{
+	const int fir_words = nch * (stage->subfilter_length +
+				     (stage->num_of_subfilters - 1) * stage->idm + stage->blk_in);
+	const int out_words = nch * (1 + (stage->num_of_subfilters - 1) * stage->odm);
+	const int x_words = nch * (7 * stage->blk_in + 3);
+	const int y_words = nch * (5 * stage->num_of_subfilters + 1);
+	const size_t sample_bytes = s16 ? sizeof(int16_t) : sizeof(int32_t);
+	struct test_src ref;
+	struct test_src x86;
+	int32_t *x = malloc(x_words * sizeof(int32_t));
+	int32_t *wp;
+	int wraps = 0;
+	int run;
+	int i;
+
+	assert_non_null(x);
+	test_src_init(&ref, stage, nch, 1, fir_words, out_words, y_words, sample_bytes,
+		      x, x_words);
+	test_src_init(&x86, stage, nch, SRC_FIR_DELAY_COPIES, fir_words, out_words, y_words,
+		      sample_bytes, x, x_words);
+
+	ref.state.fir_wp = &ref.fir[fir_frame * nch + nch - 1];
+	x86.state.fir_wp = &x86.fir[fir_frame * nch + nch - 1];
+
+	for (run = 0; run < runs; run++) {
+		for (i = 0; i < x_words; i++) {
+			x[i] = test_rand();
+			if (run & 1)
+				x[i] >>= 10;
+			if (run % 7 == 3)
+				x[i] = (i & 1) ? INT32_MAX : INT32_MIN;
+		}
+
+		ref.prm.times = 1 + run % 4;
+		x86.prm.times = ref.prm.times;
+		ref.prm.x_rptr = (char *)x + ((run * 3) % (x_words / nch)) * nch * sample_bytes;
+		x86.prm.x_rptr = ref.prm.x_rptr;
+		wp = ref.state.fir_wp;
+
+		if (s16) {
+			src_polyphase_stage_cir_s16_ref(&ref.prm);
+			src_polyphase_stage_cir_s16(&x86.prm);
+		} else {
+			src_polyphase_stage_cir_ref(&ref.prm);
+			src_polyphase_stage_cir(&x86.prm);
+		}
+
+		/* the write position moves down and wraps to the end */
+		if (ref.state.fir_wp >= wp)
+			wraps++;
+
+		assert_memory_equal(ref.y, x86.y, y_words * sample_bytes);
+		assert_int_equal((char *)ref.prm.y_wptr - (char *)ref.y,
+				 (char *)x86.prm.y_wptr - (char *)x86.y);
+		assert_int_equal(ref.state.fir_wp - ref.fir, x86.state.fir_wp - x86.fir);
+		assert_int_equal(ref.state.out_rp - ref.out, x86.state.out_rp - x86.out);
+		assert_memory_equal(ref.out, x86.out, out_words * sizeof(int32_t));
+		assert_memory_equal(ref.fir, x86.fir, fir_words * sizeof(int32_t));
+		if (SRC_FIR_DELAY_COPIES > 1)
+			assert_memory_equal(x86.fir, x86.fir + fir_words,
+					    fir_words * sizeof(int32_t));
+	}
+
+	test_src_free(&ref);
+	test_src_free(&x86);
+	free(x);
+
+	return wraps;
+}
+
+static struct src_stage *test_table_stage(int table, int i, int j)
+{
+	return table ? src_table2[i][j] : src_table1[i][j];
+}
+
+#define TEST_TABLE_ROWS	ARRAY_SIZE(src_table1)
+#define TEST_TABLE_COLS	ARRAY_SIZE(src_table1[0])
+
+/* every stage of the coefficient set, all channel counts and formats */
+static void test_src_x86_all_stages(void **state)
+{
+	struct src_stage *stage;
+	int wraps = 0;
+	int table;
+	int nch;
+	int i;
+	int j;
+
+	(void)state;
+
+	for (table = 0; table < 2; table++)
+		for (i = 0; i < TEST_TABLE_ROWS; i++)
+			for (j = 0; j < TEST_TABLE_COLS; j++) {
+				stage = test_table_stage(table, i, j);
+				if (stage->filter_length <= 1)
+					continue;
+
+				for (nch = 1; nch <= TEST_MAX_CHANNELS; nch++) {
+					wraps += test_src_stage(stage, nch, false,
+								0, TEST_RUNS);
+					wraps += test_src_stage(stage, nch, true,
+								0, TEST_RUNS);
+				}
+			}
+
+	/* the runs are long enough to wrap the FIR delay lines */
+	assert_true(wraps > 0);
+}
+
+/*
+ * The wrap of the FIR delay line at every frame position, so that the
+ * block of each subfilter is split at every point for the generic version
+ * and read from the mirrored copy by the x86 version.
+ */
+static void test_src_x86_delay_wrap(void **state)
+{
+	struct src_stage *stage = NULL;
+	int fir_frames;
+	int frame;
+	int nch;
+	int i;
+	int j;
+
+	(void)state;
+
+	/* the first stage with more than one subfilter */
+	for (i = 0; i < TEST_TABLE_ROWS && !stage; i++)
+		for (j = 0; j < TEST_TABLE_COLS; j++) {
+			if (src_table1[i][j]->filter_length > 1 &&
+			    src_table1[i][j]->num_of_subfilters > 1) {
+				stage = src_table1[i][j];
+				break;
+			}
+		}
+
+	assert_non_null(stage);
+
+	fir_frames = stage->subfilter_length + (stage->num_of_subfilters - 1) * stage->idm +
+		stage->blk_in;
+
+	for (nch = 1; nch <= TEST_MAX_CHANNELS; nch++)
+		for (frame = 0; frame < fir_frames; frame++) {
+			test_src_stage(stage, nch, false, frame, 2);
+			test_src_stage(stage, nch, true, frame, 2);
+		}
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_src_x86_all_stages),
+		cmocka_unit_test(test_src_x86_delay_wrap),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
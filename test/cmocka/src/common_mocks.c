@@ -19,6 +19,7 @@
 #include <sof/audio/component_ext.h>
 #include <rtos/clk.h>
 #include <sof/lib/notifier.h>
+#include <sof/lib/slab.h>
 #include <rtos/wait.h>
 #include <arch/lib/cpu.h>
 #include <stdlib.h>
@@ -75,6 +76,19 @@ void WEAK rfree(void *ptr)
 	free(ptr);
 }
 
+void WEAK *slab_alloc(enum mem_zone zone, size_t bytes)
+{
+	return rzalloc(zone, 0, 0, bytes);
+}
+
+void WEAK slab_free(enum mem_zone zone, void *ptr, size_t bytes)
+{
+	(void)zone;
+	(void)bytes;
+
+	rfree(ptr);
+}
+
 int WEAK memcpy_s(void *dest, size_t dest_size,
 		  const void *src, size_t count)
 {
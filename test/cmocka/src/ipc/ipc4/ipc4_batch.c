@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/ipc/ipc4_batch.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#define TEST_WORDS	16
+
+/* SOF_IPC_MSG_MAX_SIZE, the reply has up to 96 status words */
+#define TEST_REPLY_SIZE	384
+#define TEST_MAX_MSGS	(TEST_REPLY_SIZE / sizeof(uint32_t))
+
+/* writes a MOD_INIT_INSTANCE header with the given payload size */
+static void test_put_init(uint32_t *words, uint32_t payload)
+{
+	struct ipc4_module_init_instance init = { 0 };
+
+	init.primary.r.msg_tgt = SOF_IPC4_MESSAGE_TARGET_MODULE_MSG;
+	init.primary.r.type = SOF_IPC4_MOD_INIT_INSTANCE;
+	init.extension.r.param_block_size = payload;
+
+	/* only the header words are in the batch */
+	words[0] = init.primary.dat;
+	words[1] = init.extension.dat;
+}
+
+/* writes a CREATE_PIPELINE header, it has no payload */
+static void test_put_pipeline(uint32_t *words)
+{
+	struct ipc4_message_request *msg = (struct ipc4_message_request *)words;
+
+	msg->primary.dat = 0;
+	msg->extension.dat = 0;
+	msg->primary.r.msg_tgt = SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG;
+	msg->primary.r.type = SOF_IPC4_GLB_CREATE_PIPELINE;
+}
+
+static void test_ipc4_batch_check(void **state)
+{
+	struct ipc4_batch batch = { 0 };
+
+	(void)state;
+
+	batch.primary.r.num_msgs = TEST_MAX_MSGS;
+	batch.extension.r.data_size = 64;
+	assert_int_equal(ipc4_batch_check(&batch, 64, TEST_REPLY_SIZE), 0);
+
+	/* status of each message must fit in the reply */
+	batch.primary.r.num_msgs = TEST_MAX_MSGS + 1;
+	assert_int_equal(ipc4_batch_check(&batch, 64, TEST_REPLY_SIZE),
+			 IPC4_ERROR_INVALID_PARAM);
+
+	batch.primary.r.num_msgs = 255;
+	assert_int_equal(ipc4_batch_check(&batch, 64, TEST_REPLY_SIZE),
+			 IPC4_ERROR_INVALID_PARAM);
+
+	/* messages must fit in the mailbox and be whole words */
+	batch.primary.r.num_msgs = 1;
+	batch.extension.r.data_size = 68;
+	assert_int_equal(ipc4_batch_check(&batch, 64, TEST_REPLY_SIZE),
+			 IPC4_ERROR_INVALID_PARAM);
+
+	batch.extension.r.data_size = 62;
+	assert_int_equal(ipc4_batch_check(&batch, 64, TEST_REPLY_SIZE),
+			 IPC4_ERROR_INVALID_PARAM);
+}
+
+/* messages with and without payload are walked in order */
+static void test_ipc4_batch_next(void **state)
+{
+	struct ipc4_message_request *msg;
+	uint32_t words[TEST_WORDS] = { 0 };
+	uint32_t payload;
+	uint32_t pos = 0;
+
+	(void)state;
+
+	test_put_pipeline(words);
+	test_put_init(words + 2, 3);
+	test_put_init(words + 7, 0);
+
+	assert_int_equal(ipc4_batch_next(words, 9, &pos, &msg, &payload), 0);
+	assert_ptr_equal(msg, words);
+	assert_int_equal(payload, 0);
+	assert_int_equal(pos, 2);
+
+	assert_int_equal(ipc4_batch_next(words, 9, &pos, &msg, &payload), 0);
+	assert_ptr_equal(msg, words + 2);
+	assert_int_equal(payload, 3);
+	assert_int_equal(pos, 7);
+
+	assert_int_equal(ipc4_batch_next(words, 9, &pos, &msg, &payload), 0);
+	assert_ptr_equal(msg, words + 7);
+	assert_int_equal(payload, 0);
+	assert_int_equal(pos, 9);
+
+	/* more messages than the data holds */
+	assert_int_equal(ipc4_batch_next(words, 9, &pos, &msg, &payload),
+			 IPC4_ERROR_INVALID_PARAM);
+	assert_int_equal(pos, 9);
+}
+
+/* header or payload cut by the end of the batch */
+static void test_ipc4_batch_truncated(void **state)
+{
+	struct ipc4_message_request *msg;
+	uint32_t words[TEST_WORDS] = { 0 };
+	uint32_t payload;
+	uint32_t pos;
+
+	(void)state;
+
+	test_put_init(words, 4);
+
+	/* half a header */
+	pos = 0;
+	assert_int_equal(ipc4_batch_next(words, 1, &pos, &msg, &payload),
+			 IPC4_ERROR_INVALID_PARAM);
+	assert_int_equal(pos, 0);
+
+	/* payload one word short */
+	assert_int_equal(ipc4_batch_next(words, 5, &pos, &msg, &payload),
+			 IPC4_ERROR_INVALID_PARAM);
+	assert_int_equal(pos, 0);
+
+	assert_int_equal(ipc4_batch_next(words, 6, &pos, &msg, &payload), 0);
+	assert_int_equal(pos, 6);
+
+	/* largest payload the header can claim doesn't wrap the check */
+	test_put_init(words, 0xffff);
+	pos = 0;
+	assert_int_equal(ipc4_batch_next(words, TEST_WORDS, &pos, &msg, &payload),
+			 IPC4_ERROR_INVALID_PARAM);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_ipc4_batch_check),
+		cmocka_unit_test(test_ipc4_batch_next),
+		cmocka_unit_test(test_ipc4_batch_truncated),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <rtos/alloc.h>
+#include <sof/lib/slab.h>
+#include <ipc/topology.h>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cmocka.h>
+
+#define BENCH_LOOPS	100000
+#define BENCH_OBJECTS	16
+
+static int heap_chunks;
+
+/* chunk allocations of the slab caches */
+void *rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)flags;
+	(void)caps;
+
+	heap_chunks++;
+	return malloc(bytes);
+}
+
+static void get_stats(enum mem_zone zone, size_t bytes, struct slab_stats *stats)
+{
+	assert_int_equal(slab_get_stats(0, zone, bytes, stats), 0);
+}
+
+static void test_lib_slab_reuse(void **state)
+{
+	uint8_t *a, *b;
+	size_t i;
+
+	(void)state;
+
+	a = slab_alloc(SOF_MEM_ZONE_RUNTIME, 100);
+	assert_non_null(a);
+	memset(a, 0xa5, 100);
+	slab_free(SOF_MEM_ZONE_RUNTIME, a, 100);
+
+	/* same size class, last freed object is returned first and zeroed */
+	b = slab_alloc(SOF_MEM_ZONE_RUNTIME, 128);
+	assert_ptr_equal(a, b);
+	for (i = 0; i < 128; i++)
+		assert_int_equal(b[i], 0);
+
+	slab_free(SOF_MEM_ZONE_RUNTIME, b, 128);
+}
+
+static void test_lib_slab_stats(void **state)
+{
+	const size_t size = 256;
+	const int per_chunk = SLAB_CHUNK_SIZE / size;
+	const int count = 3 * per_chunk + 1;
+	struct slab_stats before, stats;
+	void *obj[3 * SLAB_CHUNK_SIZE / 256 + 1];
+	int chunks = heap_chunks;
+	int i;
+
+	(void)state;
+
+	get_stats(SOF_MEM_ZONE_RUNTIME_SHARED, size, &before);
+	assert_int_equal(before.in_use, 0);
+
+	for (i = 0; i < count; i++) {
+		obj[i] = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED, size);
+		assert_non_null(obj[i]);
+	}
+
+	get_stats(SOF_MEM_ZONE_RUNTIME_SHARED, size, &stats);
+	assert_int_equal(stats.in_use, count);
+	assert_int_equal(stats.high_water, count);
+	assert_int_equal(stats.misses - before.misses, 4);
+	assert_int_equal(stats.free, 4 * per_chunk - count);
+	assert_int_equal(heap_chunks - chunks, 4);
+
+	for (i = 0; i < count; i++)
+		slab_free(SOF_MEM_ZONE_RUNTIME_SHARED, obj[i], size);
+
+	get_stats(SOF_MEM_ZONE_RUNTIME_SHARED, size, &stats);
+	assert_int_equal(stats.in_use, 0);
+	assert_int_equal(stats.high_water, count);
+	assert_int_equal(stats.free, 4 * per_chunk);
+
+	/* allocations from the free list do not touch the heap */
+	chunks = heap_chunks;
+	for (i = 0; i < count; i++)
+		obj[i] = slab_alloc(SOF_MEM_ZONE_RUNTIME_SHARED, size);
+
+	for (i = 0; i < count; i++)
+		slab_free(SOF_MEM_ZONE_RUNTIME_SHARED, obj[i], size);
+
+	get_stats(SOF_MEM_ZONE_RUNTIME_SHARED, size, &stats);
+	assert_int_equal(heap_chunks, chunks);
+	assert_int_equal(stats.misses - before.misses, 4);
+}
+
+static void test_lib_slab_fallback(void **state)
+{
+	struct slab_stats stats;
+	int chunks = heap_chunks;
+	void *obj;
+
+	(void)state;
+
+	/* too big objects and other zones use the heap directly */
+	obj = slab_alloc(SOF_MEM_ZONE_RUNTIME, SLAB_OBJECT_MAX_SIZE + 1);
+	assert_non_null(obj);
+	slab_free(SOF_MEM_ZONE_RUNTIME, obj, SLAB_OBJECT_MAX_SIZE + 1);
+
+	obj = slab_alloc(SOF_MEM_ZONE_SYS_RUNTIME, 64);
+	assert_non_null(obj);
+	slab_free(SOF_MEM_ZONE_SYS_RUNTIME, obj, 64);
+
+	assert_int_equal(heap_chunks, chunks);
+
+	assert_int_equal(slab_get_stats(0, SOF_MEM_ZONE_RUNTIME, SLAB_OBJECT_MAX_SIZE + 1,
+					&stats), -EINVAL);
+	assert_int_equal(slab_get_stats(0, SOF_MEM_ZONE_RUNTIME, 0, &stats), -EINVAL);
+	assert_int_equal(slab_get_stats(0, SOF_MEM_ZONE_SYS, 64, &stats), -EINVAL);
+	assert_int_equal(slab_get_stats(CONFIG_CORE_COUNT, SOF_MEM_ZONE_RUNTIME, 64, &stats),
+			 -EINVAL);
+	assert_int_equal(slab_get_stats(0, SOF_MEM_ZONE_RUNTIME, 64, NULL), -EINVAL);
+}
+
+static double bench_ns(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+/* Informative only, prints the cost of an alloc and free pair */
+static void test_lib_slab_bench(void **state)
+{
+	struct timespec start, end;
+	void *obj[BENCH_OBJECTS];
+	const size_t size = 200;
+	double slab_ns, heap_ns;
+	int i, j;
+
+	(void)state;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_LOOPS; i++) {
+		for (j = 0; j < BENCH_OBJECTS; j++)
+			obj[j] = slab_alloc(SOF_MEM_ZONE_RUNTIME, size);
+		for (j = 0; j < BENCH_OBJECTS; j++)
+			slab_free(SOF_MEM_ZONE_RUNTIME, obj[j], size);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	slab_ns = bench_ns(&start, &end);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_LOOPS; i++) {
+		for (j = 0; j < BENCH_OBJECTS; j++)
+			obj[j] = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+		for (j = 0; j < BENCH_OBJECTS; j++)
+			rfree(obj[j]);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	heap_ns = bench_ns(&start, &end);
+
+	printf("%s: slab %.1f ns, heap %.1f ns per alloc and free\n", __func__,
+	       slab_ns / (BENCH_LOOPS * BENCH_OBJECTS),
+	       heap_ns / (BENCH_LOOPS * BENCH_OBJECTS));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_lib_slab_reuse),
+		cmocka_unit_test(test_lib_slab_stats),
+		cmocka_unit_test(test_lib_slab_fallback),
+		cmocka_unit_test(test_lib_slab_bench),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -21,6 +21,9 @@
 
 #define MATRIX_MULT_16_MAX_ERROR_ABS  2.5
 #define MATRIX_MULT_16_MAX_ERROR_RMS  1.1
+#define DCT_TABLE_16_MAX_ERROR_ABS  3.0
+#define DCT_TABLE_16_MAX_ERROR_RMS  1.0
+#define DCT_TABLE_16_TEST_VECTORS  100
 
 static void dct_matrix_16_test(const int16_t *ref, int num_in, int num_out,
 			       enum dct_type type, bool ortho)
@@ -93,11 +96,92 @@ static void test_dct_matrix_16_test2(void **state)
 			   DCT_MATRIX_16_TEST2_ORTHO);
 }
 
+/* Compare DCT with table to floating point DCT-II for random input vectors.
+ * The input and output are Q8.7 as with Mel log energies and cepstral
+ * coefficients.
+ */
+static void dct_table_16_test(int num_in, int num_out)
+{
+	struct dct_plan_16 dct;
+	int16_t in[DCT_MATRIX_SIZE_MAX];
+	int16_t out[DCT_MATRIX_SIZE_MAX];
+	uint32_t seed = 1;
+	double delta;
+	double sum_squares = 0;
+	double error_rms;
+	double delta_max = 0;
+	double ref;
+	double c;
+	int ret;
+	int i, n, k;
+
+	dct.num_in = num_in;
+	dct.num_out = num_out;
+	dct.type = DCT_II;
+	dct.ortho = true;
+	ret = dct_initialize_table_16(&dct);
+	if (ret) {
+		fprintf(stderr, "Failed to initialize DCT.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < DCT_TABLE_16_TEST_VECTORS; i++) {
+		/* Random values in range -64.0 to +64.0 */
+		for (n = 0; n < num_in; n++) {
+			seed = seed * 1664525 + 1013904223;
+			in[n] = (int32_t)seed >> 19;
+		}
+
+		dct_execute_16(&dct, in, out);
+
+		for (k = 0; k < num_out; k++) {
+			ref = 0;
+			for (n = 0; n < num_in; n++)
+				ref += in[n] * cos(M_PI * (2 * n + 1) * k / (2 * num_in));
+
+			c = sqrt(2.0 / num_in);
+			if (k == 0)
+				c *= M_SQRT1_2;
+
+			delta = c * ref - (double)out[k];
+			sum_squares += delta * delta;
+			if (delta > delta_max)
+				delta_max = delta;
+			else if (-delta > delta_max)
+				delta_max = -delta;
+		}
+	}
+
+	error_rms = sqrt(sum_squares / (double)(DCT_TABLE_16_TEST_VECTORS * num_out));
+	printf("Max absolute error = %5.2f (max %5.2f), error RMS = %5.2f (max %5.2f)\n",
+	       delta_max, DCT_TABLE_16_MAX_ERROR_ABS, error_rms, DCT_TABLE_16_MAX_ERROR_RMS);
+
+	rfree(dct.cos_table);
+	assert_true(error_rms < DCT_TABLE_16_MAX_ERROR_RMS);
+	assert_true(delta_max < DCT_TABLE_16_MAX_ERROR_ABS);
+}
+
+static void test_dct_table_16_test1(void **state)
+{
+	(void)state;
+
+	dct_table_16_test(DCT_MATRIX_16_TEST1_NUM_IN, DCT_MATRIX_16_TEST1_NUM_OUT);
+}
+
+static void test_dct_table_16_test2(void **state)
+{
+	(void)state;
+
+	dct_table_16_test(DCT_MATRIX_16_TEST2_NUM_IN, DCT_MATRIX_16_TEST2_NUM_OUT);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
 		cmocka_unit_test(test_dct_matrix_16_test1),
 		cmocka_unit_test(test_dct_matrix_16_test2),
+		cmocka_unit_test(test_dct_table_16_test1),
+		cmocka_unit_test(test_dct_table_16_test2),
 	};
 
 	cmocka_set_message_output(CM_OUTPUT_TAP);
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <math.h>
+#include <cmocka.h>
+#include <stdbool.h>
+
+#include <sof/audio/format.h>
+#include <sof/math/fft.h>
+
+/* The real FFT may be at most this much worse in SNR vs. reference than
+ * the complex FFT with zero imaginary part
+ */
+#define MAX_SNR_LOSS_DB		3.0
+
+/* Min. SNR in dB vs. reference for FFT up to size 1024 and for IFFT round
+ * trip of size 256, the spectrum is scaled by 1/N so the round trip SNR
+ * drops with the size.
+ */
+#define MIN_SNR_FFT_32		110.0
+#define MIN_SNR_FFT_16		25.0
+#define MIN_SNR_IFFT_256_32	95.0
+#define MIN_SNR_IFFT_256_16	15.0
+
+#define TWO_PI			6.28318530717959
+#define TEST_FS			48000.0
+#define TEST_MAX_SIZE		FFT_SIZE_MAX
+
+static double ref_real[TEST_MAX_SIZE / 2 + 1];
+static double ref_imag[TEST_MAX_SIZE / 2 + 1];
+static double test_in[TEST_MAX_SIZE];
+static int32_t real_buf_32[TEST_MAX_SIZE];
+static int16_t real_buf_16[TEST_MAX_SIZE];
+static struct icomplex32 cin_32[TEST_MAX_SIZE];
+static struct icomplex32 cout_32[TEST_MAX_SIZE];
+static struct icomplex32 rout_32[TEST_MAX_SIZE / 2 + 1];
+static struct icomplex16 cin_16[TEST_MAX_SIZE];
+static struct icomplex16 cout_16[TEST_MAX_SIZE];
+static struct icomplex16 rout_16[TEST_MAX_SIZE / 2 + 1];
+
+/* Two sine waves and pseudo random noise at -6 dBFS, quantized to the test
+ * word length, and the DFT reference scaled by 1/N as in the FFT library.
+ */
+static void test_signal(int size, double scale)
+{
+	uint32_t seed = 1;
+	double noise;
+	double c;
+	int i;
+	int k;
+
+	for (i = 0; i < size; i++) {
+		seed = seed * 1664525 + 1013904223;
+		noise = (double)(int32_t)seed / 2147483648.0;
+		test_in[i] = round(scale * (0.25 * sin(TWO_PI * 997.0 * i / TEST_FS) +
+					    0.125 * sin(TWO_PI * 5003.0 * i / TEST_FS) +
+					    0.125 * noise));
+	}
+
+	for (k = 0; k <= size / 2; k++) {
+		ref_real[k] = 0;
+		ref_imag[k] = 0;
+		for (i = 0; i < size; i++) {
+			c = TWO_PI * ((i * k) % size) / size;
+			ref_real[k] += test_in[i] * cos(c) / size;
+			ref_imag[k] -= test_in[i] * sin(c) / size;
+		}
+	}
+}
+
+static double snr_db(double signal, double noise)
+{
+	if (noise == 0)
+		return 200.0;
+
+	return 10 * log10(signal / noise);
+}
+
+#define SPECTRUM_SNR(out, size) ({					\
+	double _s = 0, _n = 0, _dr, _di;				\
+	int _k;								\
+	for (_k = 0; _k <= (size) / 2; _k++) {				\
+		_dr = (out)[_k].real - ref_real[_k];			\
+		_di = (out)[_k].imag - ref_imag[_k];			\
+		_s += ref_real[_k] * ref_real[_k] + ref_imag[_k] * ref_imag[_k]; \
+		_n += _dr * _dr + _di * _di;				\
+	}								\
+	snr_db(_s, _n); })
+
+#define SIGNAL_SNR(out, size) ({					\
+	double _s = 0, _n = 0, _d;					\
+	int _i;								\
+	for (_i = 0; _i < (size); _i++) {				\
+		_d = (out)[_i] - test_in[_i];				\
+		_s += test_in[_i] * test_in[_i];			\
+		_n += _d * _d;						\
+	}								\
+	snr_db(_s, _n); })
+
+static void fft_real_vs_complex_32(int size)
+{
+	struct fft_plan *cplan;
+	struct fft_plan *rplan;
+	double snr_c, snr_r;
+	int i;
+
+	cplan = fft_plan_new(cin_32, cout_32, size, 32);
+	rplan = fft_plan_new_real(real_buf_32, rout_32, size, 32);
+	assert_non_null(cplan);
+	assert_non_null(rplan);
+
+	test_signal(size, 2147483647.0);
+	for (i = 0; i < size; i++) {
+		real_buf_32[i] = (int32_t)test_in[i];
+		cin_32[i].real = (int32_t)test_in[i];
+		cin_32[i].imag = 0;
+	}
+
+	fft_execute_32(cplan, false);
+	fft_execute_real_32(rplan, false);
+
+	snr_c = SPECTRUM_SNR(cout_32, size);
+	snr_r = SPECTRUM_SNR(rout_32, size);
+	printf("%s: size %d, SNR complex %6.2f dB, real %6.2f dB\n",
+	       __func__, size, snr_c, snr_r);
+	assert_true(snr_r > snr_c - MAX_SNR_LOSS_DB);
+	assert_true(snr_r > MIN_SNR_FFT_32);
+
+	fft_plan_free(cplan);
+	fft_plan_free(rplan);
+}
+
+static void fft_real_ifft_32(int size, double min_snr)
+{
+	struct fft_plan *cplan;
+	struct fft_plan *rplan;
+	double snr_c, snr_r;
+	int32_t out_c[TEST_MAX_SIZE];
+	int i;
+
+	cplan = fft_plan_new(cin_32, cout_32, size, 32);
+	rplan = fft_plan_new_real(real_buf_32, rout_32, size, 32);
+	assert_non_null(cplan);
+	assert_non_null(rplan);
+
+	test_signal(size, 2147483647.0);
+	for (i = 0; i < size; i++)
+		real_buf_32[i] = (int32_t)test_in[i];
+
+	fft_execute_real_32(rplan, false);
+
+	/* complex IFFT of the same spectrum with the conjugate symmetric half */
+	for (i = 0; i <= size / 2; i++)
+		cin_32[i] = rout_32[i];
+
+	for (i = size / 2 + 1; i < size; i++) {
+		cin_32[i].real = rout_32[size - i].real;
+		cin_32[i].imag = -rout_32[size - i].imag;
+	}
+
+	fft_execute_real_32(rplan, true);
+	fft_execute_32(cplan, true);
+	for (i = 0; i < size; i++)
+		out_c[i] = cout_32[i].real;
+
+	snr_c = SIGNAL_SNR(out_c, size);
+	snr_r = SIGNAL_SNR(real_buf_32, size);
+	printf("%s: size %d, SNR complex %6.2f dB, real %6.2f dB\n",
+	       __func__, size, snr_c, snr_r);
+	assert_true(snr_r > snr_c - MAX_SNR_LOSS_DB);
+	assert_true(snr_r > min_snr);
+
+	fft_plan_free(cplan);
+	fft_plan_free(rplan);
+}
+
+static void fft_real_vs_complex_16(int size)
+{
+	struct fft_plan *cplan;
+	struct fft_plan *rplan;
+	double snr_c, snr_r;
+	int i;
+
+	cplan = fft_plan_new(cin_16, cout_16, size, 16);
+	rplan = fft_plan_new_real(real_buf_16, rout_16, size, 16);
+	assert_non_null(cplan);
+	assert_non_null(rplan);
+
+	test_signal(size, 32767.0);
+	for (i = 0; i < size; i++) {
+		real_buf_16[i] = (int16_t)test_in[i];
+		cin_16[i].real = (int16_t)test_in[i];
+		cin_16[i].imag = 0;
+	}
+
+	fft_execute_16(cplan, false);
+	fft_execute_real_16(rplan, false);
+
+	snr_c = SPECTRUM_SNR(cout_16, size);
+	snr_r = SPECTRUM_SNR(rout_16, size);
+	printf("%s: size %d, SNR complex %6.2f dB, real %6.2f dB\n",
+	       __func__, size, snr_c, snr_r);
+	assert_true(snr_r > snr_c - MAX_SNR_LOSS_DB);
+	assert_true(snr_r > MIN_SNR_FFT_16);
+
+	fft_plan_free(cplan);
+	fft_plan_free(rplan);
+}
+
+static void fft_real_ifft_16(int size, double min_snr)
+{
+	struct fft_plan *cplan;
+	struct fft_plan *rplan;
+	double snr_c, snr_r;
+	int16_t out_c[TEST_MAX_SIZE];
+	int i;
+
+	cplan = fft_plan_new(cin_16, cout_16, size, 16);
+	rplan = fft_plan_new_real(real_buf_16, rout_16, size, 16);
+	assert_non_null(cplan);
+	assert_non_null(rplan);
+
+	test_signal(size, 32767.0);
+	for (i = 0; i < size; i++)
+		real_buf_16[i] = (int16_t)test_in[i];
+
+	fft_execute_real_16(rplan, false);
+
+	for (i = 0; i <= size / 2; i++)
+		cin_16[i] = rout_16[i];
+
+	for (i = size / 2 + 1; i < size; i++) {
+		cin_16[i].real = rout_16[size - i].real;
+		cin_16[i].imag = -rout_16[size - i].imag;
+	}
+
+	fft_execute_real_16(rplan, true);
+	fft_execute_16(cplan, true);
+	for (i = 0; i < size; i++)
+		out_c[i] = cout_16[i].real;
+
+	snr_c = SIGNAL_SNR(out_c, size);
+	snr_r = SIGNAL_SNR(real_buf_16, size);
+	printf("%s: size %d, SNR complex %6.2f dB, real %6.2f dB\n",
+	       __func__, size, snr_c, snr_r);
+	assert_true(snr_r > snr_c - MAX_SNR_LOSS_DB);
+	assert_true(snr_r > min_snr);
+
+	fft_plan_free(cplan);
+	fft_plan_free(rplan);
+}
+
+static void test_math_fft_real_32(void **state)
+{
+	int size;
+
+	(void)state;
+
+	for (size = 4; size <= FFT_SIZE_MAX; size <<= 1)
+		fft_real_vs_complex_32(size);
+}
+
+static void test_math_fft_real_ifft_32(void **state)
+{
+	(void)state;
+
+	fft_real_ifft_32(256, MIN_SNR_IFFT_256_32);
+	fft_real_ifft_32(512, 0);
+	fft_real_ifft_32(1024, 0);
+}
+
+static void test_math_fft_real_16(void **state)
+{
+	int size;
+
+	(void)state;
+
+	for (size = 4; size <= FFT_SIZE_MAX; size <<= 1)
+		fft_real_vs_complex_16(size);
+}
+
+static void test_math_fft_real_ifft_16(void **state)
+{
+	(void)state;
+
+	fft_real_ifft_16(256, MIN_SNR_IFFT_256_16);
+	fft_real_ifft_16(512, 0);
+	fft_real_ifft_16(1024, 0);
+}
+
+static void test_math_fft_real_plan(void **state)
+{
+	(void)state;
+
+	/* size must be a power of two from 4 to FFT_SIZE_MAX */
+	assert_null(fft_plan_new_real(real_buf_32, rout_32, 2, 32));
+	assert_null(fft_plan_new_real(real_buf_32, rout_32, 384, 32));
+	assert_null(fft_plan_new_real(real_buf_32, rout_32, 2 * FFT_SIZE_MAX, 32));
+	assert_null(fft_plan_new_real(real_buf_32, rout_32, 256, 24));
+	assert_null(fft_plan_new_real(NULL, rout_32, 256, 32));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_math_fft_real_plan),
+		cmocka_unit_test(test_math_fft_real_32),
+		cmocka_unit_test(test_math_fft_real_ifft_32),
+		cmocka_unit_test(test_math_fft_real_16),
+		cmocka_unit_test(test_math_fft_real_ifft_16),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
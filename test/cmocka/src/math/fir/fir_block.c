@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <string.h>
+#include <cmocka.h>
+#include <sof/math/fir_generic.h>
+#include <user/fir.h>
+#include <rtos/string.h>
+
+#define TEST_MAX_FRAMES		70
+#define TEST_CALLS		12
+#define TEST_DELAY_LENGTH	(SOF_FIR_MAX_LENGTH + 4)
+
+static int16_t coef[SOF_FIR_MAX_LENGTH];
+static int32_t delay_ref[TEST_DELAY_LENGTH];
+static int32_t delay_block[TEST_DELAY_LENGTH];
+static int32_t x[TEST_CALLS * TEST_MAX_FRAMES];
+static int32_t y_ref[TEST_CALLS * TEST_MAX_FRAMES];
+static int32_t y_block[TEST_CALLS * TEST_MAX_FRAMES];
+static int32_t block_in[SOF_FIR_MAX_LENGTH - 1 + TEST_MAX_FRAMES];
+
+static uint32_t rand_state = 1;
+
+static int32_t test_rand(void)
+{
+	rand_state = rand_state * 1664525 + 1013904223;
+	return (int32_t)rand_state;
+}
+
+static void test_fir_init(struct fir_state_32x16 *fir, int32_t *delay, int taps, int out_shift)
+{
+	memset(fir, 0, sizeof(*fir));
+	memset(delay, 0, TEST_DELAY_LENGTH * sizeof(int32_t));
+	fir->taps = taps;
+	fir->length = taps + 2;
+	fir->out_shift = out_shift;
+	fir->coef = coef;
+	fir->delay = delay;
+}
+
+/* Filters random blocks with fir_32x16_block() and the same input as
+ * pairs of samples with fir_32x16_2x(). The lengths of the blocks vary
+ * and the long ones are longer than the delay line.
+ */
+static void test_fir_block(int taps, bool full_scale)
+{
+	struct fir_state_32x16 fir_ref;
+	struct fir_state_32x16 fir_block;
+	int32_t *in = &block_in[SOF_FIR_MAX_LENGTH - 1];
+	int out_shift;
+	int frames;
+	int pos = 0;
+	int i;
+	int n;
+
+	for (i = 0; i < taps; i++)
+		coef[i] = full_scale ? INT16_MIN : test_rand() >> 16;
+
+	out_shift = full_scale ? 0 : (uint32_t)test_rand() % 4;
+	test_fir_init(&fir_ref, delay_ref, taps, out_shift);
+	test_fir_init(&fir_block, delay_block, taps, out_shift);
+
+	for (i = 0; i < TEST_CALLS * TEST_MAX_FRAMES; i++)
+		x[i] = full_scale ? INT32_MIN : test_rand();
+
+	for (n = 0; n < TEST_CALLS; n++) {
+		frames = 2 * ((uint32_t)test_rand() % (TEST_MAX_FRAMES / 2 + 1));
+		for (i = 0; i < frames; i += 2)
+			fir_32x16_2x(&fir_ref, x[pos + i], x[pos + i + 1], &y_ref[pos + i],
+				     &y_ref[pos + i + 1]);
+
+		memcpy_s(in, frames * sizeof(int32_t), &x[pos], frames * sizeof(int32_t));
+		fir_32x16_block(&fir_block, in, &y_block[pos], frames);
+
+		assert_memory_equal(&y_ref[pos], &y_block[pos], frames * sizeof(int32_t));
+		assert_int_equal(fir_ref.rwi, fir_block.rwi);
+		assert_memory_equal(delay_ref, delay_block, fir_ref.length * sizeof(int32_t));
+		pos += frames;
+	}
+}
+
+static void test_math_fir_block_taps(void **state)
+{
+	int taps;
+
+	(void)state;
+
+	for (taps = 4; taps <= 64; taps += 4)
+		test_fir_block(taps, false);
+
+	test_fir_block(SOF_FIR_MAX_LENGTH, false);
+}
+
+static void test_math_fir_block_saturate(void **state)
+{
+	(void)state;
+
+	test_fir_block(8, true);
+	test_fir_block(SOF_FIR_MAX_LENGTH, true);
+}
+
+/* Odd lengths are possible in the linear version */
+static void test_math_fir_linear_odd(void **state)
+{
+	struct fir_state_32x16 fir;
+	int32_t *in = &block_in[SOF_FIR_MAX_LENGTH - 1];
+	int64_t a;
+	int taps = 36;
+	int frames;
+	int i;
+	int j;
+
+	(void)state;
+
+	for (i = 0; i < taps; i++)
+		coef[i] = test_rand() >> 16;
+
+	test_fir_init(&fir, delay_block, taps, 1);
+	for (i = 0; i < SOF_FIR_MAX_LENGTH - 1 + TEST_MAX_FRAMES; i++)
+		block_in[i] = test_rand();
+
+	for (frames = 1; frames < TEST_MAX_FRAMES; frames += 2) {
+		fir_32x16_linear(&fir, in, y_block, frames);
+		for (j = 0; j < frames; j++) {
+			a = 0;
+			for (i = 0; i < taps; i++)
+				a += (int64_t)coef[i] * in[j - i];
+
+			assert_int_equal(y_block[j], sat_int32(a >> 16));
+		}
+	}
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_math_fir_block_taps),
+		cmocka_unit_test(test_math_fir_block_saturate),
+		cmocka_unit_test(test_math_fir_linear_odd),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <string.h>
+#include <cmocka.h>
+#include <sof/audio/format.h>
+#include <sof/math/iir_df1.h>
+#include <sof/math/iir_df2t.h>
+#include <sof/math/numbers.h>
+#include <user/eq.h>
+
+#define TEST_CHANNELS		8
+#define TEST_FRAMES		96
+#define TEST_BIQUADS		4
+
+/* Random coefficients are not stable filters, the outputs saturate often
+ * which checks also the saturation of the SIMD lanes.
+ */
+static uint32_t rand_state = 1;
+
+static int32_t test_rand(void)
+{
+	rand_state = rand_state * 1664525 + 1013904223;
+	return (int32_t)rand_state;
+}
+
+struct test_filters {
+	int32_t coef[TEST_CHANNELS][TEST_BIQUADS * SOF_EQ_IIR_NBIQUAD];
+	int32_t delay_df1[2][TEST_CHANNELS][TEST_BIQUADS * IIR_DF1_NUM_STATE];
+	int64_t delay_df2t[2][TEST_CHANNELS][TEST_BIQUADS * IIR_DF2T_NUM_DELAYS];
+	struct iir_state_df1 df1[2][TEST_CHANNELS];
+	struct iir_state_df2t df2t[2][TEST_CHANNELS];
+	struct iir_state_df1 *df1_ptr[TEST_CHANNELS];
+	struct iir_state_df2t *df2t_ptr[TEST_CHANNELS];
+};
+
+static struct test_filters tf;
+
+/* with mixed set channel 1 is bypassed and channel 2 has other layout */
+static void test_filters_init(int nch, bool mixed)
+{
+	int biquads;
+	int series;
+	int ch;
+	int i;
+	int j;
+
+	memset(&tf, 0, sizeof(tf));
+	rand_state = nch;
+	for (ch = 0; ch < nch; ch++) {
+		biquads = TEST_BIQUADS;
+		series = 2;
+		if (mixed && ch == 1)
+			biquads = 0;
+		else if (mixed && ch == 2)
+			series = TEST_BIQUADS;
+
+		for (i = 0; i < biquads; i++) {
+			for (j = 0; j < 5; j++)
+				tf.coef[ch][i * SOF_EQ_IIR_NBIQUAD + j] = test_rand();
+			tf.coef[ch][i * SOF_EQ_IIR_NBIQUAD + 5] = (uint32_t)test_rand() % 4;
+			tf.coef[ch][i * SOF_EQ_IIR_NBIQUAD + 6] = test_rand() >> 16;
+		}
+
+		for (i = 0; i < 2; i++) {
+			tf.df1[i][ch].biquads = biquads;
+			tf.df1[i][ch].biquads_in_series = series;
+			tf.df1[i][ch].coef = tf.coef[ch];
+			tf.df1[i][ch].delay = tf.delay_df1[i][ch];
+			tf.df2t[i][ch].biquads = biquads;
+			tf.df2t[i][ch].biquads_in_series = series;
+			tf.df2t[i][ch].coef = tf.coef[ch];
+			tf.df2t[i][ch].delay = tf.delay_df2t[i][ch];
+		}
+
+		tf.df1_ptr[ch] = &tf.df1[1][ch];
+		tf.df2t_ptr[ch] = &tf.df2t[1][ch];
+	}
+}
+
+static void test_iir_multich(int nch, bool mixed, bool df2t)
+{
+	int32_t x[TEST_FRAMES * TEST_CHANNELS];
+	int32_t ref[TEST_FRAMES * TEST_CHANNELS];
+	int32_t y[TEST_FRAMES * TEST_CHANNELS];
+	int frames;
+	int done;
+	int i;
+
+	test_filters_init(nch, mixed);
+
+	for (i = 0; i < TEST_FRAMES * nch; i++) {
+		/* mix of full scale and small inputs */
+		x[i] = test_rand();
+		if (i & 4)
+			x[i] >>= 12;
+	}
+
+	for (i = 0; i < TEST_FRAMES * nch; i++) {
+		if (df2t)
+			ref[i] = iir_df2t(&tf.df2t[0][i % nch], x[i]);
+		else
+			ref[i] = iir_df1(&tf.df1[0][i % nch], x[i]);
+	}
+
+	/* calls of varying length check the delay lines between calls */
+	for (done = 0, frames = 1; done < TEST_FRAMES; done += frames, frames++) {
+		frames = MIN(frames, TEST_FRAMES - done);
+		if (df2t)
+			iir_df2t_multich(tf.df2t_ptr, nch, &x[done * nch], &y[done * nch], frames);
+		else
+			iir_df1_multich(tf.df1_ptr, nch, &x[done * nch], &y[done * nch], frames);
+	}
+
+	assert_memory_equal(ref, y, TEST_FRAMES * nch * sizeof(int32_t));
+	if (df2t)
+		assert_memory_equal(tf.delay_df2t[0], tf.delay_df2t[1], sizeof(tf.delay_df2t[0]));
+	else
+		assert_memory_equal(tf.delay_df1[0], tf.delay_df1[1], sizeof(tf.delay_df1[0]));
+
+	/* in place */
+	test_filters_init(nch, mixed);
+	for (i = 0; i < TEST_FRAMES * nch; i++)
+		y[i] = x[i];
+	if (df2t)
+		iir_df2t_multich(tf.df2t_ptr, nch, y, y, TEST_FRAMES);
+	else
+		iir_df1_multich(tf.df1_ptr, nch, y, y, TEST_FRAMES);
+	assert_memory_equal(ref, y, TEST_FRAMES * nch * sizeof(int32_t));
+}
+
+static void test_math_iir_df1_multich(void **state)
+{
+	int nch;
+
+	(void)state;
+
+	for (nch = 1; nch <= TEST_CHANNELS; nch++)
+		test_iir_multich(nch, false, false);
+}
+
+static void test_math_iir_df1_multich_mixed(void **state)
+{
+	(void)state;
+
+	test_iir_multich(3, true, false);
+	test_iir_multich(TEST_CHANNELS, true, false);
+}
+
+static void test_math_iir_df2t_multich(void **state)
+{
+	int nch;
+
+	(void)state;
+
+	for (nch = 1; nch <= TEST_CHANNELS; nch++)
+		test_iir_multich(nch, false, true);
+}
+
+static void test_math_iir_df2t_multich_mixed(void **state)
+{
+	(void)state;
+
+	test_iir_multich(3, true, true);
+	test_iir_multich(TEST_CHANNELS, true, true);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_math_iir_df1_multich),
+		cmocka_unit_test(test_math_iir_df1_multich_mixed),
+		cmocka_unit_test(test_math_iir_df2t_multich),
+		cmocka_unit_test(test_math_iir_df2t_multich_mixed),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -12,9 +12,12 @@
 #include <stddef.h>
 #include <setjmp.h>
 #include <string.h>
+#include <time.h>
 #include <cmocka.h>
 #include <math.h>
+#include <sof/common.h>
 #include <sof/math/matrix.h>
+#include <sof/math/numbers.h>
 #include "ref_matrix_mult_16_test1.h"
 #include "ref_matrix_mult_16_test2.h"
 #include "ref_matrix_mult_16_test3.h"
@@ -23,6 +26,16 @@
 #define MATRIX_MULT_16_MAX_ERROR_ABS  1.5
 #define MATRIX_MULT_16_MAX_ERROR_RMS  0.5
 
+/* Shapes a rows, a columns, b columns for the 32 bit accumulation tests */
+static const int matrix_acc32_shapes[][3] = {
+	{1, 23, 13},	/* MFCC mel energies to cepstral coefficients */
+	{13, 23, 13},
+	{5, 7, 3},
+	{7, 33, 70},	/* odd inner dimension, two column strips */
+	{64, 64, 64},
+	{256, 256, 256},
+};
+
 static void matrix_mult_16_test(const int16_t *a_ref, const int16_t *b_ref, const int16_t *c_ref,
 				int elementwise, int a_rows, int a_columns,
 				int b_rows, int b_columns, int c_rows, int c_columns,
@@ -161,6 +174,176 @@ static void test_matrix_mult_16_test4(void **state)
 			    MATRIX_MULT_16_TEST4_C_QXY_Y);
 }
 
+static struct mat_matrix_16b *matrix_random_16b(int rows, int columns, int fractions,
+						  int shift)
+{
+	struct mat_matrix_16b *m = mat_matrix_alloc_16b(rows, columns, fractions);
+	int i;
+
+	if (!m)
+		exit(EXIT_FAILURE);
+
+	for (i = 0; i < rows * columns; i++)
+		m->data[i] = (int16_t)(rand() - RAND_MAX / 2) >> shift;
+
+	return m;
+}
+
+/* The blocked and the pre-transposed multiply must match mat_multiply()
+ * exactly when the sums of products fit to 32 bits.
+ */
+static void matrix_acc32_test(int frac_a, int frac_b, int frac_c)
+{
+	struct mat_matrix_16b *a, *b, *bt, *c_ref, *c;
+	int m, k, n, shift, i;
+	int s;
+
+	srand(1);
+	for (s = 0; s < ARRAY_SIZE(matrix_acc32_shapes); s++) {
+		m = matrix_acc32_shapes[s][0];
+		k = matrix_acc32_shapes[s][1];
+		n = matrix_acc32_shapes[s][2];
+
+		/* leave headroom of log2(k) bits */
+		for (shift = 0; (1 << shift) < k; shift++)
+			;
+
+		a = matrix_random_16b(m, k, frac_a, shift / 2);
+		b = matrix_random_16b(k, n, frac_b, shift - shift / 2);
+		bt = mat_matrix_alloc_16b(n, k, 0);
+		c_ref = mat_matrix_alloc_16b(m, n, frac_c);
+		c = mat_matrix_alloc_16b(m, n, frac_c);
+		if (!bt || !c_ref || !c)
+			exit(EXIT_FAILURE);
+
+		assert_int_equal(mat_multiply(a, b, c_ref), 0);
+
+		assert_int_equal(mat_multiply_acc32(a, b, c), 0);
+		for (i = 0; i < m * n; i++)
+			assert_int_equal(c->data[i], c_ref->data[i]);
+
+		assert_int_equal(mat_transpose_16b(b, bt), 0);
+		assert_int_equal(bt->fractions, frac_b);
+		memset(c->data, 0, sizeof(int16_t) * m * n);
+		assert_int_equal(mat_multiply_transposed_acc32(a, bt, c), 0);
+		for (i = 0; i < m * n; i++)
+			assert_int_equal(c->data[i], c_ref->data[i]);
+
+		assert_int_equal(mat_multiply_acc32(a, bt, c), k == n ? 0 : -EINVAL);
+
+		free(a);
+		free(b);
+		free(bt);
+		free(c_ref);
+		free(c);
+	}
+}
+
+static void test_matrix_mult_acc32_q15(void **state)
+{
+	(void)state;
+
+	matrix_acc32_test(15, 15, 14);
+}
+
+static void test_matrix_mult_acc32_q0(void **state)
+{
+	(void)state;
+
+	matrix_acc32_test(0, 0, 0);
+}
+
+static void test_matrix_mult_elementwise_exact(void **state)
+{
+	struct mat_matrix_16b *a, *b, *c;
+	int64_t p;
+	int16_t ref;
+	int i;
+
+	(void)state;
+
+	/* 3 x 37 elements to cover the tail of the vector versions */
+	srand(2);
+	a = matrix_random_16b(3, 37, 15, 0);
+	b = matrix_random_16b(3, 37, 12, 0);
+	c = mat_matrix_alloc_16b(3, 37, 13);
+	if (!c)
+		exit(EXIT_FAILURE);
+
+	assert_int_equal(mat_multiply_elementwise(a, b, c), 0);
+	for (i = 0; i < 3 * 37; i++) {
+		p = (int32_t)a->data[i] * b->data[i];
+		ref = (int16_t)(((p >> 13) + 1) >> 1);
+		assert_int_equal(c->data[i], ref);
+	}
+
+	free(a);
+	free(b);
+	free(c);
+}
+
+static double bench_ns(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+/* Informative only, prints the time of one multiply with each version */
+static void test_matrix_mult_bench(void **state)
+{
+	struct mat_matrix_16b *a, *b, *bt, *c;
+	struct timespec start, end;
+	double naive_ns, acc32_ns, transposed_ns;
+	int m, k, n, runs, r;
+	int s;
+
+	(void)state;
+
+	srand(3);
+	printf("%-14s %12s %12s %12s\n", "m x k x n", "naive_ns", "blocked_ns",
+	       "transposed_ns");
+	for (s = 0; s < ARRAY_SIZE(matrix_acc32_shapes); s++) {
+		m = matrix_acc32_shapes[s][0];
+		k = matrix_acc32_shapes[s][1];
+		n = matrix_acc32_shapes[s][2];
+		runs = MAX(1, 20000000 / (m * k * n));
+
+		a = matrix_random_16b(m, k, 15, 4);
+		b = matrix_random_16b(k, n, 15, 4);
+		bt = mat_matrix_alloc_16b(n, k, 15);
+		c = mat_matrix_alloc_16b(m, n, 15);
+		if (!bt || !c)
+			exit(EXIT_FAILURE);
+
+		mat_transpose_16b(b, bt);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < runs; r++)
+			mat_multiply(a, b, c);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		naive_ns = bench_ns(&start, &end) / runs;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < runs; r++)
+			mat_multiply_acc32(a, b, c);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		acc32_ns = bench_ns(&start, &end) / runs;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (r = 0; r < runs; r++)
+			mat_multiply_transposed_acc32(a, bt, c);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		transposed_ns = bench_ns(&start, &end) / runs;
+
+		printf("%3d x %3d x %3d %12.0f %12.0f %12.0f\n", m, k, n, naive_ns, acc32_ns,
+		       transposed_ns);
+
+		free(a);
+		free(b);
+		free(bt);
+		free(c);
+	}
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -168,6 +351,10 @@ int main(void)
 		cmocka_unit_test(test_matrix_mult_16_test2),
 		cmocka_unit_test(test_matrix_mult_16_test3),
 		cmocka_unit_test(test_matrix_mult_16_test4),
+		cmocka_unit_test(test_matrix_mult_acc32_q15),
+		cmocka_unit_test(test_matrix_mult_acc32_q0),
+		cmocka_unit_test(test_matrix_mult_elementwise_exact),
+		cmocka_unit_test(test_matrix_mult_bench),
 	};
 
 	cmocka_set_message_output(CM_OUTPUT_TAP);
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/schedule/ll_task_queue.h>
+#include <sof/schedule/task.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cmocka.h>
+
+#define TEST_TASKS	16
+#define TEST_RUNS	2000
+
+struct test_data {
+	struct ll_task_queue queue;
+	struct task tasks[TEST_TASKS];
+	int index[TEST_TASKS];
+};
+
+static int setup(void **state)
+{
+	struct test_data *data = calloc(1, sizeof(*data));
+
+	if (!data)
+		return -1;
+
+	ll_task_queue_init(&data->queue);
+	*state = data;
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	free(*state);
+	return 0;
+}
+
+/* adds tasks with the given priorities in the given order */
+static void test_add(struct test_data *data, const int *priority, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		data->tasks[i].priority = priority[i];
+		data->index[i] = ll_task_queue_add(&data->queue, data->tasks + i);
+	}
+}
+
+/* checks that walking the queue visits the tasks in the expected order */
+static void test_check_order(struct test_data *data, const int *expected, int count)
+{
+	struct list_item *item;
+	int index;
+	int n = 0;
+
+	ll_task_queue_for_each(&data->queue, index, item) {
+		assert_true(n < count);
+		assert_ptr_equal(container_of(item, struct task, list),
+				 data->tasks + expected[n]);
+		n++;
+	}
+
+	assert_int_equal(n, count);
+}
+
+/* same order as a single list sorted by priority, FIFO among equal ones,
+ * including the priorities sharing the last list
+ */
+static void test_ll_task_queue_priority_order(void **state)
+{
+	struct test_data *data = *state;
+	const int priority[] = {5, 0, 9, 5, 0, 4, 9, 40, 33, 35, 33, 0, 31, 4};
+	const int expected[] = {1, 4, 11, 5, 13, 0, 3, 2, 6, 12, 8, 10, 9, 7};
+
+	test_add(data, priority, ARRAY_SIZE(priority));
+	test_check_order(data, expected, ARRAY_SIZE(expected));
+}
+
+/* tasks added next to a reference keep their place whatever the priority */
+static void test_ll_task_queue_next_to(void **state)
+{
+	struct test_data *data = *state;
+	const int priority[] = {0, 4, 9};
+	const int expected[] = {0, 3, 1, 2, 4, 5};
+
+	test_add(data, priority, ARRAY_SIZE(priority));
+
+	data->tasks[3].priority = 9;
+	ll_task_queue_add_next_to(&data->queue, data->tasks + 3, data->tasks + 1,
+				  data->index[1], true);
+	data->index[3] = data->index[1];
+
+	data->tasks[4].priority = 0;
+	ll_task_queue_add_next_to(&data->queue, data->tasks + 4, data->tasks + 2,
+				  data->index[2], false);
+	data->index[4] = data->index[2];
+
+	/* ordinary add goes after everything of the same priority list */
+	data->tasks[5].priority = 9;
+	data->index[5] = ll_task_queue_add(&data->queue, data->tasks + 5);
+
+	test_check_order(data, expected, ARRAY_SIZE(expected));
+}
+
+/* tasks added after a reference of another priority stay ordered as in a
+ * single sorted list
+ */
+static void test_ll_task_queue_mixed(void **state)
+{
+	struct test_data *data = *state;
+	const int priority[] = {1};
+	const int expected_all[] = {0, 2, 3, 1, 5, 6, 4};
+	const int expected_del[] = {0, 2, 3, 1, 5, 4};
+
+	test_add(data, priority, ARRAY_SIZE(priority));
+
+	/* R(1), then B(5) after R */
+	data->tasks[1].priority = 5;
+	ll_task_queue_add_next_to(&data->queue, data->tasks + 1, data->tasks + 0,
+				  data->index[0], false);
+	data->index[1] = data->index[0];
+
+	/* C(1) and D(3) go before B, E(9) after it */
+	data->tasks[2].priority = 1;
+	data->index[2] = ll_task_queue_add(&data->queue, data->tasks + 2);
+	data->tasks[3].priority = 3;
+	data->index[3] = ll_task_queue_add(&data->queue, data->tasks + 3);
+	data->tasks[4].priority = 9;
+	data->index[4] = ll_task_queue_add(&data->queue, data->tasks + 4);
+
+	/* A(0) before E, F(5) goes after A */
+	data->tasks[5].priority = 0;
+	ll_task_queue_add_next_to(&data->queue, data->tasks + 5, data->tasks + 4,
+				  data->index[4], true);
+	data->index[5] = data->index[4];
+	data->tasks[6].priority = 5;
+	data->index[6] = ll_task_queue_add(&data->queue, data->tasks + 6);
+
+	test_check_order(data, expected_all, ARRAY_SIZE(expected_all));
+
+	/* removing tasks keeps the order of the others */
+	ll_task_queue_del(&data->queue, data->tasks + 6, data->index[6]);
+	test_check_order(data, expected_del, ARRAY_SIZE(expected_del));
+}
+
+/* random adds and removes give the order of a single sorted list */
+static void test_ll_task_queue_random(void **state)
+{
+	struct test_data *data = *state;
+	struct list_item ref_list;
+	struct list_item ref_items[TEST_TASKS];
+	struct list_item *item;
+	struct task *task;
+	bool queued[TEST_TASKS] = { false };
+	int expected[TEST_TASKS];
+	int count = 0;
+	int run;
+	int ref;
+	int i;
+	int n;
+
+	list_init(&ref_list);
+	srand(1);
+
+	for (run = 0; run < TEST_RUNS; run++) {
+		i = rand() % TEST_TASKS;
+		task = data->tasks + i;
+
+		if (queued[i]) {
+			ll_task_queue_del(&data->queue, task, data->index[i]);
+			list_item_del(&ref_items[i]);
+			queued[i] = false;
+			count--;
+		} else {
+			task->priority = rand() % 8 ? rand() % 6 : 30 + rand() % 4;
+			ref = rand() % TEST_TASKS;
+			if (count && queued[ref] && !(rand() % 3)) {
+				ll_task_queue_add_next_to(&data->queue, task, data->tasks + ref,
+							  data->index[ref], ref & 1);
+				data->index[i] = data->index[ref];
+				if (ref & 1)
+					list_item_append(&ref_items[i], &ref_items[ref]);
+				else
+					list_item_prepend(&ref_items[i], &ref_items[ref]);
+			} else {
+				data->index[i] = ll_task_queue_add(&data->queue, task);
+
+				/* the single list, before the first lower priority */
+				list_for_item(item, &ref_list) {
+					if (task->priority < data->tasks[item - ref_items].priority)
+						break;
+				}
+				list_item_append(&ref_items[i], item);
+			}
+			queued[i] = true;
+			count++;
+		}
+
+		n = 0;
+		list_for_item(item, &ref_list)
+			expected[n++] = item - ref_items;
+		test_check_order(data, expected, count);
+	}
+}
+
+/* removing the last task of a list skips it in the walk */
+static void test_ll_task_queue_del(void **state)
+{
+	struct test_data *data = *state;
+	const int priority[] = {3, 3, 31, 7, 50};
+	const int expected_all[] = {0, 1, 3, 2, 4};
+	const int expected_del[] = {1, 2, 4};
+	int i;
+
+	test_add(data, priority, ARRAY_SIZE(priority));
+	test_check_order(data, expected_all, ARRAY_SIZE(expected_all));
+
+	assert_int_equal(ll_task_queue_next_list(&data->queue, -1), 3);
+	assert_int_equal(ll_task_queue_next_list(&data->queue, 3), 7);
+	assert_int_equal(ll_task_queue_next_list(&data->queue, 7), LL_TASK_QUEUE_LISTS - 1);
+	assert_int_equal(ll_task_queue_next_list(&data->queue, LL_TASK_QUEUE_LISTS - 1),
+			 LL_TASK_QUEUE_LISTS);
+
+	ll_task_queue_del(&data->queue, data->tasks + 0, data->index[0]);
+	ll_task_queue_del(&data->queue, data->tasks + 3, data->index[3]);
+	test_check_order(data, expected_del, ARRAY_SIZE(expected_del));
+
+	assert_int_equal(ll_task_queue_next_list(&data->queue, -1), 3);
+	assert_int_equal(ll_task_queue_next_list(&data->queue, 3), LL_TASK_QUEUE_LISTS - 1);
+
+	for (i = 0; i < ARRAY_SIZE(expected_del); i++)
+		ll_task_queue_del(&data->queue, data->tasks + expected_del[i],
+				  data->index[expected_del[i]]);
+
+	assert_true(ll_task_queue_is_empty(&data->queue));
+	assert_int_equal(ll_task_queue_next_list(&data->queue, -1), LL_TASK_QUEUE_LISTS);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_ll_task_queue_priority_order,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_ll_task_queue_next_to, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_ll_task_queue_mixed, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_ll_task_queue_random, setup, teardown),
+		cmocka_unit_test_setup_teardown(test_ll_task_queue_del, setup, teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
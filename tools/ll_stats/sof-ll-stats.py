@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright (c) 2026, Intel Corporation. All rights reserved.
+
+# Tool to decode the reply of the IPC4 base firmware LL_SCHEDULER_STATS
+# large config parameter. The reply is a sequence of tuples, a core
+# tuple for each core followed by the task tuples of the core. Pass the
+# binary reply, e.g. dumped by the host driver, as a file or on stdin.
+# --self-test encodes replies as the firmware does and checks that they
+# decode back to the same statistics.
+
+import argparse
+import itertools
+import struct
+import sys
+import uuid
+
+IPC4_LL_CORE_STATS = 0
+IPC4_LL_TASK_STATS = 1
+IPC4_LL_STATS_PAD = 2
+
+# SOF_IPC_MSG_MAX_SIZE, the reply ends with a shorter block
+BLOCK_SIZE = 384
+
+TUPLE_HEADER = struct.Struct('<II')
+CORE_STATS = struct.Struct('<7I')
+HIST_BINS = 16
+TASK_STATS = struct.Struct('<16s6I%dI' % HIST_BINS)
+
+def cycles_to_us(cycles, budget):
+    """LL tick is 1 ms, so the budget gives cycles per ms"""
+    return cycles * 1000.0 / budget if budget else 0.0
+
+def print_core(core_id, ticks, overruns, budget, window_cycles, window_busy, task_count):
+    busy = 100.0 * window_busy / window_cycles if window_cycles else 0.0
+    print('core %d: %d ticks, %d overruns, budget %d cycles' %
+          (core_id, ticks, overruns, budget))
+    print('  busy %.1f%% idle %.1f%% over the last %.0f ms, %d tasks' %
+          (busy, 100.0 - busy, cycles_to_us(window_cycles, budget) / 1000, task_count))
+
+def print_task(fields, budget, args):
+    uuid_bytes, task_id, priority, runs, overruns, cycles_max, shift = fields[:7]
+    hist = fields[7:]
+
+    print('  task %s id 0x%08x priority %d' %
+          (uuid.UUID(bytes_le=uuid_bytes), task_id, priority))
+    print('    %d runs, %d overruns, max %d cycles (%.1f us)' %
+          (runs, overruns, cycles_max, cycles_to_us(cycles_max, budget)))
+
+    for i, count in enumerate(hist):
+        if not count and not args.all_bins:
+            continue
+
+        low = 0 if i == 0 else 1 << (i + shift)
+        high = '' if i == HIST_BINS - 1 else str((1 << (i + shift + 1)) - 1)
+        share = 100.0 * count / runs if runs else 0.0
+        print('    %9d - %-9s cycles %10d %5.1f%%' % (low, high, count, share))
+
+def parse(data):
+    """Returns the (type, fields) of the tuples of the reply"""
+    records = []
+    offset = 0
+
+    while offset + TUPLE_HEADER.size <= len(data):
+        tuple_type, length = TUPLE_HEADER.unpack_from(data, offset)
+        offset += TUPLE_HEADER.size
+        payload = data[offset:offset + length]
+        offset += length
+
+        if len(payload) < length:
+            sys.exit('truncated tuple at offset %d' % (offset - length))
+
+        if tuple_type == IPC4_LL_CORE_STATS:
+            records.append((tuple_type, CORE_STATS.unpack_from(payload)))
+        elif tuple_type == IPC4_LL_TASK_STATS:
+            records.append((tuple_type, TASK_STATS.unpack_from(payload)))
+        elif tuple_type != IPC4_LL_STATS_PAD:
+            records.append((tuple_type, length))
+
+    return records
+
+def decode(data, args):
+    budget = 0
+
+    for tuple_type, fields in parse(data):
+        if tuple_type == IPC4_LL_CORE_STATS:
+            budget = fields[3]
+            print_core(*fields)
+        elif tuple_type == IPC4_LL_TASK_STATS:
+            print_task(fields, budget, args)
+        else:
+            print('unknown tuple type %d, length %d' % (tuple_type, fields))
+
+def encode(records):
+    """Packs the reply as basefw_ll_stats_take() in the firmware"""
+    data = b''
+
+    for tuple_type, fields in records:
+        fmt = CORE_STATS if tuple_type == IPC4_LL_CORE_STATS else TASK_STATS
+        data += TUPLE_HEADER.pack(tuple_type, fmt.size) + fmt.pack(*fields)
+
+    if len(data) % BLOCK_SIZE == 0:
+        data += TUPLE_HEADER.pack(IPC4_LL_STATS_PAD, 0)
+
+    return data
+
+def read_blocks(data):
+    """Reads the reply in blocks as the host, until a short block. The
+    firmware fails a block starting at the end of the reply."""
+    reply = b''
+
+    while True:
+        if len(reply) >= len(data):
+            return None
+        block = data[len(reply):len(reply) + BLOCK_SIZE]
+        reply += block
+        if len(block) < BLOCK_SIZE:
+            return reply
+
+def self_test():
+    """Round trip of replies of up to four cores with any task counts"""
+    padded = 0
+
+    for cores in range(1, 5):
+        for task_counts in itertools.product(range(9), repeat=cores):
+            records = []
+            for core_id, tasks in enumerate(task_counts):
+                records.append((IPC4_LL_CORE_STATS,
+                                (core_id, 1000 + core_id, core_id, 38400,
+                                 0xfffffff0, 0x12345678, tasks + 1)))
+                for i in range(tasks):
+                    hist = tuple((i * HIST_BINS + b) * 0x01010101 & 0xffffffff
+                                 for b in range(HIST_BINS))
+                    records.append((IPC4_LL_TASK_STATS,
+                                    (bytes(range(i, i + 16)), i, i % 3, 1 << i,
+                                     i, 0xffffffff - i, 6) + hist))
+
+            data = encode(records)
+            padded += data.endswith(TUPLE_HEADER.pack(IPC4_LL_STATS_PAD, 0))
+            reply = read_blocks(data)
+            if reply is None or parse(reply) != records:
+                sys.exit('self test failed, task counts %s' % (task_counts,))
+
+    # some of the replies fill whole blocks and get the padding
+    if not padded:
+        sys.exit('self test failed, no padded reply')
+
+    print('self test passed')
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode SOF LL scheduler statistics')
+    parser.add_argument('file', nargs='?', help='binary reply, stdin if omitted')
+    parser.add_argument('-a', '--all-bins', action='store_true',
+                        help='print empty histogram bins too')
+    parser.add_argument('--self-test', action='store_true',
+                        help='check that encoded replies decode back')
+    args = parser.parse_args()
+
+    if args.self_test:
+        self_test()
+        return
+
+    if args.file:
+        with open(args.file, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    decode(data, args)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,121 @@
+#!/bin/bash
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+# stop on most errors
+set -e
+
+usage ()
+{
+    cat <<EOFHELP
+Usage:     $0 <options> <build_a> <build_b> <comp direction bits fs input>
+Example:   $0 -r 20 ../../testbench/build_ref ../../testbench/build_testbench \\
+	   multiband-drc playback 32 48000 input.raw
+
+Runs the testbench benchmark mode (-B) of two testbench builds with the
+same component test topology and input. The outputs of the builds must be
+identical. The median copy() time, MCPS and cycles per frame of each
+component are printed side by side with the speedup of build_b.
+
+Options:
+  -c <channels>, default 2
+  -r <number of benchmark runs>, default 10
+  -x <extra testbench options>, e.g. "-G"
+EOFHELP
+}
+
+parse_args ()
+{
+    # Defaults
+    CHANNELS=2
+    RUNS=10
+    EXTRA_OPTS=
+
+    while getopts ":hc:r:x:" opt; do
+	case "${opt}" in
+	    c)
+		CHANNELS="${OPTARG}"
+		;;
+	    h)
+		usage
+		exit
+		;;
+	    r)
+		RUNS="${OPTARG}"
+		;;
+	    x)
+		EXTRA_OPTS="${OPTARG}"
+		;;
+	    *)
+		usage
+		exit 1
+		;;
+	esac
+    done
+
+    shift $((OPTIND -1))
+
+    [ $# -eq 7 ] || {
+	usage "$0"
+	exit 1
+    }
+
+    BUILD_A="$1"
+    BUILD_B="$2"
+    COMP="$3"
+    DIRECTION="$4"
+    BITS="$5"
+    FS="$6"
+    FN_IN="$7"
+}
+
+# run_build <build root> <tag>
+run_build ()
+{
+    local host_exe=$1/install/bin/testbench
+    local fn_out=perf_$2_out.raw
+    local fn_csv=perf_$2.csv
+
+    rm -f "$fn_out" "$fn_csv"
+    echo "Command:         $host_exe"
+    # shellcheck disable=SC2086
+    LD_LIBRARY_PATH=$1/sof_ep/install/lib:$1/sof_parser/install/lib \
+	"$host_exe" -q -r "$FS" -R "$FS" -c "$CHANNELS" -n "$CHANNELS" \
+	-b "S${BITS}_LE" -t "$TPLG" -B "$RUNS" -O "$fn_csv" $EXTRA_OPTS \
+	-i "$FN_IN" -o "$fn_out" > /dev/null
+}
+
+parse_args "$@"
+
+# Use topology from component test topologies
+TPLG_DIR=../../build_tools/test/topology
+FMT=s${BITS}le
+TPLGFN=test-${DIRECTION}-ssp5-mclk-0-I2S-${COMP}-${FMT}-${FMT}-48k-24576k-codec.tplg
+TPLG=${TPLG_DIR}/${TPLGFN}
+
+run_build "$BUILD_A" a
+run_build "$BUILD_B" b
+
+if ! cmp -s perf_a_out.raw perf_b_out.raw; then
+    echo "Error: outputs of $BUILD_A and $BUILD_B differ" >&2
+    exit 1
+fi
+echo "Outputs are identical."
+
+# The CSV columns are component,id,copies,period_us,min_ns,median_ns,
+# p99_ns,max_ns,mcps,frames,cycles_per_frame
+awk -F, 'FNR == 1 { next }
+	NR == FNR {
+		median[$1 "," $2] = $6; mcps[$1 "," $2] = $9; cpf[$1 "," $2] = $11
+		next
+	}
+	($1 "," $2) in median {
+		printf "%-16s %4s %12d %12d %8.3f %8.3f %9.1f %9.1f %6.2fx\n", $1, $2,
+		       median[$1 "," $2], $6, mcps[$1 "," $2], $9, cpf[$1 "," $2], $11,
+		       $6 ? median[$1 "," $2] / $6 : 0
+	}
+	BEGIN {
+		printf "%-16s %4s %12s %12s %8s %8s %9s %9s %7s\n", "component", "id",
+		       "median_a_ns", "median_b_ns", "mcps_a", "mcps_b", "cpf_a", "cpf_b",
+		       "speedup"
+	}' perf_a.csv perf_b.csv
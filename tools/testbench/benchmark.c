@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* per component copy() timing for testbench benchmark mode */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+#include <sof/sof.h>
+#include <sof/list.h>
+#include <sof/ipc/driver.h>
+#include <sof/ipc/topology.h>
+#include <sof/audio/component.h>
+#include <sof/audio/pipeline.h>
+#include "testbench/common_test.h"
+#include "testbench/benchmark.h"
+
+/* collected copy() times of one component over all benchmark runs */
+struct tb_bench_stats {
+	uint32_t comp_id;
+	const char *name;
+	uint32_t period_us;	/* pipeline period, copies are done at this rate */
+	uint32_t frames;	/* frames per copy() */
+	uint64_t *ns;		/* copy() durations */
+	size_t count;
+	size_t size;
+};
+
+/* component with copy() replaced by the timing wrapper */
+struct tb_bench_comp {
+	struct comp_driver drv;		/* copy of the original driver */
+	const struct comp_driver *orig;
+	struct comp_dev *dev;
+	struct tb_bench_stats *stats;
+	bool record;
+	bool used;
+};
+
+static struct tb_bench_stats bench_stats[TB_BENCH_MAX_COMPS];
+static struct tb_bench_comp bench_comps[TB_BENCH_MAX_COMPS];
+static int bench_stats_num;
+static pthread_mutex_t bench_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *tb_bench_comp_name(const struct comp_driver *drv)
+{
+	int i;
+
+	switch (drv->type) {
+	case SOF_COMP_HOST:
+	case SOF_COMP_DAI:
+	case SOF_COMP_FILEREAD:
+	case SOF_COMP_FILEWRITE:
+		return "file";
+	default:
+		break;
+	}
+
+	for (i = 0; i < NUM_WIDGETS_SUPPORTED; i++) {
+		if (!lib_table[i].comp_name)
+			continue;
+
+		if (lib_table[i].uid && drv->uid &&
+		    !memcmp(lib_table[i].uid, drv->uid, UUID_SIZE))
+			return lib_table[i].comp_name;
+
+		if (drv->type != SOF_COMP_NONE && drv->type == lib_table[i].widget_type)
+			return lib_table[i].comp_name;
+	}
+
+	/* module adapter drivers are not in the table by type, use the UUID name */
+	if (drv->tctx && drv->tctx->uuid_p)
+		return drv->tctx->uuid_p->name;
+
+	return "unknown";
+}
+
+static struct tb_bench_stats *tb_bench_get_stats(struct comp_dev *dev)
+{
+	struct tb_bench_stats *stats;
+	int i;
+
+	for (i = 0; i < bench_stats_num; i++)
+		if (bench_stats[i].comp_id == dev->ipc_config.id)
+			return &bench_stats[i];
+
+	if (bench_stats_num == TB_BENCH_MAX_COMPS)
+		return NULL;
+
+	stats = &bench_stats[bench_stats_num++];
+	stats->comp_id = dev->ipc_config.id;
+	stats->name = tb_bench_comp_name(dev->drv);
+	stats->period_us = dev->pipeline->period;
+	return stats;
+}
+
+static void tb_bench_add(struct tb_bench_stats *stats, uint64_t ns)
+{
+	uint64_t *tmp;
+
+	if (stats->count == stats->size) {
+		stats->size = stats->size ? stats->size * 2 : 4096;
+		tmp = realloc(stats->ns, stats->size * sizeof(*stats->ns));
+		if (!tmp) {
+			stats->size = stats->count;
+			return;
+		}
+		stats->ns = tmp;
+	}
+
+	stats->ns[stats->count++] = ns;
+}
+
+static int tb_bench_copy(struct comp_dev *dev)
+{
+	struct tb_bench_comp *bc = container_of(dev->drv, struct tb_bench_comp, drv);
+	struct timespec t0, t1;
+	int ret;
+
+	clock_gettime(CLOCK_MONOTONIC_RAW, &t0);
+	ret = bc->orig->ops.copy(dev);
+	clock_gettime(CLOCK_MONOTONIC_RAW, &t1);
+
+	if (bc->record && !bc->stats->frames)
+		bc->stats->frames = dev->frames;
+
+	if (bc->record)
+		tb_bench_add(bc->stats, (uint64_t)(t1.tv_sec - t0.tv_sec) * 1000000000 +
+			     t1.tv_nsec - t0.tv_nsec);
+
+	return ret;
+}
+
+void tb_bench_attach(int pipeline_id, bool record)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	struct tb_bench_comp *bc;
+	struct comp_dev *cd;
+	int i;
+
+	pthread_mutex_lock(&bench_lock);
+
+	list_for_item(clist, &sof_get()->ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_COMPONENT)
+			continue;
+
+		cd = icd->cd;
+		if (cd->pipeline->pipeline_id != pipeline_id || !cd->drv->ops.copy)
+			continue;
+
+		for (i = 0; i < TB_BENCH_MAX_COMPS; i++)
+			if (!bench_comps[i].used)
+				break;
+
+		if (i == TB_BENCH_MAX_COMPS) {
+			fprintf(stderr, "warning: benchmark supports max %d components\n",
+				TB_BENCH_MAX_COMPS);
+			break;
+		}
+
+		bc = &bench_comps[i];
+		bc->stats = tb_bench_get_stats(cd);
+		if (!bc->stats)
+			break;
+
+		bc->used = true;
+		bc->record = record;
+		bc->dev = cd;
+		bc->orig = cd->drv;
+		bc->drv = *cd->drv;
+		bc->drv.ops.copy = tb_bench_copy;
+		cd->drv = &bc->drv;
+	}
+
+	pthread_mutex_unlock(&bench_lock);
+}
+
+void tb_bench_detach(int pipeline_id)
+{
+	struct tb_bench_comp *bc;
+	int i;
+
+	pthread_mutex_lock(&bench_lock);
+
+	for (i = 0; i < TB_BENCH_MAX_COMPS; i++) {
+		bc = &bench_comps[i];
+		if (!bc->used || bc->dev->pipeline->pipeline_id != pipeline_id)
+			continue;
+
+		bc->dev->drv = bc->orig;
+		bc->used = false;
+	}
+
+	pthread_mutex_unlock(&bench_lock);
+}
+
+static int tb_bench_cmp(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a;
+	uint64_t y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* host clock for MCPS, from environment or the first CPU in /proc/cpuinfo */
+static double tb_bench_host_mhz(void)
+{
+	char line[256];
+	char *env;
+	double mhz = 0;
+	FILE *fh;
+
+	env = getenv("SOF_HOST_MHZ");
+	if (env)
+		mhz = atof(env);
+
+	if (mhz > 0)
+		return mhz;
+
+	fh = fopen("/proc/cpuinfo", "r");
+	if (fh) {
+		while (fgets(line, sizeof(line), fh))
+			if (sscanf(line, "cpu MHz : %lf", &mhz) == 1)
+				break;
+		fclose(fh);
+	}
+
+	return mhz > 0 ? mhz : TB_BENCH_DEFAULT_MHZ;
+}
+
+static uint64_t tb_bench_percentile(const struct tb_bench_stats *stats, int percent)
+{
+	return stats->ns[(stats->count - 1) * percent / 100];
+}
+
+/* cycles per second at the pipeline rate in millions */
+static double tb_bench_mcps(const struct tb_bench_stats *stats, double mhz)
+{
+	if (!stats->period_us)
+		return 0;
+
+	return (double)tb_bench_percentile(stats, 50) * mhz / (stats->period_us * 1000.0);
+}
+
+/* host cycles per processed frame */
+static double tb_bench_cycles_per_frame(const struct tb_bench_stats *stats, double mhz)
+{
+	if (!stats->frames)
+		return 0;
+
+	return (double)tb_bench_percentile(stats, 50) * mhz / (stats->frames * 1000.0);
+}
+
+int tb_bench_report(struct testbench_prm *tp)
+{
+	const struct tb_bench_stats *stats;
+	bool json = false;
+	bool first = true;
+	FILE *fh = NULL;
+	double mhz = tb_bench_host_mhz();
+	size_t len;
+	int i;
+
+	for (i = 0; i < bench_stats_num; i++)
+		if (bench_stats[i].count)
+			qsort(bench_stats[i].ns, bench_stats[i].count, sizeof(uint64_t),
+			      tb_bench_cmp);
+
+	printf("==========================================================\n");
+	printf("		           Benchmark\n");
+	printf("==========================================================\n");
+	printf("Runs: %d (+1 warm-up), host clock %.0f MHz, pipeline copy %s\n",
+	       tp->benchmark_runs, mhz, tp->copy_walk ? "graph walk" : "flat copy list");
+	printf("%-16s %6s %8s %10s %10s %10s %10s %8s %10s\n", "component", "id", "copies",
+	       "min us", "median us", "p99 us", "max us", "MCPS", "cyc/frame");
+	for (i = 0; i < bench_stats_num; i++) {
+		stats = &bench_stats[i];
+		if (!stats->count)
+			continue;
+
+		printf("%-16s %6u %8zu %10.2f %10.2f %10.2f %10.2f %8.2f %10.1f\n",
+		       stats->name, stats->comp_id, stats->count,
+		       stats->ns[0] / 1000.0, tb_bench_percentile(stats, 50) / 1000.0,
+		       tb_bench_percentile(stats, 99) / 1000.0,
+		       stats->ns[stats->count - 1] / 1000.0, tb_bench_mcps(stats, mhz),
+		       tb_bench_cycles_per_frame(stats, mhz));
+	}
+	printf("\n");
+
+	if (!tp->benchmark_file)
+		return 0;
+
+	/* JSON for .json file name, otherwise CSV */
+	len = strlen(tp->benchmark_file);
+	if (len > 5 && !strcmp(tp->benchmark_file + len - 5, ".json"))
+		json = true;
+
+	fh = fopen(tp->benchmark_file, "w");
+	if (!fh) {
+		fprintf(stderr, "error: can't open benchmark file %s\n", tp->benchmark_file);
+		return -errno;
+	}
+
+	if (json) {
+		fprintf(fh, "{\n\t\"runs\": %d,\n\t\"host_mhz\": %.0f,\n",
+			tp->benchmark_runs, mhz);
+		fprintf(fh, "\t\"copy_walk\": %s,\n\t\"components\": [",
+			tp->copy_walk ? "true" : "false");
+	} else {
+		fprintf(fh, "component,id,copies,period_us,min_ns,median_ns,p99_ns,max_ns,mcps,");
+		fprintf(fh, "frames,cycles_per_frame\n");
+	}
+
+	for (i = 0; i < bench_stats_num; i++) {
+		stats = &bench_stats[i];
+		if (!stats->count)
+			continue;
+
+		if (json) {
+			fprintf(fh, "%s\n\t\t{\"component\": \"%s\", \"id\": %u, ",
+				first ? "" : ",", stats->name, stats->comp_id);
+			fprintf(fh, "\"copies\": %zu, \"period_us\": %u, ",
+				stats->count, stats->period_us);
+			fprintf(fh, "\"min_ns\": %" PRIu64 ", \"median_ns\": %" PRIu64 ", ",
+				stats->ns[0], tb_bench_percentile(stats, 50));
+			fprintf(fh, "\"p99_ns\": %" PRIu64 ", \"max_ns\": %" PRIu64 ", ",
+				tb_bench_percentile(stats, 99), stats->ns[stats->count - 1]);
+			fprintf(fh, "\"mcps\": %.3f, \"frames\": %u, ", tb_bench_mcps(stats, mhz),
+				stats->frames);
+			fprintf(fh, "\"cycles_per_frame\": %.2f}",
+				tb_bench_cycles_per_frame(stats, mhz));
+		} else {
+			fprintf(fh, "%s,%u,%zu,%u,", stats->name, stats->comp_id, stats->count,
+				stats->period_us);
+			fprintf(fh, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.3f,",
+				stats->ns[0], tb_bench_percentile(stats, 50),
+				tb_bench_percentile(stats, 99), stats->ns[stats->count - 1],
+				tb_bench_mcps(stats, mhz));
+			fprintf(fh, "%u,%.2f\n", stats->frames,
+				tb_bench_cycles_per_frame(stats, mhz));
+		}
+
+		first = false;
+	}
+
+	if (json)
+		fprintf(fh, "\n\t]\n}\n");
+
+	fclose(fh);
+	return 0;
+}
+
+void tb_bench_free(void)
+{
+	int i;
+
+	for (i = 0; i < bench_stats_num; i++) {
+		free(bench_stats[i].ns);
+		bench_stats[i].ns = NULL;
+	}
+
+	bench_stats_num = 0;
+}
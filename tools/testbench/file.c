@@ -31,6 +31,9 @@ DECLARE_TR_CTX(file_tr, SOF_UUID(file_uuid), LOG_LEVEL_INFO);
 static const struct comp_driver comp_file_dai;
 static const struct comp_driver comp_file_host;
 
+/* samples shifted at a time for 24 bit WAV write */
+#define FILE_WAV_SCRATCH_SAMPLES	256
+
 /*
  * Helpers for s24_4le data. To avoid an overflown 24 bit to be taken as valid 32 bit
  * sample mask in file read the 8 most signing bits to zeros. In file write similarly
@@ -80,58 +83,109 @@ static void sign_extend_source_s24(const struct audio_stream *source, int sample
 }
 
 /*
- * Read 32-bit samples from binary file
+ * Read samples from raw or WAV file. Each part of the request that does not
+ * wrap in sink buffer is read with one fread().
  */
-static int read_binary_s32(struct file_comp_data *cd, const struct audio_stream *sink, int samples)
+static int read_binary(struct file_comp_data *cd, const struct audio_stream *sink,
+		       int samples, size_t sample_bytes)
 {
-	int32_t *snk = (int32_t *)sink->w_ptr;
+	uint8_t *snk = (uint8_t *)sink->w_ptr;
+	size_t bytes = samples * sample_bytes;
 	size_t samples_avail;
 	size_t bytes_snk;
-	size_t bytes = samples * sizeof(int32_t);
-	int ret;
 	int samples_copied = 0;
+	int ret;
+	int i;
+
+	/* WAV data chunk may be followed by other chunks */
+	if (cd->fs.f_format == FILE_WAV && bytes >= cd->fs.wav.data_bytes) {
+		bytes = cd->fs.wav.data_bytes;
+		cd->fs.reached_eof = true;
+	}
 
 	while (bytes) {
 		bytes_snk = audio_stream_bytes_without_wrap(sink, snk);
-		samples_avail = FILE_BYTES_TO_S32_SAMPLES(MIN(bytes, bytes_snk));
-		ret = fread(snk, sizeof(int32_t), samples_avail, cd->fs.rfh);
+		samples_avail = MIN(bytes, bytes_snk) / sample_bytes;
+		ret = fread(snk, sample_bytes, samples_avail, cd->fs.rfh);
 		if (!ret) {
-			cd->fs.reached_eof = 1;
+			cd->fs.reached_eof = true;
 			return samples_copied;
 		}
 
+		/* 24 bit WAV samples are MSB aligned in the container */
+		if (cd->fs.f_format == FILE_WAV && cd->fs.wav.frame_fmt == SOF_IPC_FRAME_S24_4LE)
+			for (i = 0; i < ret; i++)
+				((int32_t *)snk)[i] >>= 8;
+
+		if (cd->fs.f_format == FILE_WAV)
+			cd->fs.wav.data_bytes -= ret * sample_bytes;
+
 		samples_copied += ret;
-		bytes -= ret * sizeof(int32_t);
-		snk = audio_stream_wrap(sink, snk + ret);
+		bytes -= ret * sample_bytes;
+		snk = audio_stream_wrap(sink, snk + ret * sample_bytes);
 	}
 
 	return samples_copied;
 }
 
 /*
- * Write 32-bit samples to binary file
+ * Write 24 bit samples to WAV file MSB aligned in the container. The
+ * samples are shifted to a scratch block, the source is left as is.
  */
-static int write_binary_s32(struct file_comp_data *cd, const struct audio_stream *source,
-			    int samples)
+static size_t write_wav_s24(struct file_comp_data *cd, const int32_t *src, size_t samples)
 {
-	int32_t *src = (int32_t *)source->r_ptr;
+	int32_t scratch[FILE_WAV_SCRATCH_SAMPLES];
+	size_t samples_written = 0;
+	size_t n;
+	size_t ret;
+	size_t i;
+
+	while (samples_written < samples) {
+		n = MIN(samples - samples_written, FILE_WAV_SCRATCH_SAMPLES);
+		for (i = 0; i < n; i++)
+			scratch[i] = (uint32_t)src[samples_written + i] << 8;
+
+		ret = fwrite(scratch, sizeof(int32_t), n, cd->fs.wfh);
+		samples_written += ret;
+		if (ret < n)
+			break;
+	}
+
+	return samples_written;
+}
+
+/*
+ * Write samples to raw or WAV file, one fwrite() for each part of the
+ * request that does not wrap in source buffer.
+ */
+static int write_binary(struct file_comp_data *cd, const struct audio_stream *source,
+			int samples, size_t sample_bytes)
+{
+	uint8_t *src = (uint8_t *)source->r_ptr;
+	size_t bytes = samples * sample_bytes;
 	size_t samples_avail;
 	size_t bytes_src;
-	size_t bytes = samples * sizeof(int32_t);
-	int ret;
 	int samples_copied = 0;
+	int ret;
 
 	while (bytes) {
 		bytes_src = audio_stream_bytes_without_wrap(source, src);
-		samples_avail = FILE_BYTES_TO_S32_SAMPLES(MIN(bytes, bytes_src));
-		ret = fwrite(src, sizeof(int32_t), samples_avail, cd->fs.wfh);
-		if (ret == 0) {
+		samples_avail = MIN(bytes, bytes_src) / sample_bytes;
+
+		if (cd->fs.f_format == FILE_WAV && cd->fs.wav.frame_fmt == SOF_IPC_FRAME_S24_4LE)
+			ret = write_wav_s24(cd, (const int32_t *)src, samples_avail);
+		else
+			ret = fwrite(src, sample_bytes, samples_avail, cd->fs.wfh);
+
+		if (!ret) {
 			cd->fs.write_failed = true;
 			return samples_copied;
 		}
+
+		cd->fs.wav.data_bytes += ret * sample_bytes;
 		samples_copied += ret;
-		bytes -= ret * sizeof(int32_t);
-		src = audio_stream_wrap(source, src + ret);
+		bytes -= ret * sample_bytes;
+		src = audio_stream_wrap(source, src + ret * sample_bytes);
 	}
 
 	return samples_copied;
@@ -204,8 +258,9 @@ static int read_samples_s32(struct file_comp_data *cd, const struct audio_stream
 
 	switch (cd->fs.f_format) {
 	case FILE_RAW:
-		/* raw input file */
-		n_samples = read_binary_s32(cd, sink, samples);
+	case FILE_WAV:
+		/* raw or WAV input file */
+		n_samples = read_binary(cd, sink, samples, sizeof(int32_t));
 		break;
 	case FILE_TEXT:
 		/* text input file */
@@ -234,8 +289,9 @@ static int write_samples_s32(struct file_comp_data *cd, struct audio_stream *sou
 
 	switch (cd->fs.f_format) {
 	case FILE_RAW:
-		/* raw input file */
-		samples_written = write_binary_s32(cd, source, samples);
+	case FILE_WAV:
+		/* raw or WAV output file */
+		samples_written = write_binary(cd, source, samples, sizeof(int32_t));
 		break;
 	case FILE_TEXT:
 		/* text input file */
@@ -248,65 +304,6 @@ static int write_samples_s32(struct file_comp_data *cd, struct audio_stream *sou
 	return samples_written;
 }
 
-/*
- * Read 16-bit samples from binary file
- */
-static int read_binary_s16(struct file_comp_data *cd, const struct audio_stream *sink, int samples)
-{
-	int16_t *snk = (int16_t *)sink->w_ptr;
-	size_t samples_avail;
-	size_t bytes_snk;
-	size_t bytes = samples * sizeof(int16_t);
-	int ret;
-	int samples_copied = 0;
-
-	while (bytes) {
-		bytes_snk = audio_stream_bytes_without_wrap(sink, snk);
-		samples_avail = FILE_BYTES_TO_S16_SAMPLES(MIN(bytes, bytes_snk));
-		ret = fread(snk, sizeof(int16_t), samples_avail, cd->fs.rfh);
-		if (!ret) {
-			cd->fs.reached_eof = 1;
-			return samples_copied;
-		}
-
-		samples_copied += ret;
-		bytes -= ret * sizeof(int16_t);
-		snk = audio_stream_wrap(sink, snk + ret);
-	}
-
-	return samples_copied;
-}
-
-/*
- * Write 16-bit samples to binary file
- */
-static int write_binary_s16(struct file_comp_data *cd, const struct audio_stream *source,
-			    int samples)
-{
-	int16_t *src = (int16_t *)source->r_ptr;
-	size_t samples_avail;
-	size_t bytes_src;
-	size_t bytes = samples * sizeof(int16_t);
-	int ret;
-	int samples_copied = 0;
-
-	while (bytes) {
-		bytes_src = audio_stream_bytes_without_wrap(source, src);
-		samples_avail = FILE_BYTES_TO_S16_SAMPLES(MIN(bytes, bytes_src));
-		ret = fwrite(src, sizeof(int16_t), samples_avail, cd->fs.wfh);
-		if (!ret) {
-			cd->fs.write_failed = true;
-			return samples_copied;
-		}
-
-		samples_copied += ret;
-		bytes -= ret * sizeof(int16_t);
-		src = audio_stream_wrap(source, src + ret);
-	}
-
-	return samples_copied;
-}
-
 /*
  * Read 16-bit samples from text file
  */
@@ -373,8 +370,9 @@ static int read_samples_s16(struct file_comp_data *cd, const struct audio_stream
 
 	switch (cd->fs.f_format) {
 	case FILE_RAW:
-		/* raw input file */
-		n_samples = read_binary_s16(cd, sink, samples);
+	case FILE_WAV:
+		/* raw or WAV input file */
+		n_samples = read_binary(cd, sink, samples, sizeof(int16_t));
 		break;
 	case FILE_TEXT:
 		/* text input file */
@@ -396,8 +394,9 @@ static int write_samples_s16(struct file_comp_data *cd, struct audio_stream *sou
 
 	switch (cd->fs.f_format) {
 	case FILE_RAW:
-		/* raw input file */
-		samples_written = write_binary_s16(cd, source, samples);
+	case FILE_WAV:
+		/* raw or WAV output file */
+		samples_written = write_binary(cd, source, samples, sizeof(int16_t));
 		break;
 	case FILE_TEXT:
 		/* text input file */
@@ -529,6 +528,9 @@ static enum file_format get_file_format(char *filename)
 	if (!strcmp(ext, ".txt"))
 		return FILE_TEXT;
 
+	if (wav_is_wav_file(filename))
+		return FILE_WAV;
+
 	return FILE_RAW;
 }
 
@@ -613,6 +615,31 @@ static struct comp_dev *file_new(const struct comp_driver *drv,
 		goto error;
 	}
 
+	/* read and write whole periods through a large stdio buffer */
+	cd->fs.io_buf = malloc(FILE_IO_BUFFER_SIZE);
+	if (!cd->fs.io_buf ||
+	    setvbuf(cd->fs.mode == FILE_READ ? cd->fs.rfh : cd->fs.wfh, cd->fs.io_buf,
+		    _IOFBF, FILE_IO_BUFFER_SIZE)) {
+		fprintf(stderr, "error: file %s buffer allocation failed\n", cd->fs.fn);
+		goto error_close;
+	}
+
+	/* format of WAV input comes from the header, it must match topology */
+	if (cd->fs.f_format == FILE_WAV && cd->fs.mode == FILE_READ) {
+		if (wav_read_header(cd->fs.rfh, &cd->fs.wav) < 0) {
+			fprintf(stderr, "error: file %s is not a supported WAV file\n",
+				cd->fs.fn);
+			goto error_close;
+		}
+
+		if (cd->fs.wav.frame_fmt != cd->frame_fmt ||
+		    cd->fs.wav.channels != cd->channels) {
+			fprintf(stderr, "error: WAV file %s format does not match topology\n",
+				cd->fs.fn);
+			goto error_close;
+		}
+	}
+
 	cd->fs.reached_eof = false;
 	cd->fs.write_failed = false;
 	cd->fs.n = 0;
@@ -620,7 +647,16 @@ static struct comp_dev *file_new(const struct comp_driver *drv,
 	dev->state = COMP_STATE_READY;
 	return dev;
 
+error_close:
+	if (cd->fs.mode == FILE_READ)
+		fclose(cd->fs.rfh);
+	else
+		fclose(cd->fs.wfh);
+
+	free(cd->fs.io_buf);
+
 error:
+	free(cd->fs.fn);
 	free(cd);
 
 error_skip_cd:
@@ -644,11 +680,17 @@ static void file_free(struct comp_dev *dev)
 
 	comp_dbg(dev, "file_free()");
 
+	/* data size is known only now, rewrite WAV header */
+	if (cd->fs.f_format == FILE_WAV && cd->fs.mode == FILE_WRITE &&
+	    wav_write_header(cd->fs.wfh, &cd->fs.wav) < 0)
+		fprintf(stderr, "error: failed to update WAV header of %s\n", cd->fs.fn);
+
 	if (cd->fs.mode == FILE_READ)
 		fclose(cd->fs.rfh);
 	else
 		fclose(cd->fs.wfh);
 
+	free(cd->fs.io_buf);
 	free(cd->fs.fn);
 	free(cd);
 	free((void *)dd->dai->drv);
@@ -759,6 +801,19 @@ static int file_params(struct comp_dev *dev,
 	cd->sample_container_bytes = get_sample_bytes(stream->frame_fmt);
 	buffer_reset_pos(buffer, NULL);
 
+	/* header of WAV output is written again with size in file_free() */
+	if (cd->fs.f_format == FILE_WAV && cd->fs.mode == FILE_WRITE) {
+		cd->fs.wav.frame_fmt = stream->frame_fmt;
+		cd->fs.wav.channels = stream->channels;
+		cd->fs.wav.rate = stream->rate;
+		cd->fs.wav.data_bytes = 0;
+		ret = wav_write_header(cd->fs.wfh, &cd->fs.wav);
+		if (ret < 0) {
+			fprintf(stderr, "error: failed to write WAV header to %s\n", cd->fs.fn);
+			return ret;
+		}
+	}
+
 	return 0;
 }
 
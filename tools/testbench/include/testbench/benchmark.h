@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include <stdbool.h>
+
+struct testbench_prm;
+
+/* max number of components timed in benchmark mode */
+#define TB_BENCH_MAX_COMPS	64
+
+/* default host clock for MCPS if not known, override with SOF_HOST_MHZ */
+#define TB_BENCH_DEFAULT_MHZ	1000
+
+/* Wrap copy() of all components in pipeline with timing, record only if
+ * not in warm-up
+ */
+void tb_bench_attach(int pipeline_id, bool record);
+
+/* Restore original copy() of all components in pipeline */
+void tb_bench_detach(int pipeline_id);
+
+/* Print per component statistics and write report file if requested */
+int tb_bench_report(struct testbench_prm *tp);
+
+void tb_bench_free(void);
+
+#endif
@@ -52,6 +52,7 @@ struct testbench_prm {
 	int copy_iterations;
 	bool copy_check;
 	bool quiet;
+	bool copy_walk; /* walk the graph in pipeline_copy(), not the flat list */
 	int dynamic_pipeline_iterations;
 	int num_vcores;
 	int tick_period_us;
@@ -61,6 +62,8 @@ struct testbench_prm {
 	char *pipeline_string;
 	int output_file_index;
 	int input_file_index;
+	int benchmark_runs; /* timed runs after warm-up, 0 if not benchmarking */
+	char *benchmark_file; /* JSON or CSV benchmark report */
 
 	/* global cmd line args that can override topology */
 	enum sof_ipc_frame cmd_frame_fmt;
@@ -11,10 +11,18 @@
 #ifndef _FILE_H
 #define _FILE_H
 
+#include "testbench/wav.h"
+
 /**< Convert with right shift a bytes count to samples count */
 #define FILE_BYTES_TO_S16_SAMPLES(s)	((s) >> 1)
 #define FILE_BYTES_TO_S32_SAMPLES(s)	((s) >> 2)
 
+/* stdio buffer size for file reads and writes, the binary formats are
+ * read and written in blocks up to a period so the file is accessed in
+ * few large requests.
+ */
+#define FILE_IO_BUFFER_SIZE		(1024 * 1024)
+
 /* file component modes */
 enum file_mode {
 	FILE_READ = 0,
@@ -25,12 +33,15 @@ enum file_mode {
 enum file_format {
 	FILE_TEXT = 0,
 	FILE_RAW,
+	FILE_WAV,
 };
 
 /* file component state */
 struct file_state {
 	char *fn;
 	FILE *rfh, *wfh; /* read/write file handle */
+	char *io_buf; /* stdio buffer for rfh or wfh */
+	struct wav_format wav; /* WAV format, data_bytes is bytes left in read */
 	bool reached_eof;
 	bool write_failed;
 	int n;
@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef _WAV_H
+#define _WAV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <ipc/stream.h>
+
+/* Size of the header written by wav_write_header(), RIFF or RF64 */
+#define WAV_HEADER_SIZE		104
+
+/* WAV file PCM format and data chunk */
+struct wav_format {
+	enum sof_ipc_frame frame_fmt;	/* S16_LE, S24_4LE or S32_LE */
+	uint32_t channels;
+	uint32_t rate;
+	uint64_t data_bytes;		/* size of the data chunk */
+	long data_offset;		/* file offset of the first sample */
+};
+
+/*
+ * Parse RIFF or RF64 WAVE header and seek to the first sample. 16 bit and
+ * 32 bit containers with 16, 24 or 32 valid bits are supported.
+ * Return 0 on success or negative error code.
+ */
+int wav_read_header(FILE *fh, struct wav_format *fmt);
+
+/*
+ * Write header for fmt to start of file and seek to the first sample.
+ * The header size is fixed, call again with the final data_bytes after
+ * the samples are written. RF64 is used for data over 4 GB.
+ */
+int wav_write_header(FILE *fh, struct wav_format *fmt);
+
+/* Check if filename has .wav extension */
+bool wav_is_wav_file(const char *filename);
+
+#endif
@@ -15,6 +15,7 @@
 #include <tplg_parser/topology.h>
 #include "testbench/trace.h"
 #include "testbench/file.h"
+#include "testbench/benchmark.h"
 #include <limits.h>
 #include <stdlib.h>
 
@@ -165,6 +166,60 @@ static int parse_input_files(char *inputs, struct testbench_prm *tp)
 	return 0;
 }
 
+/*
+ * Take input format, rate and channels from the header of a WAV input file
+ * unless they are set in command line, the values must not conflict.
+ */
+static int parse_wav_input(struct testbench_prm *tp)
+{
+	static const char * const bits[] = {
+		[SOF_IPC_FRAME_S16_LE] = "S16_LE",
+		[SOF_IPC_FRAME_S24_4LE] = "S24_LE",
+		[SOF_IPC_FRAME_S32_LE] = "S32_LE",
+	};
+	struct wav_format wav;
+	FILE *fh;
+	int ret;
+
+	if (!tp->input_file_num || !wav_is_wav_file(tp->input_file[0]))
+		return 0;
+
+	fh = fopen(tp->input_file[0], "r");
+	if (!fh) {
+		fprintf(stderr, "error: opening file %s for reading - %s\n",
+			tp->input_file[0], strerror(errno));
+		return -errno;
+	}
+
+	ret = wav_read_header(fh, &wav);
+	fclose(fh);
+	if (ret < 0) {
+		fprintf(stderr, "error: file %s is not a supported WAV file\n",
+			tp->input_file[0]);
+		return ret;
+	}
+
+	if (!tp->bits_in) {
+		tp->bits_in = strdup(bits[wav.frame_fmt]);
+		tp->cmd_frame_fmt = wav.frame_fmt;
+	}
+
+	if (!tp->cmd_fs_in)
+		tp->cmd_fs_in = wav.rate;
+
+	if (!tp->cmd_channels_in)
+		tp->cmd_channels_in = wav.channels;
+
+	if (tp->cmd_frame_fmt != wav.frame_fmt || tp->cmd_fs_in != wav.rate ||
+	    tp->cmd_channels_in != wav.channels) {
+		fprintf(stderr, "error: -b, -r or -c conflicts with WAV file %s header\n",
+			tp->input_file[0]);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 static int parse_pipelines(char *pipelines, struct testbench_prm *tp)
 {
 	char *output_token = NULL;
@@ -247,17 +302,26 @@ static void print_usage(char *executable)
 	printf("  -s Use real time priorities for threads (needs sudo)\n");
 	printf("  -C <number of copy() iterations>\n");
 	printf("  -D <pipeline duration in ms>\n");
+	printf("  -G Walk the pipeline graph in copy(), default is the flat copy list\n");
 	printf("  -P <number of dynamic pipeline iterations>\n");
 	printf("  -T <microseconds for tick, 0 for batch mode>\n");
-	printf("  -V <number of virtual cores>\n\n");
+	printf("  -V <number of virtual cores>\n");
+	printf("  -B <number of benchmark runs>, time copy() of each component\n");
+	printf("  -O <benchmark report file>, .json for JSON, otherwise CSV\n\n");
 	printf("Options for input and output format override:\n");
 	printf("  -b <input_format>, S16_LE, S24_LE, or S32_LE\n");
+	printf("     Not needed for .wav input, format, rate and channels are\n");
+	printf("     taken from the header. Output .wav files are RIFF or RF64\n");
 	printf("  -c <input channels>\n");
 	printf("  -n <output channels>\n");
 	printf("  -r <input rate>\n");
 	printf("  -R <output rate>\n\n");
 	printf("Environment variables\n");
 	printf("  SOF_HOST_CORE0=<i> - Map DSP core 0..N to host i..i+N\n");
+	printf("  SOF_HOST_MHZ=<f> - Host clock for benchmark MCPS\n");
+	printf("  SOF_HOST_LL_WORKERS=<n> - Run LL pipelines on n threads,\n");
+	printf("     0 for all host cores, pipelines not scheduled before or\n");
+	printf("     after each other run in parallel\n");
 	printf("Help:\n");
 	printf("  -h\n\n");
 	printf("Example Usage:\n");
@@ -399,7 +463,7 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 	int option = 0;
 	int ret = 0;
 
-	while ((option = getopt(argc, argv, "hdqi:o:t:b:a:r:R:c:n:C:P:Vp:T:D:")) != -1) {
+	while ((option = getopt(argc, argv, "hdqGi:o:t:b:a:r:R:c:n:C:P:Vp:T:D:B:O:")) != -1) {
 		switch (option) {
 		/* input sample file */
 		case 'i':
@@ -462,6 +526,11 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			tp->quiet = true;
 			break;
 
+		/* walk the graph in pipeline copy instead of the flat list */
+		case 'G':
+			tp->copy_walk = true;
+			break;
+
 		/* number of dynamic pipeline iterations */
 		case 'P':
 			tp->dynamic_pipeline_iterations = atoi(optarg);
@@ -487,6 +556,16 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			tp->pipeline_duration_ms = atoi(optarg);
 			break;
 
+		/* number of benchmark runs after a warm-up run */
+		case 'B':
+			tp->benchmark_runs = atoi(optarg);
+			break;
+
+		/* benchmark report file */
+		case 'O':
+			tp->benchmark_file = strdup(optarg);
+			break;
+
 		/* print usage */
 		default:
 			fprintf(stderr, "unknown option %c\n", option);
@@ -609,6 +688,7 @@ static int test_pipeline_start(struct pipeline_thread_data *ptdata)
 	/* Run pipeline until EOF from fileread */
 	for (i = 0; i < tp->pipeline_num; i++) {
 		p = get_pipeline_by_id(tp->pipelines[i]);
+		p->copy_walk = tp->copy_walk;
 
 		/* do we need to apply copy count limit ? */
 		if (tp->copy_check)
@@ -624,6 +704,25 @@ static int test_pipeline_start(struct pipeline_thread_data *ptdata)
 	return 0;
 }
 
+/* time copy() of components, the first run is a warm-up */
+static void test_pipeline_bench_attach(struct pipeline_thread_data *ptdata, bool record)
+{
+	struct testbench_prm *tp = ptdata->tp;
+	int i;
+
+	for (i = 0; i < tp->pipeline_num; i++)
+		tb_bench_attach(tp->pipelines[i], record);
+}
+
+static void test_pipeline_bench_detach(struct pipeline_thread_data *ptdata)
+{
+	struct testbench_prm *tp = ptdata->tp;
+	int i;
+
+	for (i = 0; i < tp->pipeline_num; i++)
+		tb_bench_detach(tp->pipelines[i]);
+}
+
 static bool test_pipeline_check_state(struct pipeline_thread_data *ptdata, int state)
 {
 	struct testbench_prm *tp = ptdata->tp;
@@ -735,6 +834,7 @@ static void test_pipeline_stats(struct pipeline_thread_data *ptdata,
 	}
 	printf("Input sample (frame) count: %d (%d)\n", n_in, n_in / ctx->channels_in);
 	printf("Output sample (frame) count: %d (%d)\n", n_out, n_out / ctx->channels_out);
+	printf("Pipeline copy: %s\n", tp->copy_walk ? "graph walk" : "flat copy list");
 	printf("Total execution time: %zu us, %.2f x realtime\n\n",
 	       delta, (double)((double)n_out / ctx->channels_out / ctx->fs_out) * 1000000 / delta);
 }
@@ -780,6 +880,9 @@ static void *pipline_test(void *data)
 			break;
 		}
 
+		if (tp->benchmark_runs)
+			test_pipeline_bench_attach(ptdata, dp_count > 0);
+
 		err = test_pipeline_start(ptdata);
 		if (err < 0) {
 			fprintf(stderr, "error: pipeline run %d failed %d\n",
@@ -827,6 +930,9 @@ static void *pipline_test(void *data)
 			break;
 		}
 
+		if (tp->benchmark_runs)
+			test_pipeline_bench_detach(ptdata);
+
 		delta = (td1.tv_sec - td0.tv_sec) * 1000000;
 		delta += (td1.tv_nsec - td0.tv_nsec) / 1000;
 		test_pipeline_stats(ptdata, &ctx, delta);
@@ -868,7 +974,7 @@ int main(int argc, char **argv)
 	for (i = 0; i < MAX_INPUT_FILE_NUM; i++)
 		tp.input_file[i] = NULL;
 
-	tp.cmd_channels_in = TESTBENCH_NCH;
+	tp.cmd_channels_in = 0;
 	tp.cmd_channels_out = 0;
 	tp.max_pipeline_id = 0;
 	tp.copy_check = false;
@@ -881,12 +987,21 @@ int main(int argc, char **argv)
 	tp.tick_period_us = 0; /* Execute fast non-real time, for 1 ms tick use -T 1000 */
 	tp.pipeline_duration_ms = 5000;
 	tp.copy_iterations = 1;
+	tp.benchmark_runs = 0;
+	tp.benchmark_file = NULL;
 
 	/* command line arguments*/
 	err = parse_input_args(argc, argv, &tp);
 	if (err < 0)
 		goto out;
 
+	err = parse_wav_input(&tp);
+	if (err < 0)
+		goto out;
+
+	if (!tp.cmd_channels_in)
+		tp.cmd_channels_in = TESTBENCH_NCH;
+
 	if (!tp.cmd_channels_out)
 		tp.cmd_channels_out = tp.cmd_channels_in;
 
@@ -925,6 +1040,10 @@ int main(int argc, char **argv)
 			tp.num_vcores = 1;
 	}
 
+	/* benchmark runs are repeated after one warm-up run */
+	if (tp.benchmark_runs > 0)
+		tp.dynamic_pipeline_iterations = tp.benchmark_runs + 1;
+
 	if (tp.quiet)
 		tb_enable_trace(false); /* reduce trace output */
 	else
@@ -954,6 +1073,11 @@ join:
 	for (i = 0; i < tp.num_vcores; i++)
 		err = pthread_join(hc.thread_id[i], NULL);
 
+	if (tp.benchmark_runs > 0) {
+		tb_bench_report(&tp);
+		tb_bench_free();
+	}
+
 	/* free other core FW services */
 	tb_free(sof_get());
 
@@ -968,6 +1092,7 @@ out:
 		free(tp.input_file[i]);
 
 	free(tp.pipeline_string);
+	free(tp.benchmark_file);
 
 #ifdef TESTBENCH_CACHE_CHECK
 	_cache_free_all();
@@ -817,7 +817,8 @@ int parse_topology(struct tplg_context *ctx)
 	size_t size;
 	bool pipeline_match;
 
-	/* initialize output file index */
+	/* initialize file indexes, topology is loaded again for every run */
+	tp->input_file_index = 0;
 	tp->output_file_index = 0;
 
 	/* open topology file */
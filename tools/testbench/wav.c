@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* RIFF and RF64 WAVE file headers for the file component */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <ipc/stream.h>
+#include "testbench/wav.h"
+
+#define WAV_FORMAT_PCM		0x0001
+#define WAV_FORMAT_EXTENSIBLE	0xfffe
+
+/* RIFF and data chunk size field value when the size is in ds64 chunk */
+#define WAV_SIZE_IN_DS64	0xffffffff
+
+/* chunk sizes in the written header */
+#define WAV_DS64_SIZE		28
+#define WAV_FMT_SIZE		40
+
+/* KSDATAFORMAT_SUBTYPE_PCM after the format tag */
+static const uint8_t wav_pcm_guid_tail[14] = {
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00,
+	0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71,
+};
+
+static uint16_t get_le16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return get_le16(p) | ((uint32_t)get_le16(p + 2) << 16);
+}
+
+static uint64_t get_le64(const uint8_t *p)
+{
+	return get_le32(p) | ((uint64_t)get_le32(p + 4) << 32);
+}
+
+static uint8_t *put_le16(uint8_t *p, uint16_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	return p + 2;
+}
+
+static uint8_t *put_le32(uint8_t *p, uint32_t v)
+{
+	p = put_le16(p, v);
+	return put_le16(p, v >> 16);
+}
+
+static uint8_t *put_le64(uint8_t *p, uint64_t v)
+{
+	p = put_le32(p, v);
+	return put_le32(p, v >> 32);
+}
+
+static uint8_t *put_id(uint8_t *p, const char *id)
+{
+	int i;
+
+	for (i = 0; i < 4; i++)
+		p[i] = id[i];
+
+	return p + 4;
+}
+
+/* map container and valid bits from fmt chunk to SOF frame format */
+static int wav_frame_fmt(const uint8_t *fmt, uint32_t size, struct wav_format *wav)
+{
+	uint16_t tag = get_le16(fmt);
+	uint16_t block_align = get_le16(fmt + 12);
+	uint16_t bits = get_le16(fmt + 14);
+	uint16_t valid_bits = bits;
+
+	if (tag == WAV_FORMAT_EXTENSIBLE) {
+		if (size < WAV_FMT_SIZE)
+			return -EINVAL;
+
+		valid_bits = get_le16(fmt + 18);
+		tag = get_le16(fmt + 24);
+		if (memcmp(fmt + 26, wav_pcm_guid_tail, sizeof(wav_pcm_guid_tail)))
+			return -EINVAL;
+	}
+
+	wav->channels = get_le16(fmt + 2);
+	wav->rate = get_le32(fmt + 4);
+	if (tag != WAV_FORMAT_PCM || !wav->channels || block_align != wav->channels * bits / 8)
+		return -EINVAL;
+
+	if (bits == 16 && valid_bits == 16)
+		wav->frame_fmt = SOF_IPC_FRAME_S16_LE;
+	else if (bits == 32 && valid_bits == 24)
+		wav->frame_fmt = SOF_IPC_FRAME_S24_4LE;
+	else if (bits == 32 && valid_bits == 32)
+		wav->frame_fmt = SOF_IPC_FRAME_S32_LE;
+	else
+		return -EINVAL;
+
+	return 0;
+}
+
+int wav_read_header(FILE *fh, struct wav_format *fmt)
+{
+	uint8_t buf[WAV_FMT_SIZE];
+	uint64_t ds64_data_bytes = 0;
+	uint32_t size;
+	size_t n;
+	bool rf64;
+	bool have_fmt = false;
+	int ret;
+
+	if (fread(buf, 1, 12, fh) != 12 || memcmp(buf + 8, "WAVE", 4))
+		return -EINVAL;
+
+	if (!memcmp(buf, "RF64", 4))
+		rf64 = true;
+	else if (!memcmp(buf, "RIFF", 4))
+		rf64 = false;
+	else
+		return -EINVAL;
+
+	/* walk chunks until data, the samples follow its header */
+	while (fread(buf, 1, 8, fh) == 8) {
+		size = get_le32(buf + 4);
+
+		if (!memcmp(buf, "ds64", 4) && size >= WAV_DS64_SIZE) {
+			if (fread(buf, 1, 16, fh) != 16)
+				return -EINVAL;
+
+			ds64_data_bytes = get_le64(buf + 8);
+			size -= 16;
+		} else if (!memcmp(buf, "fmt ", 4) && size >= 16) {
+			n = size < WAV_FMT_SIZE ? size : WAV_FMT_SIZE;
+			if (fread(buf, 1, n, fh) != n)
+				return -EINVAL;
+
+			ret = wav_frame_fmt(buf, size, fmt);
+			if (ret < 0)
+				return ret;
+
+			have_fmt = true;
+			size -= n;
+		} else if (!memcmp(buf, "data", 4)) {
+			if (!have_fmt)
+				return -EINVAL;
+
+			fmt->data_bytes = size;
+			if (rf64 && size == WAV_SIZE_IN_DS64)
+				fmt->data_bytes = ds64_data_bytes;
+
+			fmt->data_offset = ftell(fh);
+			return 0;
+		}
+
+		/* skip rest of chunk and pad byte */
+		if (fseek(fh, size + (size & 1), SEEK_CUR) < 0)
+			return -errno;
+	}
+
+	return -EINVAL;
+}
+
+int wav_write_header(FILE *fh, struct wav_format *fmt)
+{
+	uint8_t buf[WAV_HEADER_SIZE];
+	uint8_t *p = buf;
+	uint32_t bits = fmt->frame_fmt == SOF_IPC_FRAME_S16_LE ? 16 : 32;
+	uint32_t valid_bits = fmt->frame_fmt == SOF_IPC_FRAME_S24_4LE ? 24 : bits;
+	uint32_t block_align = fmt->channels * bits / 8;
+	uint64_t riff_bytes = WAV_HEADER_SIZE - 8 + fmt->data_bytes;
+	bool rf64 = riff_bytes > UINT32_MAX;
+	int i;
+
+	switch (fmt->frame_fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+	case SOF_IPC_FRAME_S24_4LE:
+	case SOF_IPC_FRAME_S32_LE:
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	p = put_id(p, rf64 ? "RF64" : "RIFF");
+	p = put_le32(p, rf64 ? WAV_SIZE_IN_DS64 : riff_bytes);
+	p = put_id(p, "WAVE");
+
+	/* ds64 for RF64, otherwise the same space is a JUNK chunk */
+	p = put_id(p, rf64 ? "ds64" : "JUNK");
+	p = put_le32(p, WAV_DS64_SIZE);
+	p = put_le64(p, rf64 ? riff_bytes : 0);
+	p = put_le64(p, rf64 ? fmt->data_bytes : 0);
+	p = put_le64(p, rf64 ? fmt->data_bytes / block_align : 0);
+	p = put_le32(p, 0);
+
+	/* WAVE_FORMAT_EXTENSIBLE tells valid bits for 24 bit samples */
+	p = put_id(p, "fmt ");
+	p = put_le32(p, WAV_FMT_SIZE);
+	p = put_le16(p, WAV_FORMAT_EXTENSIBLE);
+	p = put_le16(p, fmt->channels);
+	p = put_le32(p, fmt->rate);
+	p = put_le32(p, fmt->rate * block_align);
+	p = put_le16(p, block_align);
+	p = put_le16(p, bits);
+	p = put_le16(p, 22);
+	p = put_le16(p, valid_bits);
+	p = put_le32(p, 0);
+	p = put_le16(p, WAV_FORMAT_PCM);
+	for (i = 0; i < sizeof(wav_pcm_guid_tail); i++)
+		*p++ = wav_pcm_guid_tail[i];
+
+	p = put_id(p, "data");
+	p = put_le32(p, rf64 ? WAV_SIZE_IN_DS64 : fmt->data_bytes);
+
+	if (fseek(fh, 0, SEEK_SET) < 0)
+		return -errno;
+
+	if (fwrite(buf, 1, sizeof(buf), fh) != sizeof(buf))
+		return -EIO;
+
+	fmt->data_offset = sizeof(buf);
+	return 0;
+}
+
+bool wav_is_wav_file(const char *filename)
+{
+	const char *ext = strrchr(filename, '.');
+
+	return ext && !strcasecmp(ext, ".wav");
+}